@@ -0,0 +1,126 @@
+//============================================================================
+//                                  I B E X
+// File        : benchmark_hessian.cpp
+// Author      : Gilles Chabert
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+//
+// Interval Hessian matrix by automatic differentiation (Hessian class,
+// forward-over-reverse on the compiled DAG) vs. symbolic differentiation,
+// for scalable functions of increasing size.
+//
+//   g++ -O3 -o benchmark_hessian benchmark_hessian.cpp $(pkg-config --cflags --libs ibex)
+//   ./benchmark_hessian [max_size]
+//
+// Columns:
+// - setup  : first call (includes the structural pattern for AD, the
+//            symbolic derivatives for the other methods)
+// - AD     : Function::hessian (sparse form)
+// - Hv     : Hessian-vector product
+// - diff   : Jacobian of the symbolic gradient (f.diff())
+// - diff2  : evaluation of the symbolic Hessian (f.diff().diff())
+// - width  : sum of the widths of the symbolic Hessian / same for AD
+//============================================================================
+
+#include "ibex.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+using namespace std;
+using namespace ibex;
+
+namespace {
+
+// chained Rosenbrock function (tridiagonal Hessian)
+Function* rosenbrock(int n) {
+	Variable x(n,"x");
+	const ExprNode* e=&ExprConstant::new_scalar(0);
+	for (int i=0; i<n-1; i++)
+		e=&(*e + 100*sqr(x[i+1]-sqr(x[i])) + sqr(1-x[i]));
+	return new Function(x,*e);
+}
+
+// transcendental operators with a band of width 3
+Function* banded(int n) {
+	Variable x(n,"x");
+	const ExprNode* e=&ExprConstant::new_scalar(0);
+	for (int i=0; i<n-2; i++)
+		e=&(*e + sin(x[i]*x[i+1]) + exp(x[i]/n)*x[i+2] + sqrt(1+sqr(x[i]-x[i+2])));
+	return new Function(x,*e);
+}
+
+double total_width(const IntervalMatrix& A) {
+	double w=0;
+	for (int i=0; i<A.nb_rows(); i++)
+		for (int j=0; j<A.nb_cols(); j++) w+=A[i][j].diam();
+	return w;
+}
+
+// time of the call f(), repeated to last at least 0.2s
+template<class F>
+double timing(F f) {
+	Timer timer;
+	timer.start();
+	int nb=0;
+	do { f(); nb++; } while (timer.get_time()<0.2);
+	return timer.get_time()/nb;
+}
+
+// time of a single call f()
+template<class F>
+double once(F f) {
+	Timer timer;
+	timer.start();
+	f();
+	return timer.get_time();
+}
+
+void bench(const char* name, Function* (*build)(int), int max_size) {
+
+	printf("%s\n",name);
+	printf("%6s %10s %10s %10s %10s %10s %10s %10s %8s\n","n","setup","AD","Hv","setup","diff","setup","diff2","width");
+
+	for (int n=25; n<=max_size; n*=2) {
+		IntervalVector box(n,Interval(0.5,0.6));
+		IntervalVector v(n,Interval::ONE);
+		IntervalVector Hv(n);
+		SparseIntervalMatrix H(1,1);
+		IntervalMatrix H1(n,n), H2(n,n);
+
+		Function* f=build(n);
+		double s_ad=once([&]() { f->hessian(box,H); });
+		double t_ad=timing([&]() { f->hessian(box,H); });
+		double t_hv=timing([&]() { f->hessian_calculator().hessian_vector(box,v,Hv); });
+		delete f;
+
+		f=build(n);
+		double s_diff=once([&]() { f->diff().jacobian(box,H1); });
+		double t_diff=timing([&]() { f->diff().jacobian(box,H1); });
+		delete f;
+
+		f=build(n);
+		double s_diff2=once([&]() { H2=f->diff().diff().eval_matrix(box); });
+		double t_diff2=timing([&]() { H2=f->diff().diff().eval_matrix(box); });
+		delete f;
+
+		printf("%6d %10.2e %10.2e %10.2e %10.2e %10.2e %10.2e %10.2e %8.4f\n", n,
+				s_ad, t_ad, t_hv, s_diff, t_diff, s_diff2, t_diff2,
+				total_width(H2)/total_width(H.dense()));
+	}
+}
+
+} // end anonymous namespace
+
+int main(int argc, char** argv) {
+
+	int max_size=argc>1? atoi(argv[1]) : 200;
+
+	bench("chained Rosenbrock",rosenbrock,max_size);
+	bench("banded",banded,max_size);
+
+	return 0;
+}
@@ -0,0 +1,111 @@
+//============================================================================
+//                                  I B E X
+// File        : benchmark_linear.cpp
+// Author      : Gilles Chabert
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+//
+// Timing of the dense linear algebra routines (real inverse, interval
+// matrix products, preconditioning) for increasing sizes.
+//
+// Build ibex with and without --with-blas and compare the outputs:
+//
+//   g++ -O3 -o benchmark_linear benchmark_linear.cpp $(pkg-config --cflags --libs ibex)
+//   ./benchmark_linear [max_size]
+//
+// Columns:
+// - inverse : real_inverse of a (n x n) matrix
+// - C*A     : product of a real matrix by an interval matrix (operator*)
+// - midrad  : same product with midrad_mul
+// - A*B     : product of two interval matrices (operator*)
+// - midrad  : same product with midrad_mul
+// - precond : precond(A,b) (real inverse + product)
+// - width   : sum of the widths of the midrad product / same for operator*
+//             (1 for real*interval, <=1.5 for interval*interval)
+//============================================================================
+
+#include "ibex.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+using namespace std;
+using namespace ibex;
+
+namespace {
+
+// deterministic pseudo-random generator
+double next(unsigned int& seed) {
+	seed = seed*1103515245+12345;
+	return ((double) ((seed/65536) % 32768))/16384.0-1.0;
+}
+
+Matrix random_real(int n, unsigned int& seed) {
+	Matrix A(n,n);
+	for (int i=0; i<n; i++)
+		for (int j=0; j<n; j++) A[i][j]=next(seed);
+	return A;
+}
+
+IntervalMatrix random_itv(int n, double rad, unsigned int& seed) {
+	IntervalMatrix A(random_real(n,seed));
+	for (int i=0; i<n; i++)
+		for (int j=0; j<n; j++) A[i][j]+=rad*Interval(-1,1);
+	return A;
+}
+
+double total_width(const IntervalMatrix& A) {
+	double w=0;
+	for (int i=0; i<A.nb_rows(); i++)
+		for (int j=0; j<A.nb_cols(); j++) w+=A[i][j].diam();
+	return w;
+}
+
+// time of the call f(), repeated to last at least 0.2s
+template<class F>
+double timing(F f) {
+	Timer timer;
+	timer.start();
+	int nb=0;
+	do { f(); nb++; } while (timer.get_time()<0.2);
+	return timer.get_time()/nb;
+}
+
+} // end anonymous namespace
+
+int main(int argc, char** argv) {
+
+	int max_size=argc>1? atoi(argv[1]) : 400;
+
+#ifdef _IBEX_WITH_BLAS_
+	printf("BLAS/LAPACK: yes\n");
+#else
+	printf("BLAS/LAPACK: no\n");
+#endif
+	printf("%6s %10s %10s %10s %10s %10s %10s %8s %8s\n","n","inverse","C*A","midrad","A*B","midrad","precond","width","width");
+
+	for (int n=25; n<=max_size; n*=2) {
+		unsigned int seed=n;
+		Matrix C=random_real(n,seed);
+		IntervalMatrix A=random_itv(n,1e-3,seed);
+		IntervalMatrix B=random_itv(n,1e-3,seed);
+		IntervalVector b(n,Interval(-1,1));
+		Matrix invC(n,n);
+		IntervalMatrix R1(n,n), R2(n,n), R3(n,n), R4(n,n);
+
+		double t_inv=timing([&]() { real_inverse(C,invC); });
+		double t_ca=timing([&]() { R1=C*A; });
+		double t_ca2=timing([&]() { R2=midrad_mul(C,A); });
+		double t_ab=timing([&]() { R3=A*B; });
+		double t_ab2=timing([&]() { R4=midrad_mul(A,B); });
+		double t_pre=timing([&]() { IntervalMatrix A2(A); IntervalVector b2(b); precond(A2,b2); });
+
+		printf("%6d %10.2e %10.2e %10.2e %10.2e %10.2e %10.2e %8.4f %8.4f\n", n,
+				t_inv, t_ca, t_ca2, t_ab, t_ab2, t_pre,
+				total_width(R2)/total_width(R1), total_width(R4)/total_width(R3));
+	}
+	return 0;
+}
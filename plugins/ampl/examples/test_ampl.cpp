@@ -19,10 +19,28 @@ using namespace ibex;
 
 int main(int argc, char** argv) {
 
+	if (argc<2) {
+		cerr << "usage: test_ampl file.nl [file.txt]" << endl;
+		return 1;
+	}
+
 	cout<<"begin"<< endl;
+	Timer timer;
+	timer.start();
 	AmplInterface interface(argv[1]);
 	cout<<"creation ok"<< endl;
 	System sys(interface);
+	timer.stop();
+
+	// common subexpressions are shared by all the constraints in f_ctrs,
+	// so the DAG is smaller than the sum of the constraints' DAGs.
+	int ctr_nodes=0;
+	for (int i=0; i<sys.nb_ctr; i++)
+		ctr_nodes += sys.ctrs[i].f.nb_nodes();
+	cout<<"loading time : "<< timer.get_time() << "s" << endl;
+	cout<<"nodes in f_ctrs : "<< (sys.nb_ctr>0? sys.f_ctrs.nb_nodes() : 0)
+		<< " (sum over the constraints : " << ctr_nodes << ")" << endl;
+
 	cout<<"Bound_sys"<< endl;
 	cout<<sys.box<<endl;
 	cout<<sys<<endl;
@@ -32,6 +50,8 @@ int main(int argc, char** argv) {
 	cout<<"Extended System"<< endl;
 	cout<<ext_sys<<endl;
 */
+	if (argc<3) return 0;
+
 	System sys2(argv[2]);
 	cout<<"Bound_sys"<< endl;
 	cout<<sys2.box<<endl;
@@ -11,6 +11,9 @@
 #include "ibex_AmplInterface.h"
 #include "ibex_Exception.h"
 
+// EQ is also an opcode of the ASL (see opcode.hd)
+static const ibex::CmpOp CTR_EQ = ibex::EQ;
+
 #include "amplsolvers/asl.h"
 #include "amplsolvers/nlp.h"
 #include "amplsolvers/getstub.h"
@@ -216,6 +219,7 @@ bool AmplInterface::readnl() {
 	// the variable /////////////////////////////////////////////////////////////
 	// TODO only continuous variables for the moment
 	_x =new Variable(n_var,"x");
+	x_comp.assign(n_var, (const ExprNode*) NULL);
 	IntervalVector bound(n_var);
 
 		// Each has a linear and a nonlinear part
@@ -223,6 +227,10 @@ bool AmplInterface::readnl() {
 		//        http://www.gerad.ca/~orban/drampl/def-vars.html
 		//        http://www.gerad.ca/~orban/drampl/dag.html
 
+	// all the expressions built from the nl file (deleted at the end,
+	// once they have been copied by the factory)
+	std::vector<const ExprNode*> roots;
+
 	try {
 
 	// lower and upper bounds of the variables ///////////////////////////////////////////////////////////////
@@ -250,129 +258,62 @@ bool AmplInterface::readnl() {
 		for (int i = 0; i < n_obj; i++) {
 			///////////////////////////////////////////////////
 			//  the nonlinear part
-			const ExprNode *body = &(nl2expr (OBJ_DE [i] . e));
+			const ExprNode *body = nl_part(OBJ_DE [i] . e);
 
 			////////////////////////////////////////////////
 			// The linear part
-			// count nonzero terms in linear part
-			double coeff;
-			int index;
-			for (ograd *objgrad = Ograd [i]; objgrad; objgrad = objgrad -> next) {
-				if ((dynamic_cast<const ExprConstant*>(body))&&(((ExprConstant*)(body))->is_zero())) {
-					delete body;
-					if (fabs (objgrad -> coef) != 0.0) {
-						coeff = objgrad -> coef;
-						index = objgrad -> varno;
-						if (coeff==1) {
-							body = &((*_x)[index]);
-						} else if (coeff==-1) {
-							body = &( - (*_x)[index]);
-						} else {
-							body = &(coeff * (*_x)[index]);
-						}
-					}
-				} else {
-					if (fabs (objgrad -> coef) != 0.0) {
-						coeff = objgrad -> coef;
-						index = objgrad -> varno;
-						if (coeff==1) {
-							body = &(*body + (*_x)[index]);
-						} else if (coeff==-1) {
-							body = &(*body - (*_x)[index]);
-						} else {
-							body = &(*body +coeff * (*_x)[index]);
-						}
-					}
-				}
-			}
+			for (ograd *objgrad = Ograd [i]; objgrad; objgrad = objgrad -> next)
+				body = add_lin(body, objgrad -> coef, objgrad -> varno);
+
+			if (!body) body = &ExprConstant::new_scalar(0.);
 
 			////////////////////////////////////////////////
 			// Max or Min
 			// 3rd/ASL/solvers/asl.h, line 336: 0 is minimization, 1 is maximization
 			if (OBJ_sense [i] == 0) {
 				add_goal(*body);
+				roots.push_back(body);
 			} else {
-				add_goal(-(*body));
+				const ExprNode& goal=-(*body);
+				add_goal(goal);
+				roots.push_back(&goal);
 			}
 		}
 
 	// constraints ///////////////////////////////////////////////////////////////////
-		// allocate space for argument list of all constraints' summations
-		// of linear and nonlinear terms
-		const ExprNode **body_con = new const ExprNode*[n_con];
+		// All the constraints are built first and then given in bulk
+		// to the factory, so that common expressions (shared nodes in
+		// the DAG built by nl2expr) are not duplicated in the system.
+		std::vector<const ExprNode*> body_con(n_con);
 		///////////////////////////////////////////////////
 		// The nonlinear part :
 		//init array of each constraint with the nonlinear part
 		for (int i = 0; i<n_con;i++)
-			body_con[i] = &(nl2expr (CON_DE [i] . e));
+			body_con[i] = nl_part(CON_DE [i] . e);
 
 		///////////////////////////////////////////////////
-		// count all linear terms
+		// The linear part
 		if (A_colstarts && A_vals)    {      // Constraints' linear info is stored in A_vals
-			for (int j = 0; j < n_var; j++){
-				for (int i = A_colstarts [j], k = A_colstarts [j+1] - i; k--; i++) {
-					if ((dynamic_cast<const ExprConstant*>(body_con[A_rownos[i]]))&&(((ExprConstant*)(body_con[A_rownos[i]]))->is_zero())) {
-						delete body_con[A_rownos[i]];
-						if (A_vals[i]==1) {
-							body_con[A_rownos[i]] = &((*_x)[j]);
-						} else if (A_vals[i]==-1) {
-							body_con[A_rownos[i]] = &(- (*_x)[j]);
-						} else {
-							body_con[A_rownos[i]] = &((A_vals[i]) * (*_x)[j]);
-						}
-					} else {
-						if (A_vals[i]==1) {
-							body_con[A_rownos[i]] = &(*(body_con[A_rownos[i]]) + (*_x)[j]);
-						} else if (A_vals[i]==-1) {
-							body_con[A_rownos[i]] = &(*(body_con[A_rownos[i]]) - (*_x)[j]);
-						} else {
-							body_con[A_rownos[i]] = &(*(body_con[A_rownos[i]]) + (A_vals[i]) * (*_x)[j]);
-						}
-					}
-
-				}
-			}
+			for (int j = 0; j < n_var; j++)
+				for (int i = A_colstarts [j], k = A_colstarts [j+1] - i; k--; i++)
+					body_con[A_rownos[i]] = add_lin(body_con[A_rownos[i]], A_vals[i], j);
 		} else {		// Constraints' linear info is stored in Cgrad
-			cgrad *congrad;
-			double coeff;
-			int index;
 			for ( int i = 0; i < n_con; i++)
-				for (congrad = Cgrad [i]; congrad; congrad = congrad -> next) {
-					if ((dynamic_cast<const ExprConstant*>(body_con[i]))&&(((ExprConstant*)(body_con[i]))->is_zero())) {
-						delete body_con[i];
-						coeff = congrad -> coef;
-						if (fabs (coeff) != 0.0) {
-							index = congrad -> varno;
-							if (coeff==1) {
-								body_con[i] = &( (*_x)[index]);
-							} else if (coeff==-1) {
-								body_con[i] = &(-(*_x)[index]);
-							} else {
-								body_con[i] = &((coeff) * (*_x)[index]);
-							}
-						}
-
-					} else {
-						coeff = congrad -> coef;
-						if (fabs (coeff) != 0.0) {
-							index = congrad -> varno;
-							if (coeff==1) {
-								body_con[i] = &(*(body_con[i]) + (*_x)[index]);
-							} else if (coeff==-1) {
-								body_con[i] = &(*(body_con[i]) - (*_x)[index]);
-							} else {
-								body_con[i] = &(*(body_con[i]) + (coeff) * (*_x)[index]);
-							}
-						}
-					}
-				}
+				for (cgrad *congrad = Cgrad [i]; congrad; congrad = congrad -> next)
+					body_con[i] = add_lin(body_con[i], congrad -> coef, congrad -> varno);
 		}
+
 		///////////////////////////////////////////////////
 		// Kind of constraints : equality, inequality
+		Array<const ExprCtr> ctrs(n_con);
+
 		for (int i = 0; i < n_con; i++) {
 			int sig;
 			double lb, ub;
 
+			if (!body_con[i]) body_con[i] = &ExprConstant::new_scalar(0.);
+			const ExprNode& body = *body_con[i];
+
 			/* LUrhs is the constraint lower bound if Urhsx!=0, and the constraint lower and upper bound if Uvx == 0 */
 			if (Urhsx) {
 				lb = LUrhs [i];
@@ -388,57 +329,95 @@ bool AmplInterface::readnl() {
 				else                sig =2; // GEQ;
 			else                    sig =3; // LEQ;
 
-			// add them (and set lower-upper bound)
+			// build them (and set lower-upper bound)
 			switch (sig) {
 
 			case  1:  {
 				if (lb==ub) {
 					if (lb==0) {
-						add_ctr_eq((*(body_con[i])));
+						ctrs.set_ref(i, *new ExprCtr(body,CTR_EQ));
 					} else if (lb<0) {
-						add_ctr_eq((*(body_con[i])+(-lb)));
+						ctrs.set_ref(i, *new ExprCtr(body+(-lb),CTR_EQ));
 					} else {
-						add_ctr_eq((*(body_con[i])-lb));
+						ctrs.set_ref(i, *new ExprCtr(body-lb,CTR_EQ));
 					}
 				} else  {
-					 add_ctr_eq((*(body_con[i])-Interval(lb,ub)));
+					ctrs.set_ref(i, *new ExprCtr(body-Interval(lb,ub),CTR_EQ));
 				}
 				break;
 			}
 			case  2:  {
 				if (lb==0) {
-					add_ctr(ExprCtr(*(body_con[i]),GEQ));
+					ctrs.set_ref(i, *new ExprCtr(body,GEQ));
 				} else if (lb<0) {
-					add_ctr(ExprCtr(*(body_con[i])+(-lb),GEQ));
+					ctrs.set_ref(i, *new ExprCtr(body+(-lb),GEQ));
 				} else {
-					add_ctr(ExprCtr(*(body_con[i])-lb,GEQ));
+					ctrs.set_ref(i, *new ExprCtr(body-lb,GEQ));
 				}
 				break;
 			}
 			case  3: {
 				if (ub==0) {
-					add_ctr(ExprCtr(*(body_con[i]),LEQ));
+					ctrs.set_ref(i, *new ExprCtr(body,LEQ));
 				} else if (ub<0) {
-					add_ctr(ExprCtr(*(body_con[i])+(-ub),LEQ));
+					ctrs.set_ref(i, *new ExprCtr(body+(-ub),LEQ));
 				} else {
-					add_ctr(ExprCtr(*(body_con[i])-ub,LEQ));
+					ctrs.set_ref(i, *new ExprCtr(body-ub,LEQ));
 				}
 				break;
 			}
 			default: ibex_error("Error: could not recognize a constraint\n"); return false;
 			}
+
+			roots.push_back(&ctrs[i].e);
 		}
 
+		add_ctrs(ctrs);
 
-		delete[] body_con;
+		for (int i = 0; i < n_con; i++)
+			delete &ctrs[i];
 
 	} catch (...) {
 		return false;
 	}
 
+	// the factory has its own copy of the expressions
+	if (!roots.empty())
+		cleanup(Array<const ExprNode>(roots), false);
+	x_comp.clear();
+	var_data.clear();
+
 	return true;
 }
 
+const ExprNode& AmplInterface::var(int j) {
+	if (!x_comp[j]) x_comp[j] = &(*_x)[j];
+	return *x_comp[j];
+}
+
+const ExprNode* AmplInterface::nl_part(expr *e) {
+	if (getOperator(e->op)==OPNUM && ((expr_n *)e)->v==0)
+		return NULL;
+	else
+		return &nl2expr(e);
+}
+
+const ExprNode* AmplInterface::add_lin(const ExprNode* body, double coeff, int j) {
+	if (coeff==0) return body;
+
+	const ExprNode& xj=var(j);
+
+	if (!body) {
+		if (coeff==1)       return &xj;
+		else if (coeff==-1) return &(-xj);
+		else                return &(coeff*xj);
+	} else {
+		if (coeff==1)       return &(*body + xj);
+		else if (coeff==-1) return &(*body - xj);
+		else                return &(*body + coeff*xj);
+	}
+}
+
 // converts an AMPL expression (sub)tree into an expression* (sub)tree
 // thank to Dominique Orban for the explication of the DAG inside AMPL:
 // http://www.gerad.ca/~orban/drampl/dag.html
@@ -552,96 +531,50 @@ const ExprNode& AmplInterface::nl2expr(expr *e) {
 	case OPVARVAL:  {
 		int j = ((expr_v *) e) -> a;
 		if (j<n_var) {
-			return (*_x)[j];
+			return var(j);
 		}
 		else {
 			// http://www.gerad.ca/~orban/drampl/def-vars.html
 			// common expression | defined variable
 			int k = (expr_v *)e - VAR_E;
-			double coeff;
-			int index;
 
 			if( k >= n_var ) {
-				const ExprNode* body;
 				// This is a common expression. Find pointer to its root.
 
-				// Check if the common expression are already construct
-				if (var_data.find(k)!=var_data.end()) {
-					body = var_data[k];
+				// Check if the common expression is already built:
+				// it is then shared by all the expressions that use it.
+				if (var_data.find(k)!=var_data.end())
+					return *var_data[k];
+
+				// Construct the common expression
+				const ExprNode* body;
+				linpart* L;
+				int nlin; // Number of linear terms
+
+				j = k - n_var;
+				if( j < ncom0 ) 	{
+					cexp *common = CEXPS +j;
+					// init with the nonlinear part
+					body = nl_part(common->e);
+					L = common->L;
+					nlin = common->nlin;
 				}
 				else {
+					cexp1 *common = (CEXPS1 - ncom0) +j ;
+					// init with the nonlinear part
+					body = nl_part(common->e);
+					L = common->L;
+					nlin = common->nlin;
+				}
 
-					// Constract the common expression
-					j = k - n_var;
-					if( j < ncom0 ) 	{
-						cexp *common = CEXPS +j;
-						// init with the nonlinear part
-						body = &(nl2expr(common->e));
-
-						int nlin = common->nlin; // Number of linear terms
-						if( nlin > 0 ) {
-							linpart * L = common->L;
-							for(int i = 0; i < nlin; i++ ) {
-								if ((dynamic_cast<const ExprConstant*>(body))&&(((ExprConstant*)(body))->is_zero())) {
-									coeff = (L[i]).fac;
-									index = ((uintptr_t) (L[i].v.rp) - (uintptr_t) VAR_E) / sizeof (expr_v);
-									if (coeff==1) {
-										body = &((*_x)[index]);
-									} else if (coeff==-1) {
-										body = &( - (*_x)[index]);
-									} else if (coeff != 0) {
-										body = &(coeff * (*_x)[index]);
-									}
-								} else {
-									coeff = (L[i]).fac;
-									index = ((uintptr_t) (L[i].v.rp) - (uintptr_t) VAR_E) / sizeof (expr_v);
-									if (coeff==1) {
-										body = &(*body + (*_x)[index]);
-									} else if (coeff==-1) {
-										body = &(*body - (*_x)[index]);
-									} else if (coeff != 0) {
-										body = &(*body +coeff * (*_x)[index]);
-									}
-								}
-							}
-						}
-					}
-					else {
-						cexp1 *common = (CEXPS1 - ncom0) +j ;
-						// init with the nonlinear part
-						body = &(nl2expr(common->e));
-
-						int nlin = common->nlin; // Number of linear terms
-						if( nlin > 0 ) {
-							linpart * L = common->L;
-							for(int i = 0; i < nlin; i++ ) {
-								if ((dynamic_cast<const ExprConstant*>(body))&&(((ExprConstant*)(body))->is_zero())) {
-									coeff = (L[i]).fac;
-									index = ((uintptr_t) (L[i].v.rp) - (uintptr_t) VAR_E) / sizeof (expr_v);
-									if (coeff==1) {
-										body = &( (*_x)[index]);
-									} else if (coeff==-1) {
-										body = &( - (*_x)[index]);
-									} else if (coeff != 0) {
-										body = &(coeff * (*_x)[index]);
-									}
-								} else {
-									coeff = (L[i]).fac;
-									index = ((uintptr_t) (L[i].v.rp) - (uintptr_t) VAR_E) / sizeof (expr_v);
-									if (coeff==1) {
-										body = &(*body + (*_x)[index]);
-									} else if (coeff==-1) {
-										body = &(*body - (*_x)[index]);
-									} else if (coeff != 0) {
-										body = &(*body +coeff * (*_x)[index]);
-									}
-
-								}
-							}
-						}
-					}
-					var_data[k] = body;;
+				for(int i = 0; i < nlin; i++ ) {
+					int index = ((uintptr_t) (L[i].v.rp) - (uintptr_t) VAR_E) / sizeof (expr_v);
+					body = add_lin(body, L[i].fac, index);
 				}
+
+				if (!body) body = &ExprConstant::new_scalar(0.);
+
+				var_data[k] = body;
 				return *body;
 
 			} else {
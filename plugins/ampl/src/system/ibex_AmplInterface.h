@@ -15,6 +15,8 @@
 #include "ibex_SystemFactory.h"
 #include "ibex_Expr.h"
 
+#include <vector>
+
 #ifdef __GNUC__
 #include <ciso646> // just to initialize _LIBCPP_VERSION
 #ifdef _LIBCPP_VERSION
@@ -60,11 +62,22 @@ private:
 #endif // (_MSC_VER >= 1600)
 #endif
 
+	// x_comp[j] is the node x[j], shared by all the expressions
+	std::vector<const ExprNode*> x_comp;
 
 	bool readnl();
 	bool readASLfg();
 	const ExprNode& nl2expr(expr *e);
 
+	// the node x[j]
+	const ExprNode& var(int j);
+
+	// the nonlinear part of an expression (NULL if zero)
+	const ExprNode* nl_part(expr *e);
+
+	// body+coeff*x[j] (or coeff*x[j] if body is NULL)
+	const ExprNode* add_lin(const ExprNode* body, double coeff, int j);
+
 
 public:
 	AmplInterface(std::string nlfile);
@@ -255,4 +255,17 @@ void TestAmpl::variable3() {
 	CPPUNIT_ASSERT(sys.ops[1]==GEQ);
 	CPPUNIT_ASSERT(sys.ops[2]==LEQ);
 }
+
+void TestAmpl::shared() {
+	AmplInterface inter(SRCDIR_TESTS "/../plugins/ampl/tests/ex_ampl/ex6.nl" );
+	System sys(inter);
+	// the common expressions (x(1)+x(2)) and (x(1)+x(2))*(x(1)+x(2))
+	// are not duplicated in f_ctrs
+	int nb_nodes=0;
+	for (int i=0; i<sys.nb_ctr; i++)
+		nb_nodes += sys.ctrs[i].f.nb_nodes();
+	CPPUNIT_ASSERT(sys.f_ctrs.nb_nodes()<nb_nodes);
+	CPPUNIT_ASSERT(sameExpr(sys.f_ctrs[0].expr(),"((x(1)+x(2))*(x(1)+x(2)))"));
+	CPPUNIT_ASSERT(sameExpr(sys.f_ctrs[2].expr(),"(x(1)+x(2))"));
+}
 } // end namespace
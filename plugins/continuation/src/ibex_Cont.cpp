@@ -32,15 +32,17 @@ class ChooseFail : public Exception { };
 
 
 void Cont::add_to_neighbors(ContCell* cell) {
+	vector<ContCell*> cells;
+	grid.intersecting(cell->unicity_box, cells);
+
 	list<ContCell*> neighbors;
 
-	for(IBEX_NEIGHBORHOOD::iterator it=neighborhood.begin(); it!=neighborhood.end(); it++){
-		if(cell->unicity_box.intersects(it->first->unicity_box)) {
-			neighbors.push_back(it->first);
-			it->second.push_back(cell);
-		}
+	for (vector<ContCell*>::iterator it=cells.begin(); it!=cells.end(); it++) {
+		neighbors.push_back(*it);
+		neighborhood[*it].push_back(cell);
 	}
 
+	grid.add(cell);
 	neighborhood.insert(make_pair(cell,neighbors));
 }
 
@@ -81,17 +83,17 @@ Function* Cont::merge(Function &f, Function& g) {
 	return new Function(x,ExprVector::new_col(fg));
 }
 
-Cont::Cont(Function &f, Function &g, double h_min, double alpha, double beta) : dfs(false), full_diff(true), n(f.nb_var()+g.image_dim()), m(f.image_dim()+g.image_dim()), f(*merge(f,g)), g(&g), domain(this->f.nb_var()), h_min(h_min), alpha(alpha), beta(beta) {
+Cont::Cont(Function &f, Function &g, double h_min, double alpha, double beta) : dfs(false), full_diff(true), n(f.nb_var()+g.image_dim()), m(f.image_dim()+g.image_dim()), f(*merge(f,g)), g(&g), domain(this->f.nb_var()), h_min(h_min), alpha(alpha), beta(beta), grid(n) {
 
 	for (int i=0; i<g.image_dim(); i++)
 		domain[f.nb_var()+i] = Interval::NEG_REALS;
 }
 
-Cont::Cont(Function &f, const IntervalVector& domain, double h_min, double alpha, double beta) : dfs(false), full_diff(true), n(f.nb_var()), m(f.image_dim()), f(f), g(NULL), domain(domain), h_min(h_min), alpha(alpha), beta(beta) {
+Cont::Cont(Function &f, const IntervalVector& domain, double h_min, double alpha, double beta) : dfs(false), full_diff(true), n(f.nb_var()), m(f.image_dim()), f(f), g(NULL), domain(domain), h_min(h_min), alpha(alpha), beta(beta), grid(n) {
 
 }
 
-Cont::Cont(Function &f, double h_min, double alpha, double beta) : dfs(false), full_diff(true), n(f.nb_var()), m(f.image_dim()), f(f), g(NULL), domain(f.nb_var(),Interval::ALL_REALS), h_min(h_min), alpha(alpha), beta(beta) {
+Cont::Cont(Function &f, double h_min, double alpha, double beta) : dfs(false), full_diff(true), n(f.nb_var()), m(f.image_dim()), f(f), g(NULL), domain(f.nb_var(),Interval::ALL_REALS), h_min(h_min), alpha(alpha), beta(beta), grid(n) {
 
 }
 
@@ -215,30 +217,42 @@ void Cont::start(IntervalVector x, double h, int kmax) {
 
 void Cont::diff(ContCell* new_cell) {
 
-	// No: we can't erase in l using iterators in neighorhood[new_cell] !
-	//	for (list<ContCell*>::iterator it=neighborhood[new_cell].begin(); it!=neighborhood[new_cell].end(); ) {
+	// Only the neighbors of the new cell can intersect it.
+	// Cells with facets alive are exactly the ones in l.
+	// They are handled first, by order of creation (which is
+	// the order in l).
+	const list<ContCell*>& neighbors=neighborhood[new_cell];
 
-	for (list<ContCell*>::iterator it=l.begin(); it!=l.end(); ) {
+	bool moved=false; // has a cell been moved from l to l_empty_facets?
 
-		if (!full_diff && ((*it)->vars!=new_cell->vars)) {
-			it++;
-			continue;
-		}
+	for (list<ContCell*>::const_iterator it=neighbors.begin(); it!=neighbors.end(); it++) {
+
+		if ((*it)->empty_facets()) continue;
+
+		if (!full_diff && ((*it)->vars!=new_cell->vars)) continue;
 
 		new_cell->diff((*it)->unicity_box,f,(*it)->vars);
 
-		if (!(*it)->empty_facets()) {
-			(*it)->diff(new_cell->unicity_box,f,new_cell->vars);
+		(*it)->diff(new_cell->unicity_box,f,new_cell->vars);
+
+		if ((*it)->empty_facets()) { // move the cell to the list without facets
+			l_empty_facets.push_back(*it);
+			moved=true;
+		}
+	}
 
-			if ((*it)->empty_facets()) { // move the cell to the list without facets
-				l_empty_facets.push_back(*it);
+	if (moved) {
+		for (list<ContCell*>::iterator it=l.begin(); it!=l.end(); ) {
+			if ((*it)->empty_facets())
 				it=l.erase(it); // "it" points to the next element
-			} else it++;
-		} else it++;
+			else
+				it++;
+		}
 	}
 
-	for (list<ContCell*>::iterator it=l_empty_facets.begin(); it!=l_empty_facets.end(); it++) {
-		new_cell->diff((*it)->unicity_box,f,(*it)->vars);
+	for (list<ContCell*>::const_iterator it=neighbors.begin(); it!=neighbors.end(); it++) {
+		if ((*it)->empty_facets())
+			new_cell->diff((*it)->unicity_box,f,(*it)->vars);
 	}
 
 	// Try to remove cells in the solution-find-fail list
@@ -617,7 +631,11 @@ void Cont::move_facet_to_fails(bool choose) {
 }
 
 void Cont::check_no_facet_contains(const IntervalVector& x) {
-	for (list<ContCell*>::iterator it=l.begin(); it!=l.end(); it++) {
+	// facets are inside unicity boxes
+	vector<ContCell*> cells;
+	grid.intersecting(x, cells);
+
+	for (vector<ContCell*>::iterator it=cells.begin(); it!=cells.end(); it++) {
 		(*it)->check_no_facet_contains(x);
 	}
 }
@@ -14,6 +14,7 @@
 #define __IBEX_CONTINUATION_H__
 
 #include "ibex_ContCell.h"
+#include "ibex_ContCellGrid.h"
 
 #include <list>
 #include <set>
@@ -208,6 +209,7 @@ public:
     /**
      * adds a cell to the neighbors structure:
      * maintains existing and new cells neighborhoods
+     * (neighbors are found with the grid)
      */
     void add_to_neighbors(ContCell* cell);
     
@@ -263,6 +265,9 @@ public:
     /** Maps a cell to the list of its neighbors */
 	IBEX_NEIGHBORHOOD neighborhood;
 
+	/** Spatial index of all the cells (by unicity boxes) */
+	ContCellGrid grid;
+
 protected:
 	friend class TestCont;
 
@@ -165,7 +165,7 @@ void ContCell::find_solution_in_facets(Function& f, IntervalVector& x) {
 	}
 }
 
-void ContCell::find_solution_in_facets_not_in(Function& f, IntervalVector& px_sol, list<ContCell*> neighboors) {
+void ContCell::find_solution_in_facets_not_in(Function& f, IntervalVector& px_sol, const list<ContCell*>& neighboors) {
 
 	int n=f.nb_var();
 
@@ -181,7 +181,7 @@ void ContCell::find_solution_in_facets_not_in(Function& f, IntervalVector& px_so
 		//cout << "[find-not-in] facet=" << facet.facet << endl;
 
 		// ============ try to discard the whole subfacet ========================
-		list<ContCell*>::iterator it=neighboors.begin();
+		list<ContCell*>::const_iterator it=neighboors.begin();
 
 		while (it!=neighboors.end() && !(*it)->unicity_box.is_superset(facet.facet)) {
 			it++;
@@ -298,7 +298,7 @@ void ContCell::find_solution_in_facets_not_in(Function& f, IntervalVector& px_so
 		// that this box contain a solution (and it probably doesn't since
 		// it is degenerated), which may result in a "choose fail".
 		for (list<Facet>::iterator itf=facets.begin(); itf!=facets.end(); itf++) {
-			list<ContCell*>::iterator it=neighboors.begin();
+			list<ContCell*>::const_iterator it=neighboors.begin();
 			while (it!=neighboors.end() && !(*it)->unicity_box.intersects(itf->facet)) {
 				it++;
 			}
@@ -99,7 +99,7 @@ public:
 	 * This function also subdivides the facet into subfacets. It is intended to replace
 	 * a call to "diff" followed by "find_solution_facets".
 	 */
-	void find_solution_in_facets_not_in(Function& f, IntervalVector& x, std::list<ContCell*> neighboors);
+	void find_solution_in_facets_not_in(Function& f, IntervalVector& x, const std::list<ContCell*>& neighboors);
 
 	/**
 	 * Watch dog: no cell must contain the solution x
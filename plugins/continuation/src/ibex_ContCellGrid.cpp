@@ -0,0 +1,160 @@
+/* ============================================================================
+ * I B E X - Spatial index of continuation cells
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes and CNRS
+ *
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert, Alexandre Goldsztejn
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_ContCellGrid.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+bool smaller_id(const ContCell* c1, const ContCell* c2) {
+	return c1->id < c2->id;
+}
+
+}
+
+ContCellGrid::ContCellGrid(int n) : n(n), d(n<MAX_DIM? n : MAX_DIM), nb_too_wide(0) {
+
+}
+
+bool ContCellGrid::range(const IntervalVector& box, vector<long>& lb, vector<long>& ub, bool& too_wide) const {
+	too_wide=false;
+	double nb_buckets=1;
+	for (int i=0; i<d; i++) {
+		if (box[i].is_unbounded()) return false;
+		lb[i]=(long) floor((box[i].lb()-origin[i])/step[i]);
+		ub[i]=(long) floor((box[i].ub()-origin[i])/step[i]);
+		nb_buckets*=(double) (ub[i]-lb[i]+1);
+		if (nb_buckets>MAX_BUCKETS) {
+			too_wide=true;
+			return false;
+		}
+	}
+	return true;
+}
+
+unsigned long ContCellGrid::key(const vector<long>& idx) const {
+	unsigned long h=0;
+	for (int i=0; i<d; i++)
+		h = h*1000003UL ^ (unsigned long) idx[i];
+	return h;
+}
+
+void ContCellGrid::store(ContCell* cell) {
+	vector<long> lb(d), ub(d);
+	bool too_wide;
+
+	if (!range(cell->unicity_box,lb,ub,too_wide)) {
+		wide.push_back(cell);
+		if (too_wide) nb_too_wide++;
+		return;
+	}
+
+	// enumerate all the buckets in [lb,ub]
+	vector<long> idx(lb);
+	while (true) {
+		buckets[key(idx)].push_back(cell);
+		int i=0;
+		while (i<d && idx[i]==ub[i]) {
+			idx[i]=lb[i];
+			i++;
+		}
+		if (i==d) break;
+		idx[i]++;
+	}
+}
+
+void ContCellGrid::add(ContCell* cell) {
+	const IntervalVector& box=cell->unicity_box;
+
+	if (step.empty()) {
+		// the step is set by the first cell
+		double max_diam=box.max_diam();
+		if (max_diam<=0 || max_diam==POS_INFINITY) max_diam=1.0;
+
+		step.resize(d);
+		origin.resize(d);
+		for (int i=0; i<d; i++) {
+			double diam=box[i].diam();
+			step[i]=2*((diam>0 && diam<POS_INFINITY)? diam : max_diam);
+			origin[i]=box[i].is_unbounded()? 0 : box[i].lb();
+		}
+	}
+
+	cells.push_back(cell);
+	store(cell);
+
+	if (nb_too_wide>16 && 4*nb_too_wide>(int) cells.size())
+		rebuild(4.0);
+}
+
+void ContCellGrid::rebuild(double factor) {
+	for (int i=0; i<d; i++)
+		step[i]*=factor;
+
+	buckets.clear();
+	wide.clear();
+	nb_too_wide=0;
+
+	for (vector<ContCell*>::const_iterator it=cells.begin(); it!=cells.end(); it++)
+		store(*it);
+}
+
+void ContCellGrid::intersecting(const IntervalVector& box, vector<ContCell*>& res) const {
+	if (cells.empty() || box.is_empty()) return;
+
+	size_t first=res.size();
+
+	vector<long> lb(d), ub(d);
+	bool too_wide;
+
+	if (!range(box,lb,ub,too_wide)) {
+		// the box covers too many buckets: linear scan
+		for (vector<ContCell*>::const_iterator it=cells.begin(); it!=cells.end(); it++)
+			if ((*it)->unicity_box.intersects(box))
+				res.push_back(*it);
+		sort(res.begin()+first, res.end(), smaller_id);
+		return;
+	}
+
+	vector<long> idx(lb);
+	while (true) {
+		IBEX_CELL_BUCKETS::const_iterator b=buckets.find(key(idx));
+		if (b!=buckets.end()) {
+			for (vector<ContCell*>::const_iterator it=b->second.begin(); it!=b->second.end(); it++)
+				if ((*it)->unicity_box.intersects(box))
+					res.push_back(*it);
+		}
+		int i=0;
+		while (i<d && idx[i]==ub[i]) {
+			idx[i]=lb[i];
+			i++;
+		}
+		if (i==d) break;
+		idx[i]++;
+	}
+
+	for (vector<ContCell*>::const_iterator it=wide.begin(); it!=wide.end(); it++)
+		if ((*it)->unicity_box.intersects(box))
+			res.push_back(*it);
+
+	// a cell stored in several buckets appears several times
+	sort(res.begin()+first, res.end(), smaller_id);
+	res.erase(unique(res.begin()+first, res.end()), res.end());
+}
+
+} /* namespace ibex */
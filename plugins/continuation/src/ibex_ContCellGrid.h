@@ -0,0 +1,144 @@
+/* ============================================================================
+ * I B E X - Spatial index of continuation cells
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes and CNRS
+ *
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert, Alexandre Goldsztejn
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_CONT_CELL_GRID_H__
+#define __IBEX_CONT_CELL_GRID_H__
+
+#include "ibex_ContCell.h"
+
+#include <vector>
+
+#ifdef __GNUC__
+#include <ciso646> // just to initialize _LIBCPP_VERSION
+#ifdef _LIBCPP_VERSION
+#include <unordered_map>
+#define IBEX_CELL_BUCKETS std::unordered_map<unsigned long,std::vector<ContCell*> >
+#else
+#include <tr1/unordered_map>
+#define IBEX_CELL_BUCKETS std::tr1::unordered_map<unsigned long,std::vector<ContCell*> >
+#endif
+#else
+#if (_MSC_VER >= 1600)
+#include <unordered_map>
+#define IBEX_CELL_BUCKETS std::unordered_map<unsigned long,std::vector<ContCell*> >
+#else
+#include <unordered_map>
+#define IBEX_CELL_BUCKETS std::tr1::unordered_map<unsigned long,std::vector<ContCell*> >
+#endif // (_MSC_VER >= 1600)
+#endif
+
+namespace ibex {
+
+/**
+ * \brief Uniform grid over the unicity boxes of continuation cells.
+ *
+ * Used by #ibex::Cont to find the cells intersecting a box (the neighbors of
+ * a new cell, the cells that may contain a point) without scanning all the
+ * cells.
+ *
+ * Only the first (at most) #MAX_DIM dimensions are discretized. The grid step is
+ * fixed by the first cell added (twice its width in each dimension). A cell
+ * is stored in every bucket its unicity box overlaps. A cell that overlaps
+ * too many buckets (or is unbounded) is stored in a separate list scanned
+ * linearly. If this list becomes too large (cells much wider than the first
+ * one), the grid is rebuilt with a larger step.
+ */
+class ContCellGrid {
+public:
+	/**
+	 * \brief Build an empty grid for boxes of dimension n.
+	 */
+	ContCellGrid(int n);
+
+	/**
+	 * \brief Add a cell.
+	 *
+	 * The cell is not owned by the grid.
+	 */
+	void add(ContCell* cell);
+
+	/**
+	 * \brief The cells whose unicity box intersects a box.
+	 *
+	 * The cells are pushed at the end of \a cells by increasing id
+	 * (that is, by order of creation).
+	 */
+	void intersecting(const IntervalVector& box, std::vector<ContCell*>& cells) const;
+
+	/**
+	 * \brief Number of cells.
+	 */
+	int size() const;
+
+	/**
+	 * \brief Maximal number of discretized dimensions.
+	 */
+	static const int MAX_DIM = 3;
+
+	/**
+	 * \brief Maximal number of buckets of a cell.
+	 *
+	 * Beyond this number, the cell is considered as "wide".
+	 */
+	static const int MAX_BUCKETS = 64;
+
+protected:
+	/*
+	 * Calculate the range of bucket indices of a box in each discretized
+	 * dimension. Return false if the box is unbounded or spans more than
+	 * MAX_BUCKETS buckets (too_wide is set to true in the latter case).
+	 */
+	bool range(const IntervalVector& box, std::vector<long>& lb, std::vector<long>& ub, bool& too_wide) const;
+
+	/* Hash code of the bucket with indices "idx". */
+	unsigned long key(const std::vector<long>& idx) const;
+
+	/* Store a cell in the buckets (or in the list of wide cells). */
+	void store(ContCell* cell);
+
+	/* Rebuild the grid with a step multiplied by "factor". */
+	void rebuild(double factor);
+
+	/* Dimension of the boxes */
+	const int n;
+
+	/* Number of discretized dimensions */
+	const int d;
+
+	/* Grid step in each discretized dimension (empty until the first cell) */
+	std::vector<double> step;
+
+	/* Origin of the grid */
+	std::vector<double> origin;
+
+	/* The buckets */
+	IBEX_CELL_BUCKETS buckets;
+
+	/* Cells that span too many buckets (or unbounded) */
+	std::vector<ContCell*> wide;
+
+	/* Number of bounded cells in "wide" */
+	int nb_too_wide;
+
+	/* All the cells */
+	std::vector<ContCell*> cells;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline int ContCellGrid::size() const {
+	return (int) cells.size();
+}
+
+} /* namespace ibex */
+
+#endif /* __IBEX_CONT_CELL_GRID_H__ */
@@ -11,6 +11,7 @@
 
 #include "TestCont.h"
 #include "ibex_Cont.h"
+#include "ibex_ContCellGrid.h"
 
 using namespace std;
 
@@ -39,4 +40,51 @@ void TestCont::test01() {
 	delete cell;
 }
 
+void TestCont::grid() {
+	Variable x,y,z;
+	Function f(x,y,z,sqr(x)+sqr(y)+sqr(z)-1);
+	IntervalVector domain(3);
+	VarSet vars(f,z);
+
+	ContCellGrid grid(3);
+	vector<ContCell*> cells;
+
+	// a 10x10 layer of small overlapping cells
+	for (int i=0; i<10; i++)
+		for (int j=0; j<10; j++) {
+			IntervalVector box(3);
+			box[0]=Interval(0.1*i,0.1*i+0.15);
+			box[1]=Interval(0.1*j,0.1*j+0.15);
+			box[2]=Interval(0,0.1);
+			cells.push_back(new ContCell(box,box,domain,vars));
+		}
+	// a wide cell
+	cells.push_back(new ContCell(IntervalVector(3,Interval(-1,2)),IntervalVector(3,Interval(-1,2)),domain,vars));
+
+	for (unsigned int i=0; i<cells.size(); i++)
+		grid.add(cells[i]);
+
+	CPPUNIT_ASSERT(grid.size()==(int) cells.size());
+
+	double _q1[][2]={{0.32,0.41},{0.55,0.55},{0.05,0.05}};
+	double _q2[][2]={{-0.5,-0.4},{0,1},{0,1}};
+	double _q3[][2]={{0,1},{0,1},{0,1}};
+	IntervalVector q[3] = { IntervalVector(3,_q1), IntervalVector(3,_q2), IntervalVector(3,_q3) };
+
+	for (int k=0; k<3; k++) {
+		vector<ContCell*> res;
+		grid.intersecting(q[k],res);
+
+		// compare with a linear scan
+		vector<ContCell*> expected;
+		for (unsigned int i=0; i<cells.size(); i++)
+			if (cells[i]->unicity_box.intersects(q[k])) expected.push_back(cells[i]);
+
+		CPPUNIT_ASSERT(res==expected);
+	}
+
+	for (unsigned int i=0; i<cells.size(); i++)
+		delete cells[i];
+}
+
 } // end namespace
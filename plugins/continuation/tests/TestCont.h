@@ -24,9 +24,11 @@ public:
 
 	CPPUNIT_TEST_SUITE(TestCont);
 	CPPUNIT_TEST(test01);
+	CPPUNIT_TEST(grid);
 	CPPUNIT_TEST_SUITE_END();
 
 	void test01();
+	void grid();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestCont);
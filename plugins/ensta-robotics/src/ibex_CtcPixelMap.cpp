@@ -13,11 +13,13 @@ namespace ibex {
 
 CtcPixelMap::CtcPixelMap(PixelMap &data): Ctc(data.ndim), I(data) {
     pixel_coords = new int[2*I.ndim];
+    tmp_coords = new int[2*I.ndim];
 }
 
 //-------------------------------------------------------------------------------------------------------------
 CtcPixelMap::~CtcPixelMap() {
     delete[] pixel_coords;
+    delete[] tmp_coords;
 }
 
 
@@ -57,11 +59,7 @@ void CtcPixelMap::contract(IntervalVector& box) {
     world_to_grid(box);
 
     // Contractor the box
-    if( I.ndim == 2) {
-        contract(pixel_coords[0],pixel_coords[1],pixel_coords[2],pixel_coords[3]);
-    } else if ( I.ndim == 3){
-        contract(pixel_coords[0],pixel_coords[1],pixel_coords[2],pixel_coords[3],pixel_coords[4],pixel_coords[5]);        
-    }
+    contract_pixels();
     // Check the result
     if(pixel_coords[0] == -1) {
         box.set_empty();
@@ -74,119 +72,62 @@ void CtcPixelMap::contract(IntervalVector& box) {
 
 //------------------------------------------------------------------------------
 //psi contraction
-void CtcPixelMap::contract(int& cxmin, int& cxmax, int& cymin, int& cymax) {
+void CtcPixelMap::contract_pixels() {
 
-    //compute enclosed pixels on consecutive lines from all dimensions of the box
+    int* c = pixel_coords;
 
-    cxmax = std::max(0,std::min(I.grid_size_[0]-1,cxmax));
-    cxmin = std::min(I.grid_size_[0]-1,std::max(0,cxmin));
-    cymax = std::max(0,std::min(I.grid_size_[1]-1,cymax));
-    cymin = std::min(I.grid_size_[1]-1,std::max(0,cymin));
+    for (unsigned int d = 0; d < I.ndim; d++) {
+        c[2*d+1] = std::max(0,std::min(I.grid_size_[d]-1,c[2*d+1]));
+        c[2*d]   = std::min(I.grid_size_[d]-1,std::max(0,c[2*d]));
+    }
 
-    if (enclosed_pixels(cxmin,cxmax,cymin,cymax) == 0){
-        cxmin = -1;
+    if (!is_occupied(c)) {
+        c[0] = -1;
         return;
     }
 
-    //right
-    for (int i = cxmin; i <= cxmax; i++)
-    {
-        if(enclosed_pixels(cxmin,i,cymin,cymax)>0) {
-            cxmin = i;
-            break;
-        }
-    }
-    //left
-    for (int i = cxmax; i >= cxmin ; i--)
-    {
-        if(enclosed_pixels(i,cxmax,cymin,cymax)>0) {
-            cxmax = i;
-            break;
-        }
-    }
-    //down
-    for (int j = cymin; j <=cymax; j++)
-    {
-        if(enclosed_pixels(cxmin,cxmax,cymin,j)>0) {
-            cymin = j;
-            break;
-        }
-    }
-    //up
-    for (int j = cymax; j >= cymin ; j--)
-    {
-        if(enclosed_pixels(cxmin,cxmax,j,cymax)>0) {
-            cymax = j;
-            break;
-        }
-    }
-}
-//////////////////////////////////////////////////////////////////////
+    for (unsigned int d = 0; d < I.ndim; d++) {
+        for (unsigned int i = 0; i < 2*I.ndim; i++) tmp_coords[i] = c[i];
 
-void CtcPixelMap::contract(int& cxmin, int& cxmax, int& cymin,int& cymax, int& czmin, int& czmax) {
+        // lower face: the first i such that [cmin, i] is occupied
+        c[2*d] = first_occupied(c[2*d], c[2*d+1], 2*d+1, 1);
+        tmp_coords[2*d] = c[2*d];
+        tmp_coords[2*d+1] = c[2*d+1];
 
-    cxmax = std::max(0,std::min(I.grid_size_[0]-1,cxmax));
-    cxmin = std::min(I.grid_size_[0]-1,std::max(0,cxmin));
-    cymax = std::max(0,std::min(I.grid_size_[1]-1,cymax));
-    cymin = std::min(I.grid_size_[1]-1,std::max(0,cymin));
-    czmax = std::max(0, std::min(I.grid_size_[2]-1,czmax));
-    czmin = std::min(I.grid_size_[2]-1, std::max(0,czmin));
-    
-    if (enclosed_pixels(cxmin,cxmax,cymin,cymax,czmin,czmax) == 0) {
-        cxmin = -1;
-        return;
+        // upper face: the last i such that [i, cmax] is occupied
+        c[2*d+1] = first_occupied(c[2*d+1], c[2*d], 2*d, -1);
     }
+}
 
-    //right
-    for (int i = cxmin; i <= cxmax; i++)
-    {
-        if(enclosed_pixels(cxmin,i,cymin,cymax,czmin,czmax)>0) {
-            cxmin = i;
-            break;
-        }
-    }
-    //left
-    for (int i = cxmax; i >= cxmin ; i--)
-    {
-        if(enclosed_pixels(i,cxmax,cymin,cymax,czmin,czmax)>0) {
-            cxmax = i;
-            break;
-        }
-    }
-    //down
-    for (int j = cymin; j <=cymax; j++)
-    {
-        if(enclosed_pixels(cxmin,cxmax,cymin,j,czmin,czmax)>0) {
-            cymin = j;
-            break;
-        }
-    }
-    //up
-    for (int j = cymax; j >= cymin ; j--)
-    {
-        int res = enclosed_pixels(cxmin,cxmax,j,cymax,czmin,czmax);
-        if(res>0) {
-            cymax = j;
-            break;
-        }
-    }
-    //bottom
-    for (int k = czmin; k <=czmax; k++)
-    {
-        if(enclosed_pixels(cxmin,cxmax,cymin,cymax,czmin,k)>0) {
-            czmin = k;
-            break;
-        }
-    }
-    //top
-    for (int k = czmax; k >= czmin ; k--)
-    {
-        int res = enclosed_pixels(cxmin,cxmax,cymin,cymax,k,czmax);
-        if(res>0) {
-            czmax = k;
-            break;
-        }
-    }
+int CtcPixelMap::first_occupied(int from, int to, int face, int dir) {
+    // galloping: the tested slab is doubled until it is occupied...
+    int last_free = from - dir;
+    int step = 1;
+    int i = from;
+    for (;;) {
+        if (dir*(i-to) > 0) i = to;
+        tmp_coords[face] = i;
+        if (is_occupied(tmp_coords)) break;
+        last_free = i;
+        i += dir*step;
+        step *= 2;
+    }
+    // ... then a binary search between the last free slab and the occupied one
+    int lo = last_free + dir, hi = i; // the answer is in [lo,hi] (in the direction dir)
+    while (lo != hi) {
+        int mid = lo + dir*(dir*(hi-lo)/2);
+        tmp_coords[face] = mid;
+        if (is_occupied(tmp_coords)) hi = mid;
+        else lo = mid + dir;
+    }
+    return lo;
+}
+
+bool CtcPixelMap::is_occupied(const int* c) {
+    if (I.ndim == 2)
+        return enclosed_pixels(c[0],c[1],c[2],c[3]) > 0;
+    else
+        return enclosed_pixels(c[0],c[1],c[2],c[3],c[4],c[5]) > 0;
 }
 
 unsigned int CtcPixelMap::enclosed_pixels(int xmin,int xmax,int ymin,int ymax) {
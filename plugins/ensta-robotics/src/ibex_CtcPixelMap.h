@@ -26,6 +26,11 @@ namespace ibex {
  *  This class implement the image contractor based on Integral Image or
  *  Summed table area. See Yan Sliwka thesis for more details.
  *
+ *  The integral image is used at a single resolution: counting the pixels
+ *  of any box costs 4 reads (8 in 3D). Each face of the box is moved by a
+ *  galloping search, so the number of reads grows with the logarithm of
+ *  the distance the face moves, not with the distance itself.
+ *
  */
 
 class CtcPixelMap : public Ctc {
@@ -84,14 +89,34 @@ private:
     void grid_to_world(IntervalVector& box);
 
     /**
-     * \brief contract the box defined by [cxmin, cxmax]x[cymin, cymax] w.r.t the integral image.
+     * \brief contract the box of pixels stored in pixel_coords w.r.t the integral image.
+     *
+     * Each face of the box is moved to the first line (plane) of pixels that
+     * contains an occupied pixel. The number of enclosed pixels being
+     * monotonous, this line is found by a galloping search. The first
+     * coordinate is set to -1 if the box is free.
+     */
+    void contract_pixels();
+
+    /**
+     * \brief Move a face of the box of pixels tmp_coords.
+     *
+     * Return the first coordinate i from "from" to "to" (in the direction dir=1 or -1)
+     * such that tmp_coords is occupied when its bound "face" (index in tmp_coords) is
+     * set to i. The coordinate is found by a galloping search (steps 1, 2, 4, ...)
+     * followed by a binary search. Assumes that the box is occupied for i=to.
+     */
+    int first_occupied(int from, int to, int face, int dir);
+
+    /**
+     * \brief True iff the box of pixels c (same format as pixel_coords) contains an occupied pixel.
      */
-    void contract(int &cxmin, int &cxmax, int &cymin, int &cymax);
+    bool is_occupied(const int* c);
 
     /**
-     * \brief contract the box defined by [cxmin, cxmax]x[cymin, cymax]x[zmin, zmax] w.r.t the integral image.
+     * \brief Temporary box of pixels.
      */
-    void contract(int &cxmin, int &cxmax, int &cymin, int &cymax, int &czmin, int &czmax);
+    int *tmp_coords;
     
     /**
      * \brief Return the number of 1-valued pixels in the box [xmin,xmax] x [ymin, ymax].
@@ -18,27 +18,35 @@
 #include <cstring>
 #include <assert.h>
 #include <sstream>
+#include <cfenv>
+#include <cstdio>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 using namespace std;
 
 namespace ibex {
 
 
-const char* PixelMap::FORMAT_VERSION="1.0.0";
+const char* PixelMap::FORMAT_VERSION="1.1.0";
 const char* PixelMap::FF_DATA_IMAGE_ND="DATA_IMD_ND";
 
-PixelMap::PixelMap(unsigned int ndim) : ndim(ndim), zero(0) {
+PixelMap::PixelMap(unsigned int ndim) : ndim(ndim), pixels(NULL), nb_pixels(0), zero(0), mapped_(NULL), mapped_size_(0) {
 	leaf_size_ = new double[ndim];
 	origin_ = new double[ndim];
 	grid_size_ = new int[ndim];
-	divb_mul_ = new int[ndim];
+	divb_mul_ = new size_t[ndim];
 }
 
-PixelMap::PixelMap(const PixelMap& src): ndim(src.ndim), zero(0) {
+PixelMap::PixelMap(const PixelMap& src): ndim(src.ndim), pixels(NULL), nb_pixels(0), zero(0), mapped_(NULL), mapped_size_(0) {
 	leaf_size_ = new double[ndim];
 	origin_ = new double[ndim];
 	grid_size_ = new int[ndim];
-	divb_mul_ = new int[ndim];
+	divb_mul_ = new size_t[ndim];
 	for(unsigned int i = 0; i < ndim; i++){
 		leaf_size_[i] = src.leaf_size_[i];
 		origin_[i] = src.origin_[i];
@@ -46,12 +54,13 @@ PixelMap::PixelMap(const PixelMap& src): ndim(src.ndim), zero(0) {
 	}
 	init();
 
-	// copy image data
-	data = src.data;
+	// copy image data (the copy of a mapped image is in memory)
+	std::copy(src.pixels, src.pixels+nb_pixels, data.begin());
 
 }
 
 PixelMap::~PixelMap() {
+	unmap();
 	delete[] leaf_size_;
 	delete[] origin_;
 	delete[] grid_size_;
@@ -60,13 +69,22 @@ PixelMap::~PixelMap() {
 
 void PixelMap::init() {
 
-	int size = grid_size_[0];
+	init_offsets();
+	unmap();
+	data.resize(nb_pixels);
+	std::fill(data.begin(),data.end(),0);
+	pixels = &data[0];
+}
+
+void PixelMap::init_offsets() {
+
+	// in size_t: a mapped file may have more than 2^32 pixels
+	size_t size = grid_size_[0];
 	for(unsigned int i=1; i<ndim; i++){
 		size*=grid_size_[i];
 	} 
 	assert(size > 0);
-	data.resize(size);
-	std::fill(data.begin(),data.end(),0);
+	nb_pixels = size;
 	// Compute offsets
 	divb_mul_[0] = 1;
 	for(unsigned int i=1; i<ndim; i++) {
@@ -85,25 +103,36 @@ void PixelMap::save(const char *filename) {
 		ibex_error(s.str().c_str());
 	}
 
+	save(out_file);
+
+	out_file.close();
+}
+
+void PixelMap::save(ofstream& out_file) {
 	try {
         write_header(out_file, *this);
 		// write data
-		out_file.write((char*)&data[0],data.size()*sizeof(DATA_TYPE));
+		out_file.write((char*)pixels,nb_pixels*sizeof(DATA_TYPE));
 	} catch (std::exception& e) {
 		std::stringstream s;
 		s << "PixelMap [save]: writing error " << e.what() << std::endl;
 		ibex_error(s.str().c_str());
 	}
-
-	out_file.close();
 }
 
 // read header
-void PixelMap::read_header(ifstream &in_file, PixelMap& output) {
+std::streamoff PixelMap::read_header(ifstream &in_file, PixelMap& output, std::string* version) {
+
+	std::streamoff start = in_file.tellg();
+	std::streamoff data_offset = -1;
 
 	std::string line;
 	bool leaf_size_is_set = false, origin_is_set = false, grid_size_is_set  = false;
 
+	// the header is parsed with rounding to nearest (see write_header)
+	int rounding = fegetround();
+	fesetround(FE_TONEAREST);
+
 	// Read the header and fill it in with wonderful values
 	while (!in_file.eof()) {
 
@@ -122,9 +151,11 @@ void PixelMap::read_header(ifstream &in_file, PixelMap& output) {
 		if (line_type.substr(0, 1) == "#")
 			continue;
 
-		// Version numbers are not needed for now, but we are checking to see if they're there
-		if (line_type.substr(0, 7) == "VERSION")
+		// The version number is only needed by map()
+		if (line_type.substr(0, 7) == "VERSION") {
+			if (version) sstream >> *version;
 			continue;
+		}
 
 		// Get the file format tag
 		if (line_type.substr(0, 4) == "TYPE") {
@@ -181,13 +212,23 @@ void PixelMap::read_header(ifstream &in_file, PixelMap& output) {
 			grid_size_is_set = true;
 			continue;
 		}
+		// Position of the data w.r.t. the beginning of the header
+		// (if missing, the data follows the header)
+		if (line_type.substr (0, 11) == "DATA_OFFSET") {
+			sstream >> data_offset;
+			continue;
+		}
+
 		if (line_type.substr(0,10) == "END_HEADER")
 			break;
 
 	}
 
+	fesetround(rounding);
+
 	if(leaf_size_is_set && grid_size_is_set && origin_is_set) {
-		output.init();
+		output.init_offsets();
+		return data_offset==-1? (std::streamoff) in_file.tellg() : start + data_offset;
 	} else {
 		std::stringstream s;
 		s << "PixelMap [read_header]: field ";
@@ -197,6 +238,7 @@ void PixelMap::read_header(ifstream &in_file, PixelMap& output) {
 		s << "is missing\n";
 
 		ibex_error(s.str().c_str());
+		return -1;
 	}
 }
 
@@ -211,33 +253,57 @@ void PixelMap::load(const char *filename) {
 
     }
 
-	try {
-        read_header(in_file, *this);
-		for(unsigned int i = 0; i < data.size(); i++) {
-			DATA_TYPE tmp = 0;
-			in_file.read((char*)&tmp,sizeof(DATA_TYPE));
-			this->data[i] = tmp;
+	load(in_file);
 
-		}
+	in_file.close();
+	//    std::cerr  << " read " << output.data.size() << " cubes\n";
+}
+
+void PixelMap::load(ifstream& in_file) {
+	try {
+        std::streamoff pos = read_header(in_file, *this);
+        init();
+        in_file.seekg(pos);
+		in_file.read((char*)pixels,nb_pixels*sizeof(DATA_TYPE));
+		if (in_file.fail())
+			ibex_error("PixelMap [load]: unexpected end of file");
 	} catch (std::exception& e) {
 		std::stringstream s;
 		s << "PixelMap [load]: reading error " << e.what() << std::endl;
 		ibex_error(s.str().c_str());
 	}
-	in_file.close();
-	//    std::cerr  << " read " << output.data.size() << " cubes\n";
 }
 
 void PixelMap::write_header(ofstream& out_file, const PixelMap& input) {
 	std::ostringstream oss;
 	oss.imbue (std::locale::classic ());
 
+	// The interval library sets the rounding mode upward: the
+	// conversion of doubles into decimals would not be reversible.
+	int rounding = fegetround();
+	fesetround(FE_TONEAREST);
+	oss.precision(17);
+
 	oss << "VERSION " << FORMAT_VERSION;
 	oss << "\nTYPE " << FF_DATA_IMAGE_ND << " " << ndim << " " << sizeof(DATA_TYPE);
 	oss << "\nLEAF_SIZE"; for(unsigned int i =0; i < ndim;  i++) oss << " " << input.leaf_size_[i];
 	oss << "\nORIGIN";    for(unsigned int i =0; i < ndim;  i++) oss << " " << input.origin_[i];
 	oss << "\nGRID_SIZE"; for(unsigned int i =0; i < ndim;  i++) oss << " " << input.grid_size_[i];
-	oss << "\nEND_HEADER\n";
+
+	fesetround(rounding);
+
+	// The data is aligned on 64 bytes w.r.t. the beginning of the header
+	// (so that the file can be mapped, see map()).
+	const char* end = "\nEND_HEADER\n";
+	const int offset_width = 10;
+	size_t header_size = oss.str().size() + strlen("\nDATA_OFFSET ") + offset_width + strlen(end);
+	size_t data_offset = ((header_size+63)/64)*64;
+
+	char offset_str[offset_width+1];
+	sprintf(offset_str, "%010lu", (unsigned long) data_offset);
+	oss << "\nDATA_OFFSET " << offset_str << end;
+	oss << std::string(data_offset - header_size, '\n');
+
 	try {
 		out_file << oss.str();
 	} catch (std::exception& e) {
@@ -245,6 +311,69 @@ void PixelMap::write_header(ofstream& out_file, const PixelMap& input) {
 	}
 }
 
+void PixelMap::map(const char* filename) {
+#ifndef _WIN32
+	std::ifstream in_file;
+	in_file.open(filename, ios::in | ios::binary);
+	if(in_file.fail()) {
+		std::stringstream s;
+		s << "PixelMap [map]: cannot open file " << filename << " for reading data";
+		ibex_error(s.str().c_str());
+	}
+	std::string version;
+	std::streamoff pos = read_header(in_file, *this, &version);
+	in_file.close();
+
+	// only the current format guarantees that the data is aligned
+	if (version != FORMAT_VERSION || pos % sizeof(DATA_TYPE) != 0) {
+		std::stringstream s;
+		s << "PixelMap [map]: the format of " << filename << " (version " << version << ") cannot be mapped: load and save it again";
+		ibex_error(s.str().c_str());
+	}
+
+	int fd = open(filename, O_RDONLY);
+	struct stat st;
+	if (fd == -1 || fstat(fd, &st) == -1 || (size_t) st.st_size < pos + nb_pixels*sizeof(DATA_TYPE)) {
+		if (fd != -1) close(fd);
+		std::stringstream s;
+		s << "PixelMap [map]: cannot map file " << filename << " (truncated file?)";
+		ibex_error(s.str().c_str());
+	}
+
+	// private mapping: the file is never modified
+	void* addr = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+	close(fd);
+
+	if (addr == MAP_FAILED) {
+		std::stringstream s;
+		s << "PixelMap [map]: cannot map file " << filename << " (" << strerror(errno) << ")";
+		ibex_error(s.str().c_str());
+	}
+
+	// the pixels are accessed randomly by CtcPixelMap
+	madvise(addr, st.st_size, MADV_RANDOM);
+
+	unmap();
+	std::vector<DATA_TYPE>().swap(data);
+	mapped_ = addr;
+	mapped_size_ = st.st_size;
+	pixels = (DATA_TYPE*) ((char*) addr + pos);
+#else
+	load(filename);
+#endif
+}
+
+void PixelMap::unmap() {
+#ifndef _WIN32
+	if (mapped_) {
+		munmap(mapped_, mapped_size_);
+		mapped_ = NULL;
+		mapped_size_ = 0;
+		pixels = NULL;
+	}
+#endif
+}
+
 // ==========================================================================================================
 PixelMap2D::PixelMap2D() : PixelMap(2) {
 
@@ -268,22 +397,22 @@ void PixelMap2D::set_grid_size(unsigned int ni, unsigned int nj) {
 
 // [gch]: Benoit, please check this part of the code
 PixelMap::DATA_TYPE& PixelMap2D::operator()(int i, int j) {
-	unsigned int idx = 0;
+	size_t idx = 0;
 	if (i<0 || j<0) return zero;
 
-	idx = divb_mul_[0]*i  + divb_mul_[1]*j;
+	idx = divb_mul_[0]*(size_t) i  + divb_mul_[1]*(size_t) j;
 
-	if(idx >= data.size()) {
-		cout << idx << " " << data.size() << " " << i << " " << j << "\n";
+	if(idx >= nb_pixels) {
+		cout << idx << " " << nb_pixels << " " << i << " " << j << "\n";
 		cout.flush();
 	}
 
-	assert(idx < data.size());
-	return data.at(idx);
+	assert(idx < nb_pixels);
+	return pixels[idx];
 }
 
 void PixelMap2D::compute_integral_image() {
-	assert(data.size()>0);
+	assert(nb_pixels>0);
 
 	for(int i=0; i<grid_size_[0]; i++) {
 		for(int j=0; j<grid_size_[1]; j++) {
@@ -320,17 +449,17 @@ void PixelMap3D::set_grid_size(unsigned int ni, unsigned int nj, unsigned int nk
 
 // [gch]: Benoit, please check this part of the code
 PixelMap::DATA_TYPE& PixelMap3D::operator()(int i, int j, int k) {
-	unsigned int idx = 0;
+	size_t idx = 0;
 	if (i<0 || j<0 || k<0) return zero;
 
-	idx = divb_mul_[0]*i  + divb_mul_[1]*j + divb_mul_[2]*k;
+	idx = divb_mul_[0]*(size_t) i  + divb_mul_[1]*(size_t) j + divb_mul_[2]*(size_t) k;
 
-	assert(idx < data.size());
-	return data.at(idx);
+	assert(idx < nb_pixels);
+	return pixels[idx];
 }
 
 void PixelMap3D::compute_integral_image() {
-	assert(data.size()>0);
+	assert(nb_pixels>0);
 
 	for(int i=0; i<grid_size_[0]; i++) {
 		for(int j=0; j<grid_size_[1]; j++) {
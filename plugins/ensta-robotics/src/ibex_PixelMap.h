@@ -12,6 +12,8 @@
 
 #include <fstream>
 #include <vector>
+#include <cassert>
+#include <cstddef>
 
 namespace ibex {
 
@@ -26,6 +28,8 @@ namespace ibex {
  *	- the origin (origin_)
  * 	- the number of cells (grid_size_)
  *
+ * The data can either be loaded in memory (see #load(const char*)) or
+ * mapped from a file (see #map(const char*)).
  */
 class PixelMap {
 public:
@@ -60,6 +64,37 @@ public:
 	 */
     void load(const char* filename);
 
+	/**
+	 * \brief Map a file given by filename in memory instead of loading it.
+	 *
+	 * The data is not read at once: the pages of the file are read on demand
+	 * and shared with the other processes mapping the same file (page cache).
+	 * The file is not modified: a pixel written after mapping is only changed
+	 * in this PixelMap (copy on write).
+	 *
+	 * The file must have been saved by #save(const char*) with the current
+	 * format version (where the data is aligned). To contract with #CtcPixelMap,
+	 * the file must contain the integral image.
+	 *
+	 * \note Under Windows, the file is loaded.
+	 */
+    void map(const char* filename);
+
+	/**
+	 * \brief True iff the data is mapped from a file (see #map(const char*)).
+	 */
+    bool is_mapped() const;
+
+	/**
+	 * \brief Write the PixelMap (header and data) at the current position of a stream.
+	 */
+    void save(std::ofstream& out_file);
+
+	/**
+	 * \brief Read the PixelMap (header and data) from the current position of a stream.
+	 */
+    void load(std::ifstream& in_file);
+
 	/**
 	 * \brief Compute the integral image.
 	 *
@@ -87,15 +122,21 @@ protected:
 	/**
 	 * \brief return the value of the element idx in the array data
 	 */
-    DATA_TYPE& operator[](int idx);
+    DATA_TYPE& operator[](size_t idx);
 
-    /** \brief Vector storing data. */
+    /** \brief Vector storing data (empty if the data is mapped). */
     std::vector<DATA_TYPE> data;
 
+    /** \brief The pixels (either the vector data or the mapped file). */
+    DATA_TYPE* pixels;
+
+    /** \brief Number of pixels (may exceed 2^32 for a mapped file). */
+    size_t nb_pixels;
+
     /** \brief The division multiplier.
      *
      * Offsets described by divb_mul_ are used to select element. */
-    int *divb_mul_;
+    size_t *divb_mul_;
 
     /**
      *	\brief internal zero value returned when a pixel is acceded with negatif indice.
@@ -108,6 +149,11 @@ protected:
 	 *		field <leaf_size_> needs to be setted before.
 	 */
 	void init();
+
+	/**
+	 *	\brief Compute the number of pixels and the offsets (without allocating the data).
+	 */
+	void init_offsets();
 	
 	/**
 	 * \brief After setting parameters of the PixelMap( grid_size, leaf_size and origin)
@@ -123,14 +169,25 @@ private:
 	/*
 	 * Read the header from a file.
 	 *  (used by load)
+	 * Return the position of the data in the file.
+	 * The format version is stored in "version" (if not NULL).
 	 */
-    void read_header(std::ifstream& in_file, PixelMap& output);
+    std::streamoff read_header(std::ifstream& in_file, PixelMap& output, std::string* version=NULL);
 
     /*
      * Write the header in a file.
 	 *  (used by save)
 	 */
     void write_header(std::ofstream& out_file, const PixelMap& input);
+
+    /*
+     * Release the mapped file (if any).
+     */
+    void unmap();
+
+    /* Mapped file and size (NULL if not mapped) */
+    void* mapped_;
+    size_t mapped_size_;
 };
 
 /**
@@ -176,8 +233,13 @@ public:
 
 /*================================== inline implementations ========================================*/
 
-inline PixelMap::DATA_TYPE& PixelMap::operator[](int idx) {
-	return data.at(idx);
+inline PixelMap::DATA_TYPE& PixelMap::operator[](size_t idx) {
+	assert(idx < nb_pixels);
+	return pixels[idx];
+}
+
+inline bool PixelMap::is_mapped() const {
+	return mapped_ != NULL;
 }
 
 } // namespace ibex
@@ -179,6 +179,131 @@ void TestCtcPixelMap::test2d_corner(){
     CPPUNIT_ASSERT_DOUBLES_EQUAL(1.55,v1[1].ub(),ERROR);
 }
 
+// -------------------------------------------------------------------------------------
+// ---------------------- Random boxes vs. brute force ----------------------------------
+// -------------------------------------------------------------------------------------
+
+namespace {
+
+// pseudo-random integer in [0,n)
+int rand_int(unsigned int& seed, int n) {
+    seed = seed*1103515245+12345;
+    return (seed/65536) % n;
+}
+
+// A random box of unit pixels with non-integer bounds in [0,size[i]]
+IntervalVector rand_box(unsigned int& seed, int ndim, const int* size) {
+    IntervalVector box(ndim);
+    for (int i = 0; i < ndim; i++) {
+        double a = rand_int(seed,4*size[i])/4.0 + 0.125;
+        double b = rand_int(seed,4*size[i])/4.0 + 0.125;
+        box[i] = Interval(std::min(a,b),std::max(a,b));
+    }
+    return box;
+}
+
+}
+
+void TestCtcPixelMap::test2d_random(){
+    const int n = 100;
+    PixelMap2D raster;
+    raster.set_leaf_size(1,1);
+    raster.set_origin(0,0);
+    raster.set_grid_size(n,n-13);
+    int size[] = {n,n-13};
+
+    unsigned int seed = 1;
+    // a few clusters of occupied pixels
+    for (int c = 0; c < 5; c++) {
+        int x = rand_int(seed,n), y = rand_int(seed,n-13);
+        for (int p = 0; p < 20; p++)
+            raster(std::min(n-1,x+rand_int(seed,5)), std::min(n-14,y+rand_int(seed,5))) = 1;
+    }
+
+    // brute force contraction (computed before the integral image)
+    std::vector<IntervalVector> boxes, res;
+    for (int k = 0; k < 200; k++) {
+        IntervalVector box = rand_box(seed,2,size);
+        IntervalVector hull(2,Interval::EMPTY_SET);
+        for (int i = 0; i < n; i++)
+            for (int j = 0; j < n-13; j++)
+                if (raster(i,j) && box[0].lb() < i+1 && box[0].ub() > i && box[1].lb() < j+1 && box[1].ub() > j) {
+                    IntervalVector pixel(2);
+                    pixel[0] = Interval(i,i+1);
+                    pixel[1] = Interval(j,j+1);
+                    hull |= pixel;
+                }
+        boxes.push_back(box);
+        res.push_back(hull.is_empty()? hull : box & hull);
+    }
+
+    raster.compute_integral_image();
+    CtcPixelMap ctc(raster);
+
+    for (unsigned int k = 0; k < boxes.size(); k++) {
+        IntervalVector box(boxes[k]);
+        ctc.contract(box);
+        CPPUNIT_ASSERT(box == res[k]);
+    }
+}
+
+void TestCtcPixelMap::test3d_random(){
+    const int n = 30;
+    PixelMap3D raster;
+    raster.set_leaf_size(1,1,1);
+    raster.set_origin(0,0,0);
+    raster.set_grid_size(n,n+3,n-5);
+    int size[] = {n,n+3,n-5};
+
+    unsigned int seed = 2;
+    std::vector<int> pixels;
+    for (int p = 0; p < 40; p++) {
+        int i = rand_int(seed,n), j = rand_int(seed,n+3), l = rand_int(seed,n-5);
+        raster(i,j,l) = 1;
+        pixels.push_back(i); pixels.push_back(j); pixels.push_back(l);
+    }
+    raster.compute_integral_image();
+
+    CtcPixelMap ctc(raster);
+
+    for (int k = 0; k < 200; k++) {
+        IntervalVector box = rand_box(seed,3,size);
+
+        // brute force contraction
+        IntervalVector hull(3,Interval::EMPTY_SET);
+        for (unsigned int p = 0; p < pixels.size(); p += 3) {
+            IntervalVector pixel(3);
+            for (int i = 0; i < 3; i++) pixel[i] = Interval(pixels[p+i],pixels[p+i]+1);
+            if (box[0].lb() < pixel[0].ub() && box[0].ub() > pixel[0].lb()
+                    && box[1].lb() < pixel[1].ub() && box[1].ub() > pixel[1].lb()
+                    && box[2].lb() < pixel[2].ub() && box[2].ub() > pixel[2].lb())
+                hull |= pixel;
+        }
+        IntervalVector res = hull.is_empty()? hull : box & hull;
+
+        ctc.contract(box);
+        CPPUNIT_ASSERT(box == res);
+    }
+}
+
+void TestCtcPixelMap::test3d_mapped(){
+    PixelMap3D raster;
+    initRaster3D(raster);
+    raster.save("test.integral3D");
+
+    PixelMap3D mapped;
+    mapped.map("test.integral3D");
+    CtcPixelMap ctc(mapped);
+    IntervalVector v1(3,Interval::ALL_REALS);
+    ctc.contract(v1);
+
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(-1,v1[0].lb(),ERROR);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(-0.9,v1[0].ub() ,ERROR);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.5,v1[1].lb(),ERROR);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.6,v1[1].ub(),ERROR);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.4,v1[2].lb(),ERROR);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.45,v1[2].ub(),ERROR);
+}
 
 //void TestCtcPixelMap::add_cross(int3 center, int length, Array2d &I){
 //    for(int  i = -length ; i <= length; i++){
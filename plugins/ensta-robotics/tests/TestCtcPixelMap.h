@@ -21,6 +21,10 @@ public:
     CPPUNIT_TEST(test2d_allReal);
     CPPUNIT_TEST(test2d_fullImage);
     CPPUNIT_TEST(test2d_corner);
+
+    CPPUNIT_TEST(test2d_random);
+    CPPUNIT_TEST(test3d_random);
+    CPPUNIT_TEST(test3d_mapped);
 	CPPUNIT_TEST_SUITE_END();
 
 protected:
@@ -38,6 +42,10 @@ private:
     void test2d_allReal();
     void test2d_fullImage();
     void test2d_corner();
+
+    void test2d_random();
+    void test3d_random();
+    void test3d_mapped();
     
 };
 
@@ -142,6 +142,54 @@ void TestPixelMap::test_ImageIntegral2D(){
     raster.compute_integral_image();
 }
 
+void TestPixelMap::test_mapPixelMap(){
+    PixelMap3D raster;
+    double leaf_size[] = {0.1,0.3,0.5};
+    double origin[] = {0,2,-1.632};
+    int grid_size[] = {10,20,30};
+
+    raster.set_origin(origin[0],origin[1],origin[2]);
+    raster.set_leaf_size(leaf_size[0],leaf_size[1],leaf_size[2]);
+    raster.set_grid_size(grid_size[0],grid_size[1],grid_size[2]);
+
+    for(unsigned int i = 0; i < raster.data.size(); i++){
+        raster[i] = 3*i+1;
+    }
+    raster.save("test.map3D");
+
+    PixelMap3D mapped;
+    mapped.map("test.map3D");
+    CPPUNIT_ASSERT(mapped.is_mapped());
+    CPPUNIT_ASSERT(mapped.data.empty());
+
+    for(unsigned int i = 0; i < raster.ndim; i++){
+        CPPUNIT_ASSERT( (mapped.leaf_size_[i] == leaf_size[i]) );
+        CPPUNIT_ASSERT( (mapped.origin_[i] == origin[i]) );
+        CPPUNIT_ASSERT( (mapped.grid_size_[i] == grid_size[i]) );
+    }
+
+    for(unsigned int i = 0; i < raster.data.size(); i++){
+        CPPUNIT_ASSERT(mapped[i] == raster[i]);
+    }
+
+    // the file is not modified
+    mapped[0] = 0;
+    PixelMap3D loaded;
+    loaded.load("test.map3D");
+    CPPUNIT_ASSERT(!loaded.is_mapped());
+    CPPUNIT_ASSERT(loaded[0] == 1);
+
+    // a copy of a mapped image is in memory
+    PixelMap3D copy(mapped);
+    CPPUNIT_ASSERT(!copy.is_mapped());
+    CPPUNIT_ASSERT(copy[0] == 0 && copy[1] == raster[1]);
+
+    // loading a mapped image releases the mapping
+    mapped.load("test.map3D");
+    CPPUNIT_ASSERT(!mapped.is_mapped());
+    CPPUNIT_ASSERT(mapped[0] == 1);
+}
+
 
 }
 
@@ -16,6 +16,7 @@ public:
 	CPPUNIT_TEST(test_readWrongFileFormat_1);
 	CPPUNIT_TEST(test_readWrongFileFormat_2);
 	CPPUNIT_TEST(test_ImageIntegral2D);
+	CPPUNIT_TEST(test_mapPixelMap);
 	CPPUNIT_TEST_SUITE_END();
 
     void setup();    
@@ -25,6 +26,7 @@ public:
     void test_readWrongFileFormat_1();
     void test_readWrongFileFormat_2();
     void test_ImageIntegral2D();
+    void test_mapPixelMap();
 
 
 };
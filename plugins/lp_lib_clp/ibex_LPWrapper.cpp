@@ -302,6 +302,25 @@ void LPSolver::clean_ctrs() {
 
 }
 
+void LPSolver::clean_ctrs(int i) {
+
+	assert(i>=nb_vars && i<=nb_rows);
+
+	try {
+		status_prim = 0;
+		status_dual = 0;
+		if (i<=nb_rows-1) {
+			myclp->deleteRows(nb_rows-i,_which+(i-nb_vars));
+		}
+		nb_rows = i;
+		obj_value = POS_INFINITY;
+	}
+	catch(...) {
+		throw LPException();
+	}
+	return ;
+}
+
 void LPSolver::clean_all() {
 	// TODO
 	return ;
@@ -426,3 +445,25 @@ void LPSolver::add_constraint(const ibex::Vector& row, CmpOp sign, double rhs) {
 
 	return ;
 }
+
+void LPSolver::set_constraint(int i, const ibex::Vector& row, CmpOp sign, double rhs) {
+
+	assert(i>=nb_vars && i<nb_rows);
+
+	try {
+		if (sign==LEQ || sign==LT)
+			myclp->setRowBounds(i,NEG_INFINITY,rhs);
+		else if (sign==GEQ || sign==GT)
+			myclp->setRowBounds(i,rhs,POS_INFINITY);
+		else
+			throw LPException();
+
+		for (int j=0; j<nb_vars; j++)
+			myclp->modifyCoefficient(i,j,row[j]);
+	}
+	catch(...) {
+		throw LPException();
+	}
+
+	return ;
+}
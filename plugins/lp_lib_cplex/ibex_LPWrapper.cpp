@@ -462,6 +462,28 @@ void LPSolver::clean_ctrs() {
 	return ;
 
 }
+
+void LPSolver::clean_ctrs(int i) {
+
+	assert(i>=2*nb_vars && i<=nb_rows);
+
+	try {
+		status_prim = -1;
+		status_dual = -1;
+		int status=0;
+		if (i<=nb_rows-1) {
+			status = CPXdelrows (envcplex, lpcplex, i, nb_rows-1);
+		}
+		nb_rows = i;
+		obj_value = POS_INFINITY;
+		if (status) throw LPException();
+
+	} catch (...) {
+		throw LPException();
+	}
+	return ;
+}
+
 void LPSolver::clean_all() {
 // TODO
 }
@@ -642,3 +664,39 @@ void LPSolver::add_constraint(const ibex::Vector& row, CmpOp sign, double rhs) {
 	}
 	return ;
 }
+
+void LPSolver::set_constraint(int i, const ibex::Vector& row, CmpOp sign, double rhs) {
+
+	assert(i>=2*nb_vars && i<nb_rows);
+
+	try {
+		// rows are stored as "<=" constraints (see add_constraint)
+		double pt_rhs;
+		if (sign == LEQ || sign == LT) {
+			pt_rhs = rhs;
+			for (int j = 0; j < nb_vars; j++)
+				r_matval[j] = row[j];
+		} else if (sign == GEQ || sign == GT) {
+			pt_rhs = -rhs;
+			for (int j = 0; j < nb_vars; j++)
+				r_matval[j] = -row[j];
+		} else
+			throw LPException();
+
+		int * rowlist = new int[nb_vars];
+		for (int j = 0; j < nb_vars; j++)
+			rowlist[j] = i;
+
+		int status = CPXchgcoeflist(envcplex, lpcplex, nb_vars, rowlist, r_matind, r_matval);
+		delete[] rowlist;
+
+		if (status==0)
+			status = CPXchgrhs(envcplex, lpcplex, 1, &i, &pt_rhs);
+
+		if (status) throw LPException();
+
+	} catch (...) {
+		throw LPException();
+	}
+	return ;
+}
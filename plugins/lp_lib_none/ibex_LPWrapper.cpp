@@ -50,6 +50,10 @@ void LPSolver::clean_ctrs() {
 	throw LPException();
 }
 
+void LPSolver::clean_ctrs(int i) {
+	throw LPException();
+}
+
 void LPSolver::clean_all() {
 	throw LPException();
 }
@@ -89,3 +93,7 @@ void LPSolver::set_epsilon(double eps) {
 void LPSolver::add_constraint(const Vector& row, CmpOp sign, double rhs) {
 	throw LPException();
 }
+
+void LPSolver::set_constraint(int i, const Vector& row, CmpOp sign, double rhs) {
+	throw LPException();
+}
@@ -229,6 +229,26 @@ void LPSolver::clean_ctrs() {
 	return ;
 
 }
+
+void LPSolver::clean_ctrs(int i) {
+
+	assert(i>=nb_vars && i<=nb_rows);
+
+	try {
+		status_prim = soplex::SPxSolver::UNKNOWN;
+		status_dual = soplex::SPxSolver::UNKNOWN;
+		if (i<=nb_rows-1) {
+			mysoplex->removeRowRange(i, nb_rows-1);
+		}
+		nb_rows = i;
+		obj_value = POS_INFINITY;
+	}
+	catch(...) {
+		throw LPException();
+	}
+	return ;
+}
+
 void LPSolver::clean_all() {
 	// TODO
 	return ;
@@ -359,3 +379,28 @@ void LPSolver::add_constraint(const ibex::Vector& row, CmpOp sign, double rhs) {
 
 	return ;
 }
+
+void LPSolver::set_constraint(int i, const ibex::Vector& row, CmpOp sign, double rhs) {
+
+	assert(i>=nb_vars && i<nb_rows);
+
+	try {
+		soplex::DSVector row1(nb_vars);
+		for (int j=0; j< nb_vars ; j++) {
+			row1.add(j, row[j]);
+		}
+
+		if (sign==LEQ || sign==LT)
+			mysoplex->changeRow(i, soplex::LPRow(-soplex::infinity, row1, rhs));
+		else if (sign==GEQ || sign==GT)
+			mysoplex->changeRow(i, soplex::LPRow(rhs, row1, soplex::infinity));
+		else
+			throw LPException();
+
+	}
+	catch(...) {
+		throw LPException();
+	}
+
+	return ;
+}
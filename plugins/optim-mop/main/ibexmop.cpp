@@ -12,6 +12,8 @@
 #include "ibex.h"
 #include "args.hxx"
 
+#include <fstream>
+
 
 #ifndef _IBEX_WITH_OPTIM_MOP_
 #error "You need the plugin Optim MOP to run this example."
@@ -21,6 +23,190 @@ const double default_relax_ratio = 0.2;
 
 using namespace std;
 using namespace ibex;
+
+/*
+ * Settings of the solver.
+ */
+struct Options {
+	string filtering;
+	string linearrelaxation;
+	string bisection;
+	double eps;
+	double eps_x;
+	int nb_ub_sols;
+	bool no_bisect_y;
+	int nb_obj;
+};
+
+/*
+ * The optimizer and all the objects it requires. In a multi-threaded
+ * search, each thread has its own solver (functions and contractors are
+ * not thread-safe) except for the buffer, which is shared.
+ */
+struct SolverMOP {
+	SolverMOP(const System& orig_sys, const Options& opt, CellBufferOptim& buffer);
+	~SolverMOP();
+
+	System* ext_sys;
+	System* _ext_sys;
+	System* sys;
+	LoupFinderMOP* finder;
+	Bsc* bs;
+	CtcHC4 *hc4, *hc44cid, *hc44xn;
+	Ctc3BCid* c3bcidhc4;
+	CtcCompo* hc43bcidhc4;
+	CtcAcid* acidhc4;
+	CtcCompo* hc4acidhc4;
+	Linearizer* lr;
+	CtcPolytopeHull* cxn_poly;
+	CtcCompo* cxn_compo;
+	CtcFixPoint* cxn;
+	Ctc* ctcxn;
+	OptimizerMOP* o;   // two objectives
+	OptimizerKMOP* ko; // more than two objectives
+};
+
+SolverMOP::SolverMOP(const System& orig_sys, const Options& opt, CellBufferOptim& buffer) :
+		lr(NULL), cxn_poly(NULL), cxn_compo(NULL), cxn(NULL), o(NULL), ko(NULL) {
+
+	int k=opt.nb_obj;
+
+  //original system: k objective functions and constraints
+	ext_sys = new System(orig_sys);
+
+  //for accing the cy envelope constraint
+	SystemFactory fac2;
+
+	Variable w;
+	Variable a;
+
+	fac2.add_var(w);
+	fac2.add_var(a);
+
+	fac2.add_var(ext_sys->args[ext_sys->nb_var-2]);
+	fac2.add_var(ext_sys->args[ext_sys->nb_var-1]);
+	fac2.add_ctr(ext_sys->args[ext_sys->nb_var-2] + a * ext_sys->args[ext_sys->nb_var-1] - w = 0);
+
+	if(OptimizerMOP::cy_contract_var)	_ext_sys=new System(*ext_sys, System(fac2));
+	else _ext_sys =new System(*ext_sys);
+
+	SystemFactory fac;
+
+	for(int i=0; i<ext_sys->nb_var-k; i++ )
+		fac.add_var(ext_sys->args[i]);
+
+
+	for(int j=k; j<ext_sys->nb_ctr; j++ )
+		fac.add_ctr(ext_sys->ctrs[j]);
+
+
+	sys = new System(fac);
+	for(int i=0; i<sys->nb_var; i++ )
+		sys->box[i] = ext_sys->box[i];
+
+	finder = new LoupFinderMOP(*sys, ext_sys->ctrs[0].f, ext_sys->ctrs[1].f, 1e-8, opt.nb_ub_sols);
+
+	// Build the bisection heuristic
+	// --------------------------
+
+	Vector p(ext_sys->nb_var, opt.eps_x);
+	if(opt.no_bisect_y){
+		for(int i=ext_sys->nb_var-k; i<ext_sys->nb_var; i++)
+			p[i]=POS_INFINITY;
+	}
+
+	if (opt.bisection=="roundrobin")
+	  bs = new RoundRobin (0);
+	else if (opt.bisection== "largestfirst")
+	  bs= new LargestFirst(p);
+	else if (opt.bisection=="smearsum")
+	  bs = new SmearSum(*ext_sys,p);
+	else if (opt.bisection=="smearmax")
+	  bs = new SmearMax(*ext_sys,p);
+	else if (opt.bisection=="smearsumrel")
+	  bs = new SmearSumRelative(*ext_sys,p);
+	else // if (opt.bisection=="smearmaxrel")
+	  bs = new SmearMaxRelative(*ext_sys,p);
+
+	// The contractors
+
+	// the first contractor called
+	hc4 = new CtcHC4(_ext_sys->ctrs,0.01,true);
+	// hc4 inside acid and 3bcid : incremental propagation beginning with the shaved variable
+	hc44cid = new CtcHC4(_ext_sys->ctrs,0.1,true);
+	// hc4 inside xnewton loop
+	hc44xn = new CtcHC4(_ext_sys->ctrs,0.01,false);
+
+	// The 3BCID contractor on all variables (component of the contractor when filtering == "3bcidhc4")
+	c3bcidhc4 = new Ctc3BCid(*hc44cid);
+	// hc4 followed by 3bcidhc4 : the actual contractor used when filtering == "3bcidhc4"
+	hc43bcidhc4 = new CtcCompo(*hc4, *c3bcidhc4);
+
+	// The ACID contractor (component of the contractor  when filtering == "acidhc4")
+	acidhc4 = new CtcAcid(*_ext_sys,*hc44cid,true);
+	// hc4 followed by acidhc4 : the actual contractor used when filtering == "acidhc4"
+	hc4acidhc4 = new CtcCompo(*hc4, *acidhc4);
+
+	Ctc* ctc;
+	if (opt.filtering == "hc4")
+	  ctc= hc4;
+	else if
+	  (opt.filtering =="acidhc4")
+	  ctc= hc4acidhc4;
+	else // if (opt.filtering =="3bcidhc4")
+	  ctc= hc43bcidhc4;
+
+	if (opt.linearrelaxation=="art")
+	  lr= new LinearizerCombo(*_ext_sys,LinearizerCombo::ART);
+	else if  (opt.linearrelaxation=="compo")
+	  lr= new LinearizerCombo(*_ext_sys,LinearizerCombo::COMPO);
+	else if (opt.linearrelaxation=="xn")
+	  lr= new LinearizerXTaylor (*_ext_sys, LinearizerXTaylor::RELAX, LinearizerXTaylor::RANDOM_OPP);
+
+	//  the actual contractor  ctc + linear relaxation
+	if (lr) {
+		cxn_poly = new CtcPolytopeHull(*lr);
+		cxn_compo =new CtcCompo(*cxn_poly, *hc44xn);
+		cxn = new CtcFixPoint (*cxn_compo, default_relax_ratio);
+		ctcxn= new CtcCompo  (*ctc, *cxn);
+	} else
+	  ctcxn = ctc;
+
+	// the optimizer : the same precision goalprec is used as relative and absolute precision
+	if (k==2)
+		o = new OptimizerMOP(sys->nb_var,ext_sys->ctrs[0].f,ext_sys->ctrs[1].f, *ctcxn,*bs,buffer,*finder,opt.eps);
+	else {
+		Array<const Function> goals(k);
+		for (int i=0; i<k; i++)
+			goals.set_ref(i,ext_sys->ctrs[i].f);
+		ko = new OptimizerKMOP(sys->nb_var, goals, *ctcxn,*bs,buffer,*finder,opt.eps);
+	}
+}
+
+SolverMOP::~SolverMOP() {
+	if (o) delete o;
+	if (ko) delete ko;
+	if (lr) {
+		delete ctcxn;
+		delete cxn;
+		delete cxn_compo;
+		delete cxn_poly;
+		delete lr;
+	}
+	delete hc4acidhc4;
+	delete acidhc4;
+	delete hc43bcidhc4;
+	delete c3bcidhc4;
+	delete hc44xn;
+	delete hc44cid;
+	delete hc4;
+	delete bs;
+	delete finder;
+	delete sys;
+	delete _ext_sys;
+	delete ext_sys;
+}
+
 int main(int argc, char** argv){
 
 
@@ -51,6 +237,10 @@ int main(int argc, char** argv){
 	args::Flag verbose(parser, "verbose", "Verbose output. Shows the dominance-free set of solutions obtained by the solver.",{'v',"verbose"});
 	args::Flag _trace(parser, "trace", "Activate trace. Updates of loup/uplo are printed while minimizing.", {"trace"});
 	args::Flag _plot(parser, "plot", "Save a file to be plotted by plot.py.", {"plot"});
+	args::ValueFlag<int> _threads(parser, "int", "Number of threads (default: 1)", {"threads"});
+	args::ValueFlag<std::string> _nds_stream(parser, "string", "Write the insertions/deletions of non dominated vectors in this file (or pipe) during the search", {"nds-stream"});
+	args::ValueFlag<double> _nds_grid(parser, "float", "Keep at most one non dominated vector per cell of a grid of this size (default: 0, no grid)", {"nds-grid"});
+	args::ValueFlag<int> _nb_obj(parser, "int", "Number of objectives, i.e., the last variables of the system, defined by the first constraints (default: 2)", {"nb-obj"});
 	args::Positional<std::string> filename(parser, "filename", "The name of the MINIBEX file.");
 
 	try
@@ -75,93 +265,87 @@ int main(int argc, char** argv){
 		return 1;
 	}
 
-  //original system: 2 objective functions and constraints
-	System ext_sys(filename.Get().c_str());
-
-  //for accing the cy envelope constraint
-	SystemFactory fac2;
-
-	Variable w;
-	Variable a;
-
-	fac2.add_var(w);
-	fac2.add_var(a);
-
-	fac2.add_var(ext_sys.args[ext_sys.nb_var-2]);
-	fac2.add_var(ext_sys.args[ext_sys.nb_var-1]);
-	fac2.add_ctr(ext_sys.args[ext_sys.nb_var-2] + a * ext_sys.args[ext_sys.nb_var-1] - w = 0);
 
 	OptimizerMOP::cy_contract_var= _cy_contract || _cy_contract_full;
 	OptimizerMOP::_cy_upper= _cy_contract_full;
 
-	System *_ext_sys;
-	if(OptimizerMOP::cy_contract_var)	_ext_sys=new System(ext_sys, System(fac2));
-	else _ext_sys =new System(ext_sys);
-
-
 	//cout << *_ext_sys << endl;
 
-	string filtering = (_filtering)? _filtering.Get() : "acidhc4";
-	string linearrelaxation= (_linear_relax)? _linear_relax.Get() : "compo";
-	string bisection= (_bisector)? _bisector.Get() : "largestfirst";
-	string strategy= (_strategy)? _strategy.Get() : "NDSdist";
-	double eps= (_eps)? _eps.Get() : 0.01 ;
-	double eps_x= (_epsx)? _epsx.Get() : 1e-8 ;
+	Options opt;
+	opt.filtering = (_filtering)? _filtering.Get() : "acidhc4";
+	opt.linearrelaxation= (_linear_relax)? _linear_relax.Get() : "compo";
+	opt.bisection= (_bisector)? _bisector.Get() : "largestfirst";
+	opt.nb_obj = (_nb_obj)? _nb_obj.Get() : 2;
+	string strategy= (_strategy)? _strategy.Get() : (opt.nb_obj==2? "NDSdist" : "OC3");
+	opt.eps= (_eps)? _eps.Get() : 0.01 ;
+	opt.eps_x= (_epsx)? _epsx.Get() : 1e-8 ;
 	double timelimit = (_timelimit)? _timelimit.Get() : 100 ;
 	double eqeps= 1.e-8;
+	int nb_threads = (_threads)? _threads.Get() : 1;
 
 	OptimizerMOP::_plot = _plot;
 
-	int nb_ub_sols = (_nb_ub_sols)? _nb_ub_sols.Get() : 50 ;
+	opt.nb_ub_sols = (_nb_ub_sols)? _nb_ub_sols.Get() : 50 ;
 	OptimizerMOP::_min_ub_dist = (_min_ub_dist)? _min_ub_dist.Get() : 0.1;
 	LoupFinderMOP::_weight2 = (_weight2)? _weight2.Get() : 0.01 ;
-	bool no_bisect_y  = _nobisecty;
+	opt.no_bisect_y  = _nobisecty;
 	OptimizerMOP::_eps_contract = _eps_contract;
+	double nds_grid = (_nds_grid)? _nds_grid.Get() : 0;
+
+	ofstream nds_stream;
+	if (_nds_stream) {
+		nds_stream.open(_nds_stream.Get().c_str());
+		if (!nds_stream) {
+			cout << "cannot open " << _nds_stream.Get() << endl; return -1;
+		}
+		nds_stream.precision(17);
+	}
 
-	if(bisection=="largestfirst_noy"){
-		bisection="largestfirst";
-		no_bisect_y=true;
+	if(opt.bisection=="largestfirst_noy"){
+		opt.bisection="largestfirst";
+		opt.no_bisect_y=true;
 	}
 
 	RNG::srand(0);
 
 	cout << "Instance: " << argv[1] << endl;
-	cout << "Filtering: " << filtering << endl;
-	cout << "Linear Relax: " << linearrelaxation << endl;
-	cout << "Bisector: " << bisection << endl;
+	cout << "Filtering: " << opt.filtering << endl;
+	cout << "Linear Relax: " << opt.linearrelaxation << endl;
+	cout << "Bisector: " << opt.bisection << endl;
 	cout << "Strategy: " << strategy << endl;
-	cout << "eps: " << eps << endl;
-	cout << "eps_x: " << eps_x << endl;
-	cout << "nb_ub_sols: " << nb_ub_sols << endl;
+	cout << "eps: " << opt.eps << endl;
+	cout << "eps_x: " << opt.eps_x << endl;
+	cout << "nb_ub_sols: " << opt.nb_ub_sols << endl;
 	//cout << "min_ub_dist: " << OptimizerMOP::_min_ub_dist << endl;
 	cout << "plot: " <<  ((OptimizerMOP::_plot)? "yes":"no") << endl;
 	//cout << "weight f2: " << LoupFinderMOP::_weight2 << endl;
-	cout << "bisect y?: " << ((no_bisect_y)? "no":"yes") << endl;
+	cout << "bisect y?: " << ((opt.no_bisect_y)? "no":"yes") << endl;
 	cout << "cy_contract?: " << ((OptimizerMOP::cy_contract_var)? "yes":"no") << endl;
+	cout << "threads: " << nb_threads << endl;
+	cout << "objectives: " << opt.nb_obj << endl;
+	if (nds_grid>0) cout << "NDS grid: " << nds_grid << endl;
 
+	if (opt.bisection!="roundrobin" && opt.bisection!="largestfirst" && opt.bisection!="smearsum" &&
+		opt.bisection!="smearmax" && opt.bisection!="smearsumrel" && opt.bisection!="smearmaxrel") {
+		cout << opt.bisection << " is not an implemented  bisection mode "  << endl; return -1;
+	}
 
-	SystemFactory fac;
-
-	for(int i=0; i<ext_sys.nb_var-2; i++ )
-		fac.add_var(ext_sys.args[i]);
-
-
-	for(int j=2; j<ext_sys.nb_ctr; j++ )
-		fac.add_ctr(ext_sys.ctrs[j]);
-
-
-	System sys(fac);
-	for(int i=0; i<sys.nb_var; i++ )
-		sys.box[i] = ext_sys.box[i];
-
+	if (opt.filtering!="hc4" && opt.filtering!="acidhc4" && opt.filtering!="3bcidhc4") {
+		cout << opt.filtering <<  " is not an implemented  contraction  mode "  << endl; return -1;
+	}
 
-	//cout << sys << endl;
+	if (opt.nb_obj<2) {
+		cout << "at least two objectives are required" << endl; return -1;
+	}
 
-	IntervalVector box = ext_sys.box.mid();
-	box[sys.nb_var]=0;
-	box[sys.nb_var+1]=0;
+	if (nb_threads<1) {
+		cout << "the number of threads must be positive" << endl; return -1;
+	}
 
-	LoupFinderMOP finder(sys, ext_sys.ctrs[0].f, ext_sys.ctrs[1].f, 1e-8, nb_ub_sols);
+	if (opt.nb_obj>2 && (strategy=="NDSdist" || OptimizerMOP::cy_contract_var || nb_threads>1
+			|| _nds_stream || _nds_grid)) {
+		cout << "NDSdist, cy-contract, threads, nds-stream and nds-grid are only available with two objectives" << endl; return -1;
+	}
 
 	CellBufferOptim* buffer;
 	if(strategy=="OC1")
@@ -177,122 +361,47 @@ int main(int argc, char** argv){
 	else if(strategy=="NDSdist")
 	  buffer = new DistanceSortedCellBufferMOP;
 
+  //original system: k objective functions and constraints
+	System ext_sys(filename.Get().c_str());
 
-	// Build the bisection heuristic
-	// --------------------------
-
-	Bsc * bs;
-
-	Vector p(ext_sys.nb_var, eps_x);
-	if(no_bisect_y){
-		p[ext_sys.nb_var-2]=POS_INFINITY;
-		p[ext_sys.nb_var-1]=POS_INFINITY;
-	}
-
-	if (bisection=="roundrobin")
-	  bs = new RoundRobin (0);
-	else if (bisection== "largestfirst"){
-          bs= new LargestFirst(p);
-	}else if (bisection=="smearsum")
-	  bs = new SmearSum(ext_sys,p);
-	else if (bisection=="smearmax")
-	  bs = new SmearMax(ext_sys,p);
-	else if (bisection=="smearsumrel")
-	  bs = new SmearSumRelative(ext_sys,p);
-	else if (bisection=="smearmaxrel")
-	  bs = new SmearMaxRelative(ext_sys,p);
-	//else if (bisection=="lsmear")
-	//  bs = new LSmear(ext_sys,p);
-	else {cout << bisection << " is not an implemented  bisection mode "  << endl; return -1;}
-
-	// The contractors
-
-	// the first contractor called
-	CtcHC4 hc4(_ext_sys->ctrs,0.01,true);
-	// hc4 inside acid and 3bcid : incremental propagation beginning with the shaved variable
-	CtcHC4 hc44cid(_ext_sys->ctrs,0.1,true);
-	// hc4 inside xnewton loop
-	CtcHC4 hc44xn (_ext_sys->ctrs,0.01,false);
-
-	// The 3BCID contractor on all variables (component of the contractor when filtering == "3bcidhc4")
-	Ctc3BCid c3bcidhc4(hc44cid);
-	// hc4 followed by 3bcidhc4 : the actual contractor used when filtering == "3bcidhc4"
-	CtcCompo hc43bcidhc4 (hc4, c3bcidhc4);
-
-	// The ACID contractor (component of the contractor  when filtering == "acidhc4")
-	CtcAcid acidhc4(*_ext_sys,hc44cid,true);
-	// hc4 followed by acidhc4 : the actual contractor used when filtering == "acidhc4"
-	CtcCompo hc4acidhc4 (hc4, acidhc4);
-
-
-
-	Ctc* ctc;
-	if (filtering == "hc4")
-	  ctc= &hc4;
-	else if
-	  (filtering =="acidhc4")
-	  ctc= &hc4acidhc4;
-	else if
-	  (filtering =="3bcidhc4")
-	  ctc= &hc43bcidhc4;
-	else {cout << filtering <<  " is not an implemented  contraction  mode "  << endl; return -1;}
-
-	Linearizer* lr;
-	if (linearrelaxation=="art")
-	  lr= new LinearizerCombo(*_ext_sys,LinearizerCombo::ART);
-	else if  (linearrelaxation=="compo")
-	  lr= new LinearizerCombo(*_ext_sys,LinearizerCombo::COMPO);
-	else if (linearrelaxation=="xn")
-	  lr= new LinearizerXTaylor (*_ext_sys, LinearizerXTaylor::RELAX, LinearizerXTaylor::RANDOM_OPP);
-
-	CtcFixPoint* cxn;
-	CtcPolytopeHull* cxn_poly;
-	CtcCompo* cxn_compo;
-	if (linearrelaxation=="compo" || linearrelaxation=="art"|| linearrelaxation=="xn")
-          {
-		cxn_poly = new CtcPolytopeHull(*lr);
-
-		cxn_compo =new CtcCompo(*cxn_poly, hc44xn);
-		cxn = new CtcFixPoint (*cxn_compo, default_relax_ratio);
-	  }
-	//  the actual contractor  ctc + linear relaxation
-	Ctc* ctcxn;
-	if (linearrelaxation=="compo" || linearrelaxation=="art"|| linearrelaxation=="xn")
-          ctcxn= new CtcCompo  (*ctc, *cxn);
-	else
-	  ctcxn = ctc;
+	// one solver per thread (each with its own copy of the system)
+	vector<SolverMOP*> solvers;
+	for (int i=0; i<nb_threads; i++)
+		solvers.push_back(new SolverMOP(ext_sys, opt, *buffer));
 
-	// the optimizer : the same precision goalprec is used as relative and absolute precision
-	OptimizerMOP o(sys.nb_var,ext_sys.ctrs[0].f,ext_sys.ctrs[1].f, *ctcxn,*bs,*buffer,finder,eps);
-	max_distance::UB= &o.get_UB();
+	if (opt.nb_obj>2) {
+		OptimizerKMOP& o=*solvers[0]->ko;
 
+		o.trace=(_trace)? _trace.Get() : false;
+		o.timeout=timelimit;
+		o.optimize(ext_sys.box);
+		o.report(verbose);
+	} else {
+		OptimizerMOP& o=*solvers[0]->o;
 
-	//	cout << " sys.box " << sys.box << endl;
+		for (int i=1; i<nb_threads; i++)
+			o.add_worker(*solvers[i]->o);
 
-	// the trace
-	o.trace=(_trace)? _trace.Get() : false;
+		// the trace
+		o.trace=(_trace)? _trace.Get() : false;
 
-	// the allowed time for search
-	o.timeout=timelimit;
+		// the allowed time for search
+		o.timeout=timelimit;
 
-	// the search itself
-	o.optimize(ext_sys.box);
+		// the NDS (shared with the workers)
+		o.nds_grid=nds_grid;
+		if (_nds_stream) o.nds_stream=&nds_stream;
 
-	// printing the results
-	o.report(verbose);
+		// the search itself
+		o.optimize(ext_sys.box);
 
-	delete bs;
-	delete buffer;
-	delete _ext_sys;
-	if (linearrelaxation=="compo" || linearrelaxation=="art"|| linearrelaxation=="xn") {
-		delete lr;
-	    delete ctcxn;
-	    delete cxn;
-	    delete cxn_poly;
-	    delete cxn_compo;
+		// printing the results
+		o.report(verbose);
 	}
 
-
+	for (int i=0; i<nb_threads; i++)
+		delete solvers[i];
+	delete buffer;
 
 	return 0;
 
@@ -103,8 +103,9 @@ std::pair<IntervalVector, double> LoupFinderMOP::find(const IntervalVector& box,
 		lp_solver.set_bounds(box);
 
 		IntervalVector box2(box);
-		box2.resize(n+2);
-		box2[n]=0.0; box2[n+1]=0.0;
+		// the objective variables (2 or more) are set to 0
+		box2.resize(goal1.nb_var());
+		for (int i=n; i<box2.size(); i++) box2[i]=0.0;
 		IntervalVector ig= (phase==0 && (nb_sol>1 || rand()%2==0))?
 				(goal1.gradient(box2.mid())+ _weight2*goal2.gradient(box2.mid())) :
 				(goal2.gradient(box2.mid())+ _weight2*goal1.gradient(box2.mid()));
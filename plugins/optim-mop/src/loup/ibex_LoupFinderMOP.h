@@ -42,6 +42,8 @@ public:
 	 *
 	 * The system is an inequality system of constraints.
 	 * Goal functions have the form: f1 - z1  and f2 - z2.
+	 * With more than two objectives (see #OptimizerKMOP), goal1 and goal2
+	 * are two of them and take all the objective variables as arguments.
 	 *
 	 * \param sys         - The NLP problem.
 	 * \param goal1
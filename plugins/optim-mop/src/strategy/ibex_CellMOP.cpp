@@ -9,7 +9,7 @@
 
 namespace ibex {
 
-	int CellMOP::nb_cells = 0;
+	std::atomic<int> CellMOP::nb_cells(0);
 	Interval CellMOP::y1_init = Interval(0,0);
 	Interval CellMOP::y2_init = Interval(0,0);
 
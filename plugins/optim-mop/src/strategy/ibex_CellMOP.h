@@ -11,6 +11,8 @@
 #include "ibex_CellBuffer.h"
 #include "ibex_CellBufferOptim.h"
 
+#include <atomic>
+
 namespace ibex {
 
 
@@ -44,8 +46,9 @@ public:
 
 	/**
 	 * the current number of generated cells (for instantiating the id)
+	 * (atomic because cells may be bisected by several threads)
 	 */
-	static int nb_cells;
+	static std::atomic<int> nb_cells;
 
 	/**
 	 * The evaluation of the objective f1 with the initial box
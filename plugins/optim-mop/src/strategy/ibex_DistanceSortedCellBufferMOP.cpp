@@ -13,9 +13,6 @@ namespace ibex {
 
 
 
-	map< pair <double, double>, IntervalVector >* max_distance::UB=NULL;
-
-
 	void DistanceSortedCellBufferMOP::flush() {
 		while (!cells.empty()) {
 			delete pop();
@@ -31,7 +28,7 @@ namespace ibex {
 	}
 
 	void DistanceSortedCellBufferMOP::push(Cell* cell) {
-		double dist=OptimizerMOP::distance2(cell);
+		double dist=optim->distance2(cell);
 		if(dist < cell->get<CellMOP>().ub_distance )
 			cell->get<CellMOP>().ub_distance=dist;
 		cells.push(cell);
@@ -50,7 +47,7 @@ namespace ibex {
 		if(!c) return NULL;
 
 
-		double dist=OptimizerMOP::distance2(c);
+		double dist=optim->distance2(c);
 
 		//we update the distance and reinsert the element
 		while(dist < c->get<CellMOP>().ub_distance){
@@ -58,7 +55,7 @@ namespace ibex {
 			c->get<CellMOP>().ub_distance=dist;
 			cells.push(c);
 			c = cells.top();
-			dist=OptimizerMOP::distance2(c);
+			dist=optim->distance2(c);
 		}
 
 		//cout << "dist:" << dist << endl;
@@ -33,9 +33,10 @@ struct max_distance {
 	   else return false;
 	}
 
-	static map< pair <double, double>, IntervalVector >* UB;
 };
 
+class OptimizerMOP;
+
 
 /** \ingroup strategy
  *
@@ -44,6 +45,8 @@ struct max_distance {
 class DistanceSortedCellBufferMOP : public CellBufferOptim {
  public:
 
+   DistanceSortedCellBufferMOP() : optim(NULL) { }
+
    virtual void add_backtrackable(Cell& root){
      root.add<CellMOP>();
    }
@@ -91,6 +94,12 @@ class DistanceSortedCellBufferMOP : public CellBufferOptim {
 	 */
 	mutable std::priority_queue<Cell*, std::vector<Cell*>, max_distance > cells;
 
+	/**
+	 * The optimizer using this buffer (for the distance to its NDS).
+	 * Set by OptimizerMOP::optimize(...).
+	 */
+	const OptimizerMOP* optim;
+
 
 };
 
@@ -0,0 +1,324 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_NDTree.cpp
+// Author      : Matias Campusano, Damir Aliquintui, Ignacio Araya
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "ibex_NDTree.h"
+
+#include <cassert>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/* true iff a<=b componentwise */
+bool leq(const Vector& a, const Vector& b) {
+	for (int i=0; i<a.size(); i++)
+		if (a[i]>b[i]) return false;
+	return true;
+}
+
+double dist2(const Vector& a, const Vector& b) {
+	double d=0;
+	for (int i=0; i<a.size(); i++)
+		d+=(a[i]-b[i])*(a[i]-b[i]);
+	return d;
+}
+
+}
+
+class NDTree::Node {
+public:
+	Node(int k) : ideal(k,POS_INFINITY), nadir(k,NEG_INFINITY) { }
+
+	~Node() {
+		for (vector<Node*>::iterator it=children.begin(); it!=children.end(); it++)
+			delete *it;
+	}
+
+	bool is_leaf() const {
+		return children.empty();
+	}
+
+	bool is_empty() const {
+		return children.empty() && pts.empty();
+	}
+
+	/* number of points in the subtree */
+	int count() const {
+		int c=pts.size();
+		for (vector<Node*>::const_iterator it=children.begin(); it!=children.end(); it++)
+			c+=(*it)->count();
+		return c;
+	}
+
+	/* the midpoint between the ideal and the nadir points */
+	Vector mid() const {
+		return 0.5*(ideal+nadir);
+	}
+
+	/* extend the bounds with y */
+	void update_bounds(const Vector& y) {
+		for (int i=0; i<y.size(); i++) {
+			if (y[i]<ideal[i]) ideal[i]=y[i];
+			if (y[i]>nadir[i]) nadir[i]=y[i];
+		}
+	}
+
+	/* recompute the bounds from the points or the children */
+	void compute_bounds() {
+		ideal=Vector(ideal.size(),POS_INFINITY);
+		nadir=Vector(nadir.size(),NEG_INFINITY);
+		for (vector<pair<Vector,IntervalVector> >::const_iterator it=pts.begin(); it!=pts.end(); it++)
+			update_bounds(it->first);
+		for (vector<Node*>::const_iterator it=children.begin(); it!=children.end(); it++) {
+			update_bounds((*it)->ideal);
+			update_bounds((*it)->nadir);
+		}
+	}
+
+	/* ideal point of the subtree */
+	Vector ideal;
+
+	/* nadir point of the subtree */
+	Vector nadir;
+
+	/* children (empty for a leaf) */
+	vector<Node*> children;
+
+	/* points of a leaf */
+	vector<pair<Vector,IntervalVector> > pts;
+};
+
+NDTree::NDTree(int k, int max_leaf_size, int nb_children) : k(k), max_leaf_size(max_leaf_size),
+		nb_children(nb_children<0? k+1 : nb_children), root(NULL), _size(0) {
+	assert(this->nb_children>=2 && max_leaf_size>=1);
+}
+
+NDTree::~NDTree() {
+	clear();
+}
+
+void NDTree::clear() {
+	if (root) delete root;
+	root=NULL;
+	_size=0;
+}
+
+bool NDTree::is_dominated(const Vector& y) const {
+	return root && is_dominated(root,y);
+}
+
+bool NDTree::is_dominated(const Node* node, const Vector& y) const {
+	// no point of the subtree is less than y
+	for (int i=0; i<k; i++)
+		if (node->ideal[i]>y[i]) return false;
+
+	// all the points of the subtree are less than y
+	if (leq(node->nadir,y)) return true;
+
+	if (node->is_leaf()) {
+		for (vector<pair<Vector,IntervalVector> >::const_iterator it=node->pts.begin(); it!=node->pts.end(); it++)
+			if (leq(it->first,y)) return true;
+		return false;
+	}
+
+	for (vector<Node*>::const_iterator it=node->children.begin(); it!=node->children.end(); it++)
+		if (is_dominated(*it,y)) return true;
+
+	return false;
+}
+
+void NDTree::remove_dominated(Node* node, const Vector& y) {
+	// no point of the subtree is greater than y
+	for (int i=0; i<k; i++)
+		if (y[i]>node->nadir[i]) return;
+
+	if (node->is_leaf()) {
+		vector<pair<Vector,IntervalVector> >& pts=node->pts;
+		for (unsigned int j=0; j<pts.size(); ) {
+			if (leq(y,pts[j].first)) {
+				pts[j]=pts.back();
+				pts.pop_back();
+				_size--;
+			} else
+				j++;
+		}
+	} else {
+		vector<Node*>& children=node->children;
+		for (unsigned int j=0; j<children.size(); ) {
+			Node* child=children[j];
+			// all the points of the child are greater than y
+			bool all=leq(y,child->ideal);
+			if (all)
+				_size-=child->count();
+			else
+				remove_dominated(child,y);
+
+			if (all || child->is_empty()) {
+				delete child;
+				children[j]=children.back();
+				children.pop_back();
+			} else
+				j++;
+		}
+
+		// a node with a single child is replaced by this child
+		if (children.size()==1) {
+			Node* child=children[0];
+			children=child->children;
+			node->pts=child->pts;
+			child->children.clear();
+			delete child;
+		}
+	}
+
+	node->compute_bounds();
+}
+
+bool NDTree::add(const Vector& y, const IntervalVector& x) {
+	if (root) {
+		if (is_dominated(root,y)) return false;
+
+		remove_dominated(root,y);
+
+		if (root->is_empty()) {
+			delete root;
+			root=NULL;
+		}
+	}
+
+	if (!root) root=new Node(k);
+
+	insert(root,y,x);
+	_size++;
+	return true;
+}
+
+void NDTree::insert(Node* node, const Vector& y, const IntervalVector& x) {
+	node->update_bounds(y);
+
+	if (node->is_leaf()) {
+		node->pts.push_back(make_pair(y,x));
+		if ((int) node->pts.size()>max_leaf_size)
+			split(node);
+		return;
+	}
+
+	// the child with the closest midpoint
+	Node* best=NULL;
+	double best_dist=POS_INFINITY;
+	for (vector<Node*>::iterator it=node->children.begin(); it!=node->children.end(); it++) {
+		double d=dist2((*it)->mid(),y);
+		if (!best || d<best_dist) {
+			best=*it;
+			best_dist=d;
+		}
+	}
+
+	insert(best,y,x);
+}
+
+void NDTree::split(Node* leaf) {
+	vector<pair<Vector,IntervalVector> > pts;
+	pts.swap(leaf->pts);
+	int size=pts.size();
+
+	// the seeds of the children are chosen far from each other:
+	// the first one is the point with the largest mean distance to the
+	// others, then the point which maximizes the distance to the nearest seed.
+	vector<bool> is_seed(size,false);
+	vector<double> min_dist(size,POS_INFINITY);
+
+	int seed=0;
+	double max_sum=NEG_INFINITY;
+	for (int i=0; i<size; i++) {
+		double sum=0;
+		for (int j=0; j<size; j++)
+			sum+=dist2(pts[i].first,pts[j].first);
+		if (sum>max_sum) {
+			max_sum=sum;
+			seed=i;
+		}
+	}
+
+	for (int c=0; c<std::min(nb_children,size); c++) {
+		is_seed[seed]=true;
+		Node* child=new Node(k);
+		child->update_bounds(pts[seed].first);
+		child->pts.push_back(pts[seed]);
+		leaf->children.push_back(child);
+
+		int next=-1;
+		for (int i=0; i<size; i++) {
+			if (is_seed[i]) continue;
+			min_dist[i]=std::min(min_dist[i],dist2(pts[i].first,pts[seed].first));
+			if (next==-1 || min_dist[i]>min_dist[next]) next=i;
+		}
+		seed=next;
+	}
+
+	// the other points go to the child with the closest midpoint
+	for (int i=0; i<size; i++) {
+		if (is_seed[i]) continue;
+		Node* best=NULL;
+		double best_dist=POS_INFINITY;
+		for (vector<Node*>::iterator it=leaf->children.begin(); it!=leaf->children.end(); it++) {
+			double d=dist2((*it)->mid(),pts[i].first);
+			if (!best || d<best_dist) {
+				best=*it;
+				best_dist=d;
+			}
+		}
+		best->update_bounds(pts[i].first);
+		best->pts.push_back(pts[i]);
+	}
+}
+
+double NDTree::min_dominating(int i, const Vector& l) const {
+	double min=POS_INFINITY;
+	if (root) min_dominating(root,i,l,min);
+	return min;
+}
+
+void NDTree::min_dominating(const Node* node, int i, const Vector& l, double& min) const {
+	if (node->ideal[i]>=min) return;
+
+	for (int j=0; j<k; j++)
+		if (j!=i && node->ideal[j]>l[j]) return;
+
+	if (node->is_leaf()) {
+		for (vector<pair<Vector,IntervalVector> >::const_iterator it=node->pts.begin(); it!=node->pts.end(); it++) {
+			const Vector& p=it->first;
+			if (p[i]>=min) continue;
+			bool dom=true;
+			for (int j=0; j<k; j++)
+				if (j!=i && p[j]>l[j]) { dom=false; break; }
+			if (dom) min=p[i];
+		}
+		return;
+	}
+
+	for (vector<Node*>::const_iterator it=node->children.begin(); it!=node->children.end(); it++)
+		min_dominating(*it,i,l,min);
+}
+
+void NDTree::points(vector<pair<Vector,IntervalVector> >& res) const {
+	res.clear();
+	if (root) points(root,res);
+}
+
+void NDTree::points(const Node* node, vector<pair<Vector,IntervalVector> >& res) const {
+	res.insert(res.end(),node->pts.begin(),node->pts.end());
+	for (vector<Node*>::const_iterator it=node->children.begin(); it!=node->children.end(); it++)
+		points(*it,res);
+}
+
+} // end namespace ibex
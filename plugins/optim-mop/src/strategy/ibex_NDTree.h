@@ -0,0 +1,138 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_NDTree.h
+// Author      : Matias Campusano, Damir Aliquintui, Ignacio Araya
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_ND_TREE_H__
+#define __IBEX_ND_TREE_H__
+
+#include "ibex_IntervalVector.h"
+
+#include <vector>
+
+using namespace std;
+namespace ibex {
+
+/**
+ * \brief Non dominated set of a k-objective optimization (ND-tree).
+ *
+ * Set of vectors y=(y1,...,yk) of the objective space, together with the
+ * feasible point realizing each of them, such that no vector is dominated
+ * by another one.
+ *
+ * The points are stored in the leaves of a tree. Each node stores the ideal
+ * point (componentwise minimum) and the nadir point (componentwise maximum)
+ * of the points in its subtree. This allows to discard (or to accept) whole
+ * subtrees in the dominance queries, see [A. Jaszkiewicz and T. Lust,
+ * "ND-Tree-based update: a fast algorithm for the dynamic non-dominance
+ * problem" (2018)].
+ *
+ * In the bi-objective case, #NonDominatedSet (a sorted list) is faster.
+ *
+ * \note Dominance is understood in the weak sense: y dominates y' iff
+ *       y<=y' componentwise.
+ */
+class NDTree {
+public:
+
+	/**
+	 * \brief Build an empty set.
+	 *
+	 * \param k             - number of objectives
+	 * \param max_leaf_size - a leaf is split when it contains more points
+	 * \param nb_children   - number of children of a split leaf (default: k+1)
+	 */
+	NDTree(int k, int max_leaf_size=20, int nb_children=-1);
+
+	/**
+	 * \brief Delete *this.
+	 */
+	~NDTree();
+
+	/**
+	 * \brief Remove all the points.
+	 */
+	void clear();
+
+	/**
+	 * \brief True if y is dominated by (or equal to) some point of the set.
+	 */
+	bool is_dominated(const Vector& y) const;
+
+	/**
+	 * \brief Insert the vector y=f(x).
+	 *
+	 * The vector is inserted if it is not dominated.
+	 * The points dominated by y are removed.
+	 *
+	 * \return true iff y has been inserted.
+	 */
+	bool add(const Vector& y, const IntervalVector& x);
+
+	/**
+	 * \brief Smallest i-th component of the points dominating l
+	 * on all the other objectives.
+	 *
+	 * Return min { p_i : p in the set, p_j<=l_j for all j!=i } (+oo if there
+	 * is no such point). All the vectors y>=l with y_i greater than or equal
+	 * to the returned value are dominated.
+	 */
+	double min_dominating(int i, const Vector& l) const;
+
+	/**
+	 * \brief Number of points.
+	 */
+	int size() const;
+
+	/**
+	 * \brief The points (in no particular order).
+	 */
+	void points(vector<pair<Vector,IntervalVector> >& res) const;
+
+	/**
+	 * \brief Number of objectives.
+	 */
+	const int k;
+
+protected:
+
+	/** Node of the tree. */
+	class Node;
+
+	bool is_dominated(const Node* node, const Vector& y) const;
+	void remove_dominated(Node* node, const Vector& y);
+	void insert(Node* node, const Vector& y, const IntervalVector& x);
+	void split(Node* leaf);
+	void min_dominating(const Node* node, int i, const Vector& l, double& min) const;
+	void points(const Node* node, vector<pair<Vector,IntervalVector> >& res) const;
+
+	/** Maximal number of points in a leaf */
+	const int max_leaf_size;
+
+	/** Number of children of a split leaf */
+	const int nb_children;
+
+	/** The root (NULL if the set is empty) */
+	Node* root;
+
+	/** Number of points */
+	int _size;
+
+private:
+	NDTree(const NDTree&); // forbidden
+};
+
+/*============================================ inline implementation ============================================ */
+
+inline int NDTree::size() const {
+	return _size;
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_ND_TREE_H__
@@ -0,0 +1,163 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_NonDominatedSet.cpp
+// Author      : Matias Campusano, Damir Aliquintui, Ignacio Araya
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "ibex_NonDominatedSet.h"
+#include "ibex_pyPlotter.h"
+
+#include <cmath>
+
+using namespace std;
+
+namespace ibex {
+
+NonDominatedSet::NonDominatedSet() : plot(false), grid(0), stream(NULL) {
+	clear();
+}
+
+void NonDominatedSet::clear() {
+	Lock lock(*this);
+
+	NDS.clear();
+	NDSy.clear();
+
+	//the first point
+	NDS.insert(make_pair(make_pair(NEG_INFINITY,POS_INFINITY), Vector(1)));
+	//the last point
+	NDS.insert(make_pair(make_pair(POS_INFINITY,NEG_INFINITY), Vector(1)));
+
+	_y1_ub=make_pair(POS_INFINITY,POS_INFINITY);
+	_y2_ub=make_pair(POS_INFINITY,POS_INFINITY);
+
+	if (stream) (*stream) << "clear" << endl;
+}
+
+bool NonDominatedSet::_is_dominated(const pair<double,double>& eval) const {
+	map<pair<double, double>, IntervalVector>::const_iterator it2 = NDS.lower_bound(eval);
+
+	//there is an equivalent point
+	if(it2->first == eval) return true;
+	it2--;
+	//it is dominated by the previous ub point
+	if(eval.second >= it2->first.second) return true;
+
+	return false;
+}
+
+bool NonDominatedSet::is_dominated(const pair<double,double>& eval) const {
+	Lock lock(*this);
+	return _is_dominated(eval);
+}
+
+bool NonDominatedSet::add(const pair<double,double>& eval, const IntervalVector& vec, double min_dist) {
+	Lock lock(*this);
+
+	// the set may have been modified by another thread since the
+	// last call to is_dominated
+	if (_is_dominated(eval)) return false;
+
+	pair<double,double> b;
+	if (grid>0) {
+		b=grid_cell(eval);
+		if (_is_grid_dominated(b, eval)) return false;
+	}
+
+	bool domine=false;
+	map<pair<double, double>, IntervalVector>::iterator it2 = NDS.lower_bound(eval);
+
+	for(; it2!=NDS.end(); ){
+
+		if(eval.second > it2->first.second) break;
+		erase(it2++);
+		domine=true;
+	}
+
+	if (grid>0) {
+		// remove the points whose cell is dominated by the cell of eval.
+		// Along the set, the first coordinate of the cells increases and
+		// the second one decreases.
+		it2 = NDS.lower_bound(make_pair(b.first*grid, NEG_INFINITY));
+		while (prev(it2)!=NDS.begin() && grid_cell(prev(it2)->first).first>=b.first) --it2;
+		while (it2->first.first<POS_INFINITY && grid_cell(it2->first).first<b.first) ++it2;
+
+		while (it2->first.second>NEG_INFINITY && grid_cell(it2->first).second>=b.second) {
+			erase(it2++);
+			// eval must be inserted since it replaces the removed points
+			domine=true;
+		}
+
+		it2 = NDS.lower_bound(eval);
+	}
+
+	//the point is inserted in NDS only if its distance to the neighbor points is greater than min_dist
+	bool insert=domine || std::min(it2->first.first - eval.first,  eval.second - it2->first.second) >= min_dist;
+	if (!insert) {
+		it2--;
+		insert=std::min(eval.first - it2->first.first,  it2->first.second - eval.second) >= min_dist;
+	}
+
+	if (insert) {
+		if(eval.first < _y1_ub.first) _y1_ub=eval;
+		if(eval.second < _y2_ub.second) _y2_ub=eval;
+
+		NDS.insert(make_pair(eval, vec));
+		NDSy.insert(make_pair(eval, vec));
+
+		if (stream) (*stream) << "+ " << eval.first << " " << eval.second << endl;
+	}
+
+	return insert;
+}
+
+void NonDominatedSet::erase(map<pair<double, double>, IntervalVector>::iterator it) {
+	if(plot) py_Plotter::plot_del_ub(it->first);
+	if(stream) (*stream) << "- " << it->first.first << " " << it->first.second << endl;
+
+	NDSy.erase(it->first);
+	NDS.erase(it);
+}
+
+pair<double,double> NonDominatedSet::grid_cell(const pair<double,double>& y) const {
+	return make_pair(std::floor(y.first/grid), std::floor(y.second/grid));
+}
+
+bool NonDominatedSet::_is_grid_dominated(const pair<double,double>& b, const pair<double,double>& eval) const {
+	// the last point whose cell has a first coordinate <= b.first
+	// is the one with the smallest second coordinate among them.
+	map<pair<double, double>, IntervalVector>::const_iterator it = NDS.lower_bound(make_pair((b.first+1)*grid, NEG_INFINITY));
+	while (it->first.first<POS_INFINITY && grid_cell(it->first).first<=b.first) ++it;
+	--it;
+	while (it!=NDS.begin() && grid_cell(it->first).first>b.first) --it;
+
+	if (it==NDS.begin()) return false;
+
+	pair<double,double> c=grid_cell(it->first);
+
+	if (c.second>b.second) return false;
+
+	// in the same cell, eval replaces the point only if it dominates it
+	return c!=b || eval.first>it->first.first || eval.second>it->first.second;
+}
+
+int NonDominatedSet::size() const {
+	Lock lock(*this);
+	return NDS.size();
+}
+
+pair<double,double> NonDominatedSet::y1_ub() const {
+	Lock lock(*this);
+	return _y1_ub;
+}
+
+pair<double,double> NonDominatedSet::y2_ub() const {
+	Lock lock(*this);
+	return _y2_ub;
+}
+
+} // end namespace ibex
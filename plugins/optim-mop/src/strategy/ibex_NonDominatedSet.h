@@ -0,0 +1,207 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_NonDominatedSet.h
+// Author      : Matias Campusano, Damir Aliquintui, Ignacio Araya
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_NON_DOMINATED_SET_H__
+#define __IBEX_NON_DOMINATED_SET_H__
+
+#include "ibex_IntervalVector.h"
+
+#include <map>
+#include <ostream>
+
+#ifndef _WIN32 // MinGW does not support mutex
+#include <mutex>
+#endif
+
+using namespace std;
+namespace ibex {
+
+/**
+ * comparation function for sorting NDS by decreasing y
+ */
+struct sorty{
+	bool operator()(const pair<double,double> p1, const pair<double,double> p2) const {
+		return p1.second>p2.second;
+	}
+};
+
+/**
+ * \brief Non dominated set (NDS) of a biobjective optimization.
+ *
+ * Set of vectors (y1,y2) of the objective space, together with the
+ * feasible point realizing each of them, such that no vector is dominated
+ * by another one. The set always contains the two fictitious points
+ * (-oo,+oo) and (+oo,-oo).
+ *
+ * The insertion and the dominance queries can be called concurrently
+ * by several threads. Other algorithms may read the points directly
+ * provided that they hold a #Lock.
+ *
+ * The size of the set can be bounded with an epsilon-grid (see #grid) and
+ * the modifications of the set can be streamed (see #stream).
+ */
+class NonDominatedSet {
+public:
+
+	/**
+	 * \brief Build an empty set (with the two fictitious points).
+	 */
+	NonDominatedSet();
+
+	/**
+	 * \brief Reset the set to the two fictitious points.
+	 *
+	 * The event is written in the stream (if any).
+	 */
+	void clear();
+
+	/**
+	 * \brief True if y is dominated by (or equal to) some point of the set.
+	 */
+	bool is_dominated(const pair<double,double>& y) const;
+
+	/**
+	 * \brief Insert the vector y=f(x).
+	 *
+	 * The vector is inserted if it is not dominated and if its
+	 * distance to the neighbor points is greater than \a min_dist.
+	 * The points dominated by y are removed.
+	 *
+	 * With a grid, the vector is also rejected if the cell of another point
+	 * dominates its cell (or, in the same cell, if it does not dominate this
+	 * point) and the points whose cell is dominated by its cell are removed.
+	 *
+	 * \return true iff y has been inserted.
+	 */
+	bool add(const pair<double,double>& y, const IntervalVector& x, double min_dist);
+
+	/**
+	 * \brief Number of points (including the fictitious ones).
+	 */
+	int size() const;
+
+	/**
+	 * \brief Point minimizing the first objective (so far).
+	 */
+	pair<double,double> y1_ub() const;
+
+	/**
+	 * \brief Point minimizing the second objective (so far).
+	 */
+	pair<double,double> y2_ub() const;
+
+	/**
+	 * \brief The points sorted by increasing y1.
+	 *
+	 * \warning a #Lock is required if other threads may modify the set.
+	 */
+	const map< pair <double, double>, IntervalVector >& points() const;
+
+	/**
+	 * \brief The points sorted by decreasing y2.
+	 *
+	 * \warning a #Lock is required if other threads may modify the set.
+	 */
+	const map< pair <double, double>, IntervalVector, sorty >& points_y() const;
+
+	/**
+	 * \brief Scoped lock of the set.
+	 */
+	class Lock {
+	public:
+		Lock(const NonDominatedSet& s) : s(s) { s.lock(); }
+		~Lock() { s.unlock(); }
+	private:
+		const NonDominatedSet& s;
+	};
+
+	/**
+	 * \brief If true, the removed points are sent to the python plotter.
+	 */
+	bool plot;
+
+	/**
+	 * \brief Size of the cells of the epsilon-grid (0 means no grid).
+	 *
+	 * The objective space is divided into square cells of this size and
+	 * the set keeps at most one point per cell, in cells that are not
+	 * dominated by each other. The size of the set is then bounded by
+	 * (y1_max-y1_min)/grid+1 and every rejected or removed vector y is dominated by y'-(grid,grid) for
+	 * some point y' of the set. So, an approximation of the front with
+	 * precision eps becomes an approximation with precision eps+grid.
+	 */
+	double grid;
+
+	/**
+	 * \brief If not NULL, the insertions and deletions are written in this stream.
+	 *
+	 * One line per event: "+ y1 y2" for an insertion, "- y1 y2" for a deletion
+	 * and "clear" when the set is reset (see #clear()).
+	 */
+	ostream* stream;
+
+protected:
+	void lock() const;
+	void unlock() const;
+
+	/** is_dominated (without lock) */
+	bool _is_dominated(const pair<double,double>& y) const;
+
+	/** The cell of y in the epsilon-grid */
+	pair<double,double> grid_cell(const pair<double,double>& y) const;
+
+	/** True if the vector y of cell b is rejected by the grid (without lock) */
+	bool _is_grid_dominated(const pair<double,double>& b, const pair<double,double>& y) const;
+
+	/** Remove a point */
+	void erase(map< pair <double, double>, IntervalVector >::iterator it);
+
+	/** The points sorted by increasing y1 */
+	map< pair <double, double>, IntervalVector > NDS;
+
+	/** The points sorted by decreasing y2 */
+	map< pair <double, double>, IntervalVector, sorty > NDSy;
+
+	/** Min feasible value found for each objective */
+	pair <double, double> _y1_ub, _y2_ub;
+
+#ifndef _WIN32
+	mutable std::mutex mtx;
+#endif
+
+private:
+	NonDominatedSet(const NonDominatedSet&); // forbidden
+};
+
+/*============================================ inline implementation ============================================ */
+
+inline const map< pair <double, double>, IntervalVector >& NonDominatedSet::points() const {
+	return NDS;
+}
+
+inline const map< pair <double, double>, IntervalVector, sorty >& NonDominatedSet::points_y() const {
+	return NDSy;
+}
+
+inline void NonDominatedSet::lock() const {
+#ifndef _WIN32
+	mtx.lock();
+#endif
+}
+
+inline void NonDominatedSet::unlock() const {
+#ifndef _WIN32
+	mtx.unlock();
+#endif
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_NON_DOMINATED_SET_H__
@@ -0,0 +1,245 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_OptimizerKMOP.cpp
+// Author      : Matias Campusano, Damir Aliquintui, Ignacio Araya
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "ibex_OptimizerKMOP.h"
+#include "ibex_CellMOP.h"
+#include "ibex_Timer.h"
+#include "ibex_NoBisectableVariableException.h"
+
+#include <iostream>
+
+using namespace std;
+
+namespace ibex {
+
+const double OptimizerKMOP::default_eps=0.01;
+
+OptimizerKMOP::OptimizerKMOP(int n, const Array<const Function>& goals,
+		Ctc& ctc, Bsc& bsc, CellBuffer& buffer, LoupFinderMOP& finder, double eps) :
+				n(n), k(goals.size()), goals(goals), ctc(ctc), bsc(bsc), buffer(buffer),
+				finder(finder), eps(eps), trace(false), timeout(-1), status(SUCCESS),
+				nds(goals.size()), time(0), nb_cells(0) {
+
+	if (trace) cout.precision(12);
+}
+
+OptimizerKMOP::~OptimizerKMOP() {
+
+}
+
+Vector OptimizerKMOP::eval_goals(const IntervalVector& x) {
+	//the objectives are set to 0.0
+	IntervalVector xz(x);
+	xz.resize(n+k);
+	for (int i=n; i<n+k; i++)
+		xz[i]=0.0;
+
+	Vector y(k);
+	for (int i=0; i<k; i++)
+		y[i]=goals[i].eval(xz).ub();
+	return y;
+}
+
+bool OptimizerKMOP::update_NDS(const IntervalVector& box) {
+
+	IntervalVector box2(box); box2.resize(n);
+
+	bool new_ub=false;
+	bool flag=true;
+
+	while(flag){
+		IntervalVector vec(n);
+
+		try{
+			vec = finder.find(box2,box2,POS_INFINITY).first;
+		}catch (LoupFinder::NotFound& ) {
+			vec = box2.mid();
+			if(!finder.norm_sys.is_inner(vec)) break;
+			flag=false;
+		}
+
+		Vector eval = eval_goals(vec);
+
+		if (nds.is_dominated(eval)) continue;
+
+		/**** NDS correction ****/
+		if(finder.ub_correction(vec.mid(), vec))
+			eval = eval_goals(vec);
+		else continue;
+
+		// an unbounded vector cannot be compared
+		bool bounded=true;
+		for (int i=0; i<k; i++)
+			if (eval[i]==POS_INFINITY) bounded=false;
+
+		if (!bounded) continue;
+
+		if(nds.add(eval, vec)) new_ub = true;
+
+		if(trace) {cout << eval << "(" << nds.size() << ")" << endl;}
+	}
+
+	return new_ub;
+}
+
+void OptimizerKMOP::dominance_peeler(IntervalVector& box) {
+	Vector l(k);
+	for (int i=0; i<k; i++)
+		l[i]=box[n+i].lb();
+
+	//the box is dominated
+	if (nds.is_dominated(l)) {
+		box.set_empty();
+		return;
+	}
+
+	for (int i=0; i<k; i++) {
+		// the vectors of the box with zi>=z are dominated
+		double z=nds.min_dominating(i,l);
+		if (z < box[n+i].ub())
+			box[n+i] = Interval(box[n+i].lb(), z);
+	}
+}
+
+bool OptimizerKMOP::is_eps_dominated(const IntervalVector& box) const {
+	Vector l(k);
+	for (int i=0; i<k; i++)
+		l[i]=box[n+i].lb()+eps;
+
+	return nds.is_dominated(l);
+}
+
+void OptimizerKMOP::contract_and_bound(Cell& c) {
+
+	dominance_peeler(c.box);
+
+	if (c.box.is_empty()) return;
+
+	ctc.contract(c.box);
+}
+
+OptimizerKMOP::Status OptimizerKMOP::optimize(const IntervalVector& init_box) {
+
+	status=SUCCESS;
+
+	nb_cells=0;
+
+	buffer.flush();
+
+	nds.clear();
+
+	//the box in cells have the n original variables plus the k objective variables
+	Cell* root=new Cell(IntervalVector(n+k));
+
+	root->box=init_box;
+
+	// used by some buffers (see CellSet)
+	IntervalVector xz(init_box);
+	for (int i=n; i<n+k; i++)
+		xz[i]=0.0;
+	CellMOP::y1_init=goals[0].eval(xz);
+	CellMOP::y2_init=goals[1].eval(xz);
+
+	// add data required by the bisector
+	bsc.add_backtrackable(*root);
+
+	// add data required by the buffer
+	buffer.add_backtrackable(*root);
+
+	time=0;
+	Timer timer;
+	timer.start();
+
+	buffer.push(root);
+
+	try {
+		while (!buffer.empty()) {
+
+			if (trace >= 2) cout << buffer;
+
+			Cell *c = buffer.pop();
+
+			nb_cells++;
+
+			contract_and_bound(*c);
+
+			if (c->box.is_empty()) {
+				delete c;
+				continue;
+			}
+
+			update_NDS(c->box);
+
+			if (is_eps_dominated(c->box)) {
+				delete c;
+				continue;
+			}
+
+			try {
+				pair<IntervalVector,IntervalVector> boxes=bsc.bisect(*c);
+				pair<Cell*,Cell*> new_cells=c->bisect(boxes.first,boxes.second);
+				buffer.push(new_cells.first);
+				buffer.push(new_cells.second);
+			}
+			catch (NoBisectableVariableException& ) { }
+
+			delete c;
+
+			if (timeout>0) timer.check(timeout);
+			time = timer.get_time();
+		}
+	}
+	catch (TimeOutException& ) {
+		status = TIME_OUT;
+		cout << "timeout" << endl;
+	}
+
+	timer.stop();
+	time = timer.get_time();
+
+	return status;
+}
+
+void OptimizerKMOP::report(bool verbose) {
+
+	if (!verbose) {
+		cout << endl 	<< "time 	#nodes 		|Y|" << endl;
+		cout << get_time() << " " << get_nb_cells() << " " << nds.size() <<  endl;
+		return;
+	}
+
+	switch(status) {
+		case SUCCESS: cout << "\033[32m" << " optimization successful!" << endl;
+		break;
+		case INFEASIBLE: cout << "\033[31m" << " infeasible problem" << endl;
+		break;
+		case NO_FEASIBLE_FOUND: cout << "\033[31m" << " no feasible point found (the problem may be infesible)" << endl;
+		break;
+		case UNBOUNDED_OBJ: cout << "\033[31m" << " possibly unbounded objective (f*=-oo)" << endl;
+		break;
+		case TIME_OUT: cout << "\033[31m" << " time limit " << timeout << "s. reached " << endl;
+		break;
+		case UNREACHED_PREC: cout << "\033[31m" << " unreached precision" << endl;
+	}
+
+	cout << "\033[0m" << endl;
+
+	cout << " cpu time used: " << get_time() << "s." << endl;
+	cout << " number of cells: " << get_nb_cells() << endl;
+	cout << " number of solutions: "  << nds.size() << endl;
+
+	vector<pair<Vector,IntervalVector> > points;
+	nds.points(points);
+	for (vector<pair<Vector,IntervalVector> >::const_iterator it=points.begin(); it!=points.end(); it++) {
+		cout << it->first << ": " << it->second.mid() << endl;
+	}
+}
+
+} // end namespace ibex
@@ -0,0 +1,244 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_OptimizerKMOP.h
+// Author      : Matias Campusano, Damir Aliquintui, Ignacio Araya
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_OPTIMIZERKMOP_H__
+#define __IBEX_OPTIMIZERKMOP_H__
+
+#include "ibex_Ctc.h"
+#include "ibex_Bsc.h"
+#include "ibex_CellBuffer.h"
+#include "ibex_LoupFinderMOP.h"
+#include "ibex_NDTree.h"
+
+#include <vector>
+
+using namespace std;
+namespace ibex {
+
+/**
+ * \brief Global multi-objective optimizer (k objectives).
+ *
+ * Generalization of #OptimizerMOP to k>=2 objectives f1,...,fk. The
+ * non-dominated set (NDS) is an #NDTree.
+ *
+ * A cell is discarded when it is dominated, i.e., when the lower bound
+ * of its objective variables is dominated by the NDS, or when it is
+ * eps-dominated (the lower bound shifted by eps is dominated). The
+ * dominance peeler of #OptimizerMOP is generalized as follows: the upper
+ * bound of the objective variable zi is reduced to the smallest i-th
+ * component of the NDS points dominating the lower bound of the box on
+ * the other objectives.
+ *
+ * \note For two objectives, #OptimizerMOP is faster and provides more
+ *       filtering techniques (cy-contract, monotonicity test) and a
+ *       multi-threaded search.
+ */
+class OptimizerKMOP {
+
+public:
+
+	/**
+	 * \brief Return status of the optimizer
+	 *
+	 * See comments for optimize(...) below.
+	 */
+	typedef enum {SUCCESS, INFEASIBLE, NO_FEASIBLE_FOUND, UNBOUNDED_OBJ, TIME_OUT, UNREACHED_PREC} Status;
+
+	/**
+	 *  \brief Create an optimizer.
+	 *
+	 * Inputs:
+	 *   \param n        - number of variables of the <b>original system</b>
+	 *   \param goals    - the objective functions (of the form fi - zi)
+	 *   \param ctc      - contractor for <b>extended<b> boxes (of size n+k)
+	 *   \param bsc      - bisector for <b>extended<b> boxes (of size n+k)
+	 *   \param buffer   - buffer for <b>extended<b> boxes (of size n+k)
+	 *   \param finder   - the finder of ub solutions
+	 *   \param eps	     - the required precision
+	 *
+	 * We are assuming that the objective variables are n,...,n+k-1.
+	 *
+	 * The finder only needs to produce feasible points: its two goal functions
+	 * (taken among the k objectives) guide the search of these points.
+	 */
+	OptimizerKMOP(int n, const Array<const Function>& goals,
+			Ctc& ctc, Bsc& bsc, CellBuffer& buffer, LoupFinderMOP& finder, double eps=default_eps);
+
+	/**
+	 * \brief Delete *this.
+	 */
+	virtual ~OptimizerKMOP();
+
+	/**
+	 * \brief Run the optimization.
+	 *
+	 * \param init_box             The initial box
+	 *
+	 * \return SUCCESS             if the NDS has been found (with respect to the precision required).
+	 *
+	 *         TIMEOUT             if time is out.
+	 */
+	Status optimize(const IntervalVector& init_box);
+
+	/* =========================== Output ============================= */
+
+	/**
+	 * \brief Displays on standard output a report of the last call to optimize(...).
+	 *
+	 * See #OptimizerMOP::report(bool).
+	 */
+	void report(bool verbose=true);
+
+	/**
+	 * \brief Get the status.
+	 *
+	 * \return the status of last call to optimize(...).
+	 */
+	Status get_status() const;
+
+	/**
+	 * \brief Get the NDS.
+	 *
+	 * \return the NDS of the last call to optimize(...).
+	 */
+	const NDTree& get_UB() const { return nds; }
+
+	/**
+	 * \brief Get the time spent.
+	 *
+	 * \return the total CPU time of last call to optimize(...)
+	 */
+	double get_time() const;
+
+	/**
+	 * \brief Get the number of cells.
+	 *
+	 * \return the number of cells generated by the last call to optimize(...).
+	 */
+	double get_nb_cells() const;
+
+	/* =========================== Settings ============================= */
+
+	/**
+	 * \brief Number of variables.
+	 */
+	const int n;
+
+	/**
+	 * \brief Number of objectives.
+	 */
+	const int k;
+
+	/**
+	 * \brief Objective functions
+	 * Functions have the form: fi - zi. Thus, in order to
+	 * evaluate them we have to set the zi to [0,0].
+	 */
+	Array<const Function> goals;
+
+	/**
+	 * \brief Contractor for the extended system.
+	 */
+	Ctc& ctc;
+
+	/**
+	 * \brief Bisector.
+	 *
+	 * Must work on extended boxes.
+	 */
+	Bsc& bsc;
+
+	/**
+	 * Cell buffer.
+	 */
+	CellBuffer& buffer;
+
+	/**
+	 * \brief LoupFinder
+	 */
+	LoupFinderMOP& finder;
+
+	/** Required precision for the envelope */
+	double eps;
+
+	/** Default precision: 0.01 */
+	static const double default_eps;
+
+	/**
+	 * \brief Trace activation flag.
+	 */
+	int trace;
+
+	/**
+	 * \brief Time limit.
+	 *
+	 * Maximum CPU time used by the strategy.
+	 */
+	double timeout;
+
+protected:
+
+	/**
+	 * \brief Contract and bound procedure for processing a box.
+	 *
+	 * <ul>
+	 * <li> contract the box using #dominance_peeler(),
+	 * <li> contract with the contractor ctc,
+	 * </ul>
+	 */
+	void contract_and_bound(Cell& c);
+
+	/**
+	 * \brief The box is reduced using the NDS (see above).
+	 */
+	void dominance_peeler(IntervalVector& box);
+
+	/**
+	 * \brief Main procedure for updating the NDS.
+	 *
+	 * Same as #OptimizerMOP::update_NDS(const IntervalVector&).
+	 */
+	bool update_NDS(const IntervalVector& box);
+
+	/**
+	 * \brief True if all the vectors of the objective space
+	 * of the box are eps-dominated.
+	 */
+	bool is_eps_dominated(const IntervalVector& box) const;
+
+private:
+
+	/**
+	 * \brief Evaluate the goals in the point x (upper bounds).
+	 */
+	Vector eval_goals(const IntervalVector& x);
+
+	/* Remember return status of the last optimization. */
+	Status status;
+
+	/** The non-dominated set */
+	NDTree nds;
+
+	/* CPU running time of the current optimization. */
+	double time;
+
+	/** Number of cells pushed into the heap (which passed through the contractors) */
+	int nb_cells;
+};
+
+inline OptimizerKMOP::Status OptimizerKMOP::get_status() const { return status; }
+
+inline double OptimizerKMOP::get_time() const { return time; }
+
+inline double OptimizerKMOP::get_nb_cells() const { return nb_cells; }
+
+} // end namespace ibex
+
+#endif // __IBEX_OPTIMIZERKMOP_H__
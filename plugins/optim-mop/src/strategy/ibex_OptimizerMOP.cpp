@@ -19,6 +19,13 @@
 #include <iostream>
 //#include "ibex_CellSet.h"
 
+#ifndef _WIN32 // MinGW does not support threads
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#endif
+
 using namespace std;
 
 namespace ibex {
@@ -32,13 +39,11 @@ bool OptimizerMOP::_cy_upper =false;
 bool OptimizerMOP::cy_contract_var = false;
 bool OptimizerMOP::_eps_contract = false;
 
-map< pair <double, double>, IntervalVector > OptimizerMOP::NDS;
-
 OptimizerMOP::OptimizerMOP(int n, const Function &f1,  const Function &f2,
 		Ctc& ctc, Bsc& bsc, CellBufferOptim& buffer, LoupFinderMOP& finder,double eps) : n(n),
                 				ctc(ctc), bsc(bsc), buffer(buffer), goal1(f1), goal2(f2),
-								finder(finder), trace(false), timeout(-1), status(SUCCESS),
-                				time(0), nb_cells(0), eps(eps)
+								finder(finder), trace(false), timeout(-1), nds_grid(0), nds_stream(NULL), status(SUCCESS),
+                				time(0), nb_cells(0), eps(eps), nds(&_nds), plot(false)
 								 {
 
 	py_Plotter::n=n;
@@ -51,6 +56,10 @@ OptimizerMOP::~OptimizerMOP() {
 
 }
 
+void OptimizerMOP::add_worker(OptimizerMOP& worker) {
+	workers.push_back(&worker);
+}
+
 
 Interval OptimizerMOP::eval_goal(const Function& goal, IntervalVector& x){
 	//the objectives are set to 0.0
@@ -63,15 +72,7 @@ Interval OptimizerMOP::eval_goal(const Function& goal, IntervalVector& x){
 }
 
 bool OptimizerMOP::is_dominated(pair< double, double>& eval){
-	std::map<pair<double, double>, IntervalVector>::iterator it2 = NDS.lower_bound(eval);
-
-	//there is an equivalent point
-	if(it2->first == eval) return true;
-	it2--;
-	//it is dominated by the previous ub point
-	if(eval.second >= it2->first.second) return true;
-
-	return false;
+	return nds->is_dominated(eval);
 }
 
 bool OptimizerMOP::update_NDS(const IntervalVector& box) {
@@ -119,51 +120,14 @@ bool OptimizerMOP::update_NDS(const IntervalVector& box) {
 
 		/**** end NDS correction ****/
 
-		bool domine=false;
-		std::map<pair<double, double>, IntervalVector>::iterator it2 = NDS.lower_bound(eval);
-
-		for(; it2!=NDS.end(); ){
-
-			if(eval.second > it2->first.second) break;
-			std::map<pair<double, double>, IntervalVector>::iterator aux = it2;
-			++aux;
-			if(_plot)	py_Plotter::plot_del_ub(it2->first);
-
-			NDSy.erase(it2->first);
-			NDS.erase(it2);
-			it2 = aux;
-			domine=true;
-		}
-
-
 		//the point is inserted in NDS only if its distance to the neighbor points is greater than (abs_eps/2.0)
-		if(domine || std::min(it2->first.first - eval.first,  eval.second - it2->first.second) >= _min_ub_dist*eps){
-			//it is not dominated and we remove the new dominated points
-
-			if(eval.first < y1_ub.first) y1_ub=eval;
-			if(eval.second < y2_ub.second) y2_ub=eval;
-
-			NDS.insert(make_pair(eval, vec));
-			NDSy.insert(make_pair(eval, vec));
-			//cout << "passed" << endl;
+		//and we remove the new dominated points
+		if(nds->add(eval, vec, _min_ub_dist*eps)) {
 			new_ub = true;
-		}else{
-			it2--;
-			if( std::min(eval.first - it2->first.first,  it2->first.second - eval.second) >= _min_ub_dist*eps ){
-				//it is not dominated and we remove the new dominated points
-
-				if(eval.first < y1_ub.first) y1_ub=eval;
-				if(eval.second < y2_ub.second) y2_ub=eval;
-
-				NDS.insert(make_pair(eval, vec));
-				NDSy.insert(make_pair(eval, vec));
-				//cout << "passed" << endl;
-				new_ub = true;
-			}
+			if(plot) py_Plotter::plot_add_ub(eval);
 		}
 
-		if(_plot && new_ub) py_Plotter::plot_add_ub(eval);
-		if(trace) {cout << eval.first  <<"," << eval.second << "(" << NDS.size() << ")" << endl;}
+		if(trace) {cout << eval.first  <<"," << eval.second << "(" << nds->size() << ")" << endl;}
 
 	}
 
@@ -251,8 +215,11 @@ void OptimizerMOP::dominance_peeler(IntervalVector& box){
 	valueZ1.first = NEG_INFINITY;
 	valueZ2.second = NEG_INFINITY;
 
+	NonDominatedSet::Lock lock(*nds);
+	const map< pair <double, double>, IntervalVector >& NDS=nds->points();
+	const map< pair <double, double>, IntervalVector, sorty >& NDSy=nds->points_y();
 
-	map< pair <double, double>, IntervalVector >:: iterator ent1=NDS.upper_bound(make_pair(box[n].lb(),POS_INFINITY /*box[n+1].lb()*/));
+	map< pair <double, double>, IntervalVector >:: const_iterator ent1=NDS.upper_bound(make_pair(box[n].lb(),POS_INFINITY /*box[n+1].lb()*/));
     ent1--;
 
     //z1 < box[n].lb()
@@ -270,7 +237,7 @@ void OptimizerMOP::dominance_peeler(IntervalVector& box){
 	}
 
 
-	map< pair <double, double>, IntervalVector, sorty>:: iterator ent2=NDSy.lower_bound(make_pair(NEG_INFINITY,box[n+1].lb()));
+	map< pair <double, double>, IntervalVector, sorty>:: const_iterator ent2=NDSy.lower_bound(make_pair(NEG_INFINITY,box[n+1].lb()));
 	if(ent2==NDSy.end()) return;
 
 	valueZ2 = ent2->first;
@@ -286,9 +253,14 @@ void OptimizerMOP::cy_contract(Cell& c){
 	IntervalVector& box = c.box;
 	IntervalVector box3(box);
 	box3.resize(n+4);
-	map< pair <double, double>, IntervalVector >::iterator it = NDS.upper_bound(make_pair(box[n].lb(), NEG_INFINITY));
+
+	{ // the NDS is locked while it is read
+	NonDominatedSet::Lock lock(*nds);
+	const map< pair <double, double>, IntervalVector >& NDS=nds->points();
+
+	map< pair <double, double>, IntervalVector >::const_iterator it = NDS.upper_bound(make_pair(box[n].lb(), NEG_INFINITY));
 	it--;
-	map< pair <double, double>, IntervalVector >::iterator it2 = NDS.lower_bound(make_pair(box[n].ub(), NEG_INFINITY));
+	map< pair <double, double>, IntervalVector >::const_iterator it2 = NDS.lower_bound(make_pair(box[n].ub(), NEG_INFINITY));
 
     if(it->first.first != NEG_INFINITY && it2->first.second != NEG_INFINITY && it->first!=it2->first){
     	box3[n+3] = (it2->first.first-it->first.first)/(it->first.second-it2->first.second);
@@ -327,6 +299,8 @@ void OptimizerMOP::cy_contract(Cell& c){
 	  }
 
 		box3[n+2] = Interval(NEG_INFINITY, w_ub); // w
+	}
+
 		//the contraction is performed
 		ctc.contract(box3);
 		c.get<CellMOP>().a = box3[n+3].mid();
@@ -356,6 +330,190 @@ void OptimizerMOP::contract_and_bound(Cell& c, const IntervalVector& init_box) {
 
 }
 
+bool OptimizerMOP::process(Cell* c, const IntervalVector& init_box, pair<Cell*,Cell*>& new_cells) {
+
+	contract_and_bound(*c, init_box);
+
+	if (c->box.is_empty()) {
+		delete c;
+		return false;
+	}
+
+	bool loup_ch=update_NDS(c->box);
+
+
+
+
+	pair<IntervalVector,IntervalVector>* boxes=NULL;
+	bool atomic_box=false;
+	try {
+		boxes=new pair<IntervalVector,IntervalVector>(bsc.bisect(*c));
+	}
+	catch (NoBisectableVariableException& ) {
+		atomic_box=true;
+	}
+
+
+	double dist=0.0;
+	if(!atomic_box /*&& eps>0.0*/) dist=distance2(c);
+
+
+	// with an epsilon-grid, the NDS is only known up to the size of the cells
+	if(dist < eps + nds->grid || atomic_box){
+		if(dist <0.0){
+			delete c;
+			return false;
+		}
+
+		if(plot) py_Plotter::plot_add_lb(c);
+
+		{
+			NonDominatedSet::Lock lock(*nds);
+			map< pair <double, double>, IntervalVector >:: const_iterator ent1=nds->points().upper_bound(make_pair(c->box[n].lb(),c->box[n+1].lb()));
+			ent1--;
+			if(ent1->first.second <= c->box[n+1].lb()){
+				delete c;
+				return false;
+			}
+		}
+
+
+
+
+		if(boxes) delete boxes;
+		delete c; return false;
+
+	}
+
+	pair <double, double> y1_ub=nds->y1_ub();
+	pair <double, double> y2_ub=nds->y2_ub();
+
+  /** Improvement for avoiding big boxes when lb1 < y1_ub or lb2< y2_ub*/
+  IntervalVector left(c->box);
+  if(c->box[n].lb() < y1_ub.first && c->box[n].ub() > y1_ub.first &&
+		  (c->box[n].ub()-y1_ub.first)*(c->box[n+1].ub()-y1_ub.second) <  (c->box[n].diam())*(c->box[n+1].diam()) ){
+
+	 left[n]=Interval(c->box[n].lb(),y1_ub.first);
+	 c->box[n]=Interval(y1_ub.first,c->box[n].ub());
+  }else left.set_empty();
+
+	if(!left.is_empty())
+		  new_cells=c->bisect(left,c->box);
+	else{
+		IntervalVector bottom(c->box);
+  	if(c->box[n+1].lb() < y2_ub.second && c->box[n+1].ub() > y2_ub.second  &&
+  			(c->box[n].ub()-y2_ub.first)*(c->box[n+1].ub()-y2_ub.second) <  (c->box[n].diam())*(c->box[n+1].diam()) ) {
+			bottom[n+1]=Interval(c->box[n+1].lb(),y2_ub.second);
+			c->box[n+1]=Interval(y2_ub.second,c->box[n+1].ub());
+		}else bottom.set_empty();
+
+		if(!bottom.is_empty())
+		  new_cells=c->bisect(bottom,c->box);
+		else
+		 new_cells=c->bisect(boxes->first,boxes->second); //originally we should do only do this
+	}
+  /****/
+
+	delete boxes;
+	delete c; // deletes the cell.
+
+	return true;
+}
+
+#ifndef _WIN32
+
+class OptimizerMOP::Search {
+public:
+	Search(CellBuffer& buffer, Timer& timer) : buffer(buffer), timer(timer), busy(0),
+			nb_cells(0), stop(false), timeout(false) { }
+
+	CellBuffer& buffer;
+	Timer& timer;
+	std::mutex mtx;               // protects all the fields
+	std::condition_variable cv;   // signaled when cells are pushed or the search ends
+	int busy;                     // number of threads processing a cell
+	int nb_cells;                 // number of cells popped
+	bool stop;                    // true when the threads must terminate
+	bool timeout;                 // true if the time is out
+	std::exception_ptr error;     // exception raised by a thread (if any)
+};
+
+void OptimizerMOP::work(Search& s, const IntervalVector& init_box) {
+	try {
+		while (true) {
+			Cell* c;
+			{
+				std::unique_lock<std::mutex> lock(s.mtx);
+
+				// wait until there is a cell to process, unless all the
+				// other threads are idle (the search is over)
+				while (!s.stop && s.buffer.empty() && s.busy>0)
+					s.cv.wait(lock);
+
+				if (s.stop || s.buffer.empty()) {
+					s.stop=true;
+					s.cv.notify_all();
+					return;
+				}
+
+				c = s.buffer.pop();
+				s.nb_cells++;
+				s.busy++;
+			}
+
+			pair<Cell*,Cell*> new_cells;
+			bool bisected=process(c, init_box, new_cells);
+
+			{
+				std::lock_guard<std::mutex> lock(s.mtx);
+				s.busy--;
+				if (bisected) {
+					s.buffer.push(new_cells.first);
+					s.buffer.push(new_cells.second);
+				}
+				if (timeout>0) s.timer.check(timeout);
+			}
+			s.cv.notify_all();
+		}
+	} catch (TimeOutException&) {
+		std::lock_guard<std::mutex> lock(s.mtx);
+		s.timeout=true;
+		s.stop=true;
+		s.cv.notify_all();
+	} catch (...) {
+		std::lock_guard<std::mutex> lock(s.mtx);
+		if (!s.error) s.error=std::current_exception();
+		s.stop=true;
+		s.cv.notify_all();
+	}
+}
+
+void OptimizerMOP::search_parallel(const IntervalVector& init_box, Timer& timer) {
+	Search s(buffer, timer);
+
+	vector<std::thread> threads;
+	for (vector<OptimizerMOP*>::iterator it=workers.begin(); it!=workers.end(); it++)
+		threads.push_back(std::thread(&OptimizerMOP::work, *it, std::ref(s), std::cref(init_box)));
+
+	work(s, init_box);
+
+	for (vector<std::thread>::iterator it=threads.begin(); it!=threads.end(); it++)
+		it->join();
+
+	nb_cells=s.nb_cells;
+
+	if (s.error) std::rethrow_exception(s.error);
+	if (s.timeout) throw TimeOutException();
+}
+
+#else
+
+void OptimizerMOP::search_parallel(const IntervalVector& init_box, Timer& timer) {
+	ibex_error("OptimizerMOP: multi-threaded search not supported on this platform");
+}
+
+#endif
+
 OptimizerMOP::Status OptimizerMOP::optimize(const IntervalVector& init_box) {
 
 	status=SUCCESS;
@@ -365,11 +523,21 @@ OptimizerMOP::Status OptimizerMOP::optimize(const IntervalVector& init_box) {
 
 	buffer.flush();
 
-	NDS.clear();
-	//the first point
-	NDS.insert(make_pair(make_pair(NEG_INFINITY,POS_INFINITY), Vector(1)));
-	//the last point
-	NDS.insert(make_pair(make_pair(POS_INFINITY,NEG_INFINITY), Vector(1)));
+	// the plot is not thread-safe
+	plot = _plot && workers.empty();
+	nds->plot = plot;
+	nds->grid = nds_grid;
+	nds->stream = nds_stream;
+
+	nds->clear();
+
+	for (vector<OptimizerMOP*>::iterator it=workers.begin(); it!=workers.end(); it++) {
+		(*it)->nds = nds;
+		(*it)->plot = false;
+	}
+
+	DistanceSortedCellBufferMOP* dbuffer=dynamic_cast<DistanceSortedCellBufferMOP*>(&buffer);
+	if (dbuffer) dbuffer->optim=this;
 
 	//the box in cells have the n original variables plus the two objective variables (y1 and y2)
 	Cell* root=new Cell(IntervalVector(n+2));
@@ -379,9 +547,6 @@ OptimizerMOP::Status OptimizerMOP::optimize(const IntervalVector& init_box) {
 	CellMOP::y1_init=eval_goal(goal1, root->box);
 	CellMOP::y2_init=eval_goal(goal2, root->box);
 
-	y1_ub.first=POS_INFINITY;
-	y2_ub.second=POS_INFINITY;
-
 
 	// add data required by the bisector
 	bsc.add_backtrackable(*root);
@@ -395,9 +560,12 @@ OptimizerMOP::Status OptimizerMOP::optimize(const IntervalVector& init_box) {
 
 	//handle_cell(*root,init_box);
 	buffer.push(root);
-	if(_plot) py_Plotter::plot_add_box(root);
+	if(plot) py_Plotter::plot_add_box(root);
 
 	try {
+		if (!workers.empty())
+			search_parallel(init_box, timer);
+		else
 		/** Criterio de termino: todas los nodos filtrados*/
 		while (!buffer.empty()) {
 
@@ -405,97 +573,21 @@ OptimizerMOP::Status OptimizerMOP::optimize(const IntervalVector& init_box) {
 
 
 			Cell *c = buffer.pop();
-			if(_plot) py_Plotter::plot_del_box(c);
+			if(plot) py_Plotter::plot_del_box(c);
 
 
 			nb_cells++;
 
+			pair<Cell*,Cell*> new_cells;
 
-			contract_and_bound(*c, init_box);
-
-			if (c->box.is_empty()) {
-				delete c;
-				continue;
-			}
-
-			bool loup_ch=update_NDS(c->box);
-
-
-
-
-			pair<IntervalVector,IntervalVector>* boxes=NULL;
-			bool atomic_box=false;
-			try {
-				boxes=new pair<IntervalVector,IntervalVector>(bsc.bisect(*c));
-			}
-			catch (NoBisectableVariableException& ) {
-				atomic_box=true;
-			}
-
-
-        	double dist=0.0;
-        	if(!atomic_box /*&& eps>0.0*/) dist=distance2(c);
-
-
-        	if(dist < eps || atomic_box){
-        		if(dist <0.0){
-        			delete c;
-        			continue;
-        		}
-
-        		if(_plot) py_Plotter::plot_add_lb(c);
-
-        		map< pair <double, double>, IntervalVector >:: iterator ent1=NDS.upper_bound(make_pair(c->box[n].lb(),c->box[n+1].lb()));
-        		ent1--;
-        		if(ent1->first.second <= c->box[n+1].lb()){
-        			delete c;
-        			continue;
-        		}
-
-
-
-
-        		if(boxes) delete boxes;
-				delete c; continue;
-
-			}
-
-      /** Improvement for avoiding big boxes when lb1 < y1_ub or lb2< y2_ub*/
-		  IntervalVector left(c->box);
-		  if(c->box[n].lb() < y1_ub.first && c->box[n].ub() > y1_ub.first &&
-				  (c->box[n].ub()-y1_ub.first)*(c->box[n+1].ub()-y1_ub.second) <  (c->box[n].diam())*(c->box[n+1].diam()) ){
-
-			 left[n]=Interval(c->box[n].lb(),y1_ub.first);
-			 c->box[n]=Interval(y1_ub.first,c->box[n].ub());
-		  }else left.set_empty();
-
-         pair<Cell*,Cell*> new_cells;
-			if(!left.is_empty())
-				  new_cells=c->bisect(left,c->box);
-			else{
-				IntervalVector bottom(c->box);
-		  	if(c->box[n+1].lb() < y2_ub.second && c->box[n+1].ub() > y2_ub.second  &&
-		  			(c->box[n].ub()-y2_ub.first)*(c->box[n+1].ub()-y2_ub.second) <  (c->box[n].diam())*(c->box[n+1].diam()) ) {
-					bottom[n+1]=Interval(c->box[n+1].lb(),y2_ub.second);
-					c->box[n+1]=Interval(y2_ub.second,c->box[n+1].ub());
-				}else bottom.set_empty();
-
-				if(!bottom.is_empty())
-				  new_cells=c->bisect(bottom,c->box);
-				else
-				 new_cells=c->bisect(boxes->first,boxes->second); //originally we should do only do this
-			}
-      /****/
-
-    	delete boxes;
-			delete c; // deletes the cell.
+			if (!process(c, init_box, new_cells)) continue;
 
 			buffer.push(new_cells.first);
-			if(_plot) py_Plotter::plot_add_box(new_cells.first);
+			if(plot) py_Plotter::plot_add_box(new_cells.first);
 
 			buffer.push(new_cells.second);
 
-			if(_plot) py_Plotter::plot_add_box(new_cells.second);
+			if(plot) py_Plotter::plot_add_box(new_cells.second);
 
 
 
@@ -517,7 +609,7 @@ OptimizerMOP::Status OptimizerMOP::optimize(const IntervalVector& init_box) {
 	time = timer.get_time();
 
 
-	if(_plot) py_Plotter::offline_plot(NULL, NDS);
+	if(plot) py_Plotter::offline_plot(NULL, nds->points());
 	return status;
 }
 
@@ -525,7 +617,7 @@ void OptimizerMOP::report(bool verbose) {
 
 	if (!verbose) {
         cout << endl 	<< "time 	#nodes 		|Y|" << endl;
-		cout << get_time() << " " << get_nb_cells() << " " << NDS.size() <<  endl;
+		cout << get_time() << " " << get_nb_cells() << " " << nds->size() <<  endl;
 		return;
 	}
 
@@ -547,14 +639,14 @@ void OptimizerMOP::report(bool verbose) {
 
 	cout << " cpu time used: " << get_time() << "s." << endl;
 	cout << " number of cells: " << get_nb_cells() << endl;
-	cout << " number of solutions: "  << NDS.size() << endl;
+	cout << " number of solutions: "  << nds->size() << endl;
 
-	for(auto ub : NDS){
+	for(auto ub : nds->points()){
 		cout << "(" << ub.first.first << "," << ub.first.second << "): " << ub.second.mid() << endl;
 	}
 }
 
-double OptimizerMOP::distance2(const Cell* c){
+double OptimizerMOP::distance2(const Cell* c) const {
 	double max_dist=NEG_INFINITY;
 
 	int n=c->box.size();
@@ -565,7 +657,10 @@ double OptimizerMOP::distance2(const Cell* c){
 	double a = c->get<CellMOP>().a;
 	double w_lb = c->get<CellMOP>().w_lb;
 
-	map< pair <double, double>, IntervalVector >::iterator it = NDS.lower_bound(make_pair(z1.lb(),-NEG_INFINITY)); //NDS.begin();
+	NonDominatedSet::Lock lock(*nds);
+	const map< pair <double, double>, IntervalVector >& NDS=nds->points();
+
+	map< pair <double, double>, IntervalVector >::const_iterator it = NDS.lower_bound(make_pair(z1.lb(),-NEG_INFINITY)); //NDS.begin();
 	it--;
 
 	for(;it!=NDS.end(); ){
@@ -12,32 +12,24 @@
 #define __IBEX_OPTIMIZERMOP_H__
 
 #include "ibex_Ctc.h"
+#include "ibex_Timer.h"
 #include "ibex_Bsc.h"
 #include "ibex_LoupFinderMOP.h"
 #include "ibex_CellMOP.h"
 #include "ibex_CtcKhunTucker.h"
 #include "ibex_DistanceSortedCellBufferMOP.h"
 #include "ibex_pyPlotter.h"
+#include "ibex_NonDominatedSet.h"
 
 #include <set>
 #include <map>
 #include <list>
+#include <vector>
 //#include "ibex_DistanceSorted.h"
 
 using namespace std;
 namespace ibex {
 
-/**
- * comparation function for sorting NDS by decreasing y
- */
-struct sorty{
-	bool operator()(const pair<double,double> p1, const pair<double,double> p2){
-		return p1.second>p2.second;
-	}
-};
-
-
-
 /**
  * \brief Global biObjetive Optimizer (ibexMOP).
  *
@@ -88,6 +80,23 @@ public:
 	 */
 	virtual ~OptimizerMOP();
 
+	/**
+	 * \brief Add a worker for the multi-threaded search.
+	 *
+	 * If workers are added, optimize(...) runs one thread for this
+	 * optimizer and one for each worker. The threads contract and bisect
+	 * cells independently. They share the buffer of this optimizer and its NDS.
+	 *
+	 * Since functions and contractors are not thread-safe, the worker must be
+	 * built with its own objective functions, contractor, bisector and finder
+	 * (typically, on another copy of the system). The bisector must be of the
+	 * same type as the one of this optimizer. The buffer of the worker is not used.
+	 *
+	 * \warning The plot is disabled in a multi-threaded search and the
+	 *          time is the CPU time of all the threads.
+	 */
+	void add_worker(OptimizerMOP& worker);
+
 	/**
 	 * \brief Run the optimization.
 	 *
@@ -129,7 +138,7 @@ public:
 	 *
 	 * \return the UB of the last call to optimize(...).
 	 */
-	map< pair <double, double>, IntervalVector >& get_UB()  { return NDS; }
+	const map< pair <double, double>, IntervalVector >& get_UB() const { return nds->points(); }
 
 	//std::set< point2 >& get_LB()  { return LB; }
 
@@ -150,7 +159,7 @@ public:
 	/**
 	 * \brief returns the distance from the box to the current NDS
 	 */
-	static double distance2(const Cell* c);
+	double distance2(const Cell* c) const;
 
 	/* =========================== Settings ============================= */
 
@@ -213,6 +222,20 @@ public:
 	 */
 	double timeout;
 
+	/**
+	 * \brief Size of the cells of the epsilon-grid bounding the NDS.
+	 *
+	 * 0 for no grid (default value). See NonDominatedSet::grid.
+	 */
+	double nds_grid;
+
+	/**
+	 * \brief Stream of the modifications of the NDS.
+	 *
+	 * NULL for no stream (default value). See NonDominatedSet::stream.
+	 */
+	ostream* nds_stream;
+
 
 	/* ======== Some other parameters of the solver =========== */
 
@@ -294,31 +317,53 @@ protected:
 	 */
 	bool update_NDS(const IntervalVector& box);
 
+	/**
+	 * \brief Process a cell popped from the buffer.
+	 *
+	 * Contract the cell, update the NDS and bisect the cell.
+	 *
+	 * \return true if the cell has been bisected into \a new_cells, false if it has been discarded.
+	 *         In both cases, \a c is deleted.
+	 */
+	bool process(Cell* c, const IntervalVector& init_box, pair<Cell*,Cell*>& new_cells);
 
-private:
+	/**
+	 * Data shared by the threads of a multi-threaded search.
+	 */
+	class Search;
 
 	/**
-	 * \brief Evaluate the goal in the point x
+	 * \brief Main loop of a thread in a multi-threaded search.
 	 */
-	Interval eval_goal(const Function& goal, IntervalVector& x);
+	void work(Search& s, const IntervalVector& init_box);
 
 	/**
-	 * min feasible value found for each objective
+	 * \brief Multi-threaded search (this optimizer and the workers).
 	 */
-    pair <double, double> y1_ub, y2_ub;
+	void search_parallel(const IntervalVector& init_box, Timer& timer);
+
+
+private:
+
+	/**
+	 * \brief Evaluate the goal in the point x
+	 */
+	Interval eval_goal(const Function& goal, IntervalVector& x);
 
 	/* Remember return status of the last optimization. */
 	Status status;
 
+	/** The non-dominated set of this optimizer */
+	NonDominatedSet _nds;
 
+	/** The current non-dominated set (the one of the main optimizer for a worker) */
+	NonDominatedSet* nds;
 
-	//TODO: this should not be static
-
-	/** The current non-dominated set sorted by increasing x */
-	static map< pair <double, double>, IntervalVector > NDS;
+	/** The workers of the multi-threaded search */
+	vector<OptimizerMOP*> workers;
 
-	/** The current non-dominated set sorted by decreasing y */
-	map< pair <double, double>, IntervalVector, sorty > NDSy;
+	/** Whether the search is plotted */
+	bool plot;
 
 
 	/* CPU running time of the current optimization. */
@@ -41,7 +41,7 @@ void py_Plotter::plot_del_box(Cell* c){
 	std::cout << "del: {\"id\":" << c->get<CellMOP>().id;
 	std::cout << "}" << endl;
 }
-void py_Plotter::offline_plot(Cell* c, map< pair <double, double>, IntervalVector >& NDS){
+void py_Plotter::offline_plot(Cell* c, const map< pair <double, double>, IntervalVector >& NDS){
 	ofstream output;
 	output.open("output.txt");
 	//set<  Cell* > :: iterator cell=buffer_cells.begin();
@@ -69,7 +69,7 @@ void py_Plotter::offline_plot(Cell* c, map< pair <double, double>, IntervalVecto
 
 	output << "[";
 
-	map< pair <double, double>, IntervalVector > :: iterator ub=NDS.begin();
+	map< pair <double, double>, IntervalVector > :: const_iterator ub=NDS.begin();
 	for(;ub!=NDS.end();ub++){
 		output << "(" << ub->first.first << "," << ub->first.second << "),";
 	}
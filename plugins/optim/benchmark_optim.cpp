@@ -164,6 +164,18 @@ main (int argc, char *argv[])
 		if (!sys.goal)
 			ibex_error ("input file does not contains an optimization problem.");
 
+		/* Report the subexpressions shared by the constraints */
+		if (sys.nb_ctr > 0)
+		{
+			CtcSharedHC4 shc4 (sys);
+			IntervalVector box (sys.box);
+			shc4.contract (box);
+			cout << "# INFO: shared DAG: " << shc4.nb_nodes () << " nodes ("
+			     << shc4.nb_nodes_unshared () << " without sharing), "
+			     << shc4.nb_evals () << " node evaluations in HC4 ("
+			     << shc4.nb_evals_unshared () << " without sharing)" << endl;
+		}
+
 		/* always bench prec_min */
 		bool has_timeout = do_benchs_iter (sys, prec_min, time_limit, iter);
 		if (!has_timeout)
@@ -41,6 +41,9 @@ int main(int argc, char** argv) {
 	args::ValueFlag<double> random_seed(parser, "float", _random_seed.str(), {"random-seed"});
 	args::ValueFlag<double> eps_x(parser, "float", _eps_x.str(), {"eps-x"});
 	args::ValueFlag<double> initial_loup(parser, "float", "Intial \"loup\" (a priori known upper bound).", {"initial-loup"});
+	args::ValueFlag<string> cache(parser, "directory", "Directory of precompiled models. The system is loaded from "
+			"this directory if the MINIBEX file has already been compiled, and saved there otherwise. The normalized "
+			"and extended systems used by the optimizer are cached too, with the linear part of their Jacobian.", {"cache"});
 	args::Flag rigor(parser, "rigor", "Activate rigor mode (certify feasibility of equalities).", {"rigor"});
 	args::Flag trace(parser, "trace", "Activate trace. Updates of loup/uplo are printed while minimizing.", {"trace"});
 	args::Flag format(parser, "format", "Display the output format in quiet mode", {"format"});
@@ -102,8 +105,9 @@ int main(int argc, char** argv) {
 
 	try {
 
-		// Load a system of equations
-		System sys(filename.Get().c_str());
+		// Load a system of equations (without parsing if precompiled)
+		ModelCache models(cache ? cache.Get().c_str() : NULL);
+		System& sys=models.system(filename.Get().c_str());
 
 		if (!sys.goal) {
 			ibex_error(" input file has not goal (it is not an optimization problem).");
@@ -157,11 +161,16 @@ int main(int argc, char** argv) {
 			inHC4=false;
 		}
 
+		// The normalized and extended systems (and their derivatives)
+		// are also taken from the cache
+		double _eps_h=eps_h ? eps_h.Get() : NormalizedSystem::default_eps_h;
+
 		// Build the default optimizer
 		DefaultOptimizer o(sys,
+				models.normalized_system(filename.Get().c_str(), _eps_h),
+				models.extended_system(filename.Get().c_str(), _eps_h),
 				rel_eps_f? rel_eps_f.Get() : Optimizer::default_rel_eps_f,
 				abs_eps_f? abs_eps_f.Get() : Optimizer::default_abs_eps_f,
-				eps_h ?    eps_h.Get() :     NormalizedSystem::default_eps_h,
 				rigor, inHC4,
 				random_seed? random_seed.Get() : DefaultOptimizer::default_random_seed,
 				eps_x ?    eps_x.Get() :     Optimizer::default_eps_x
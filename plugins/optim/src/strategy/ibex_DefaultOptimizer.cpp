@@ -42,16 +42,20 @@ const double DefaultOptimizer::default_random_seed = 1.0;
 // arguments of the base class constructor (ctc, bsc, loup finder, etc.)
 // and we don't know which argument is evaluated first
 
-NormalizedSystem& DefaultOptimizer::get_norm_sys(const System& sys, double eps_h) {
-	if (found(NORMALIZED_SYSTEM_TAG)) {
+NormalizedSystem& DefaultOptimizer::get_norm_sys(NormalizedSystem* norm_sys, const System& sys, double eps_h) {
+	if (norm_sys) {
+		return *norm_sys;
+	} else if (found(NORMALIZED_SYSTEM_TAG)) {
 		return get<NormalizedSystem>(NORMALIZED_SYSTEM_TAG);
 	} else {
 		return rec(new NormalizedSystem(sys,eps_h), NORMALIZED_SYSTEM_TAG);
 	}
 }
 
-ExtendedSystem& DefaultOptimizer::get_ext_sys(const System& sys, double eps_h) {
-	if (found(EXTENDED_SYSTEM_TAG)) {
+ExtendedSystem& DefaultOptimizer::get_ext_sys(ExtendedSystem* ext_sys, const System& sys, double eps_h) {
+	if (ext_sys) {
+		return *ext_sys;
+	} else if (found(EXTENDED_SYSTEM_TAG)) {
 		return get<ExtendedSystem>(EXTENDED_SYSTEM_TAG);
 	} else {
 		return rec(new ExtendedSystem(sys,eps_h), EXTENDED_SYSTEM_TAG);
@@ -59,18 +63,28 @@ ExtendedSystem& DefaultOptimizer::get_ext_sys(const System& sys, double eps_h) {
 }
 
 DefaultOptimizer::DefaultOptimizer(const System& sys, double rel_eps_f, double abs_eps_f, double eps_h, bool rigor, bool inHC4, double random_seed, double eps_x) :
+		DefaultOptimizer(NULL, NULL, sys, rel_eps_f, abs_eps_f, eps_h, rigor, inHC4, random_seed, eps_x) {
+
+}
+
+DefaultOptimizer::DefaultOptimizer(const System& sys, NormalizedSystem& norm_sys, ExtendedSystem& ext_sys, double rel_eps_f, double abs_eps_f, bool rigor, bool inHC4, double random_seed, double eps_x) :
+		DefaultOptimizer(&norm_sys, &ext_sys, sys, rel_eps_f, abs_eps_f, NormalizedSystem::default_eps_h, rigor, inHC4, random_seed, eps_x) {
+
+}
+
+DefaultOptimizer::DefaultOptimizer(NormalizedSystem* norm_sys, ExtendedSystem* ext_sys, const System& sys, double rel_eps_f, double abs_eps_f, double eps_h, bool rigor, bool inHC4, double random_seed, double eps_x) :
 		Optimizer(sys.nb_var,
-			  ctc(get_ext_sys(sys,eps_h)), // warning: we don't know which argument is evaluated first
-//			  rec(new SmearSumRelative(get_ext_sys(sys,eps_h),eps_x)),
-			  rec(new LSmear(get_ext_sys(sys,eps_h),eps_x)),
-			  rec(rigor? (LoupFinder*) new LoupFinderCertify(sys,rec(new LoupFinderDefault(get_norm_sys(sys,eps_h),inHC4))) :
-						 (LoupFinder*) new LoupFinderDefault(get_norm_sys(sys,eps_h),inHC4)),
-			  (CellBufferOptim&) rec(new CellDoubleHeap(get_ext_sys(sys,eps_h))),
+			  ctc(get_ext_sys(ext_sys,sys,eps_h)), // warning: we don't know which argument is evaluated first
+//			  rec(new SmearSumRelative(get_ext_sys(ext_sys,sys,eps_h),eps_x)),
+			  rec(new LSmear(get_ext_sys(ext_sys,sys,eps_h),eps_x)),
+			  rec(rigor? (LoupFinder*) new LoupFinderCertify(sys,rec(new LoupFinderDefault(get_norm_sys(norm_sys,sys,eps_h),inHC4))) :
+						 (LoupFinder*) new LoupFinderDefault(get_norm_sys(norm_sys,sys,eps_h),inHC4)),
+			  (CellBufferOptim&) rec(new CellDoubleHeap(get_ext_sys(ext_sys,sys,eps_h))),
 //			  (CellBufferOptim&) rec (new  CellBeamSearch (
-//								       (CellHeap&) rec (new CellHeap (get_ext_sys(sys,eps_h))),
-//								       (CellHeap&) rec (new CellHeap (get_ext_sys(sys,eps_h))),
-//								       get_ext_sys(sys,eps_h))),
-			  get_ext_sys(sys,eps_h).goal_var(),
+//								       (CellHeap&) rec (new CellHeap (get_ext_sys(ext_sys,sys,eps_h))),
+//								       (CellHeap&) rec (new CellHeap (get_ext_sys(ext_sys,sys,eps_h))),
+//								       get_ext_sys(ext_sys,sys,eps_h))),
+			  get_ext_sys(ext_sys,sys,eps_h).goal_var(),
 			  eps_x,
 			  rel_eps_f,
 			  abs_eps_f) {
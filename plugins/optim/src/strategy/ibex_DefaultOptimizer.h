@@ -50,19 +50,44 @@ public:
 			double random_seed=default_random_seed,
     		double eps_x=Optimizer::default_eps_x);
 
+	/**
+	 * \brief Create a default optimizer with precomputed systems.
+	 *
+	 * Same as above except that the normalized and extended versions
+	 * of sys are given (e.g., loaded from a ModelCache) instead of being
+	 * built, together with the derivatives they may contain. The
+	 * equality thickness is the one of these systems.
+	 *
+	 * The systems are not copied: they must outlive the optimizer.
+	 */
+    DefaultOptimizer(const System& sys, NormalizedSystem& norm_sys, ExtendedSystem& ext_sys,
+    		double rel_eps_f=Optimizer::default_rel_eps_f,
+			double abs_eps_f=Optimizer::default_abs_eps_f,
+			bool rigor=false, bool inHC4=true,
+			double random_seed=default_random_seed,
+    		double eps_x=Optimizer::default_eps_x);
+
 	/** Default random seed: 1.0. */
 	static const double default_random_seed;
 
 private:
 
+	/**
+	 * The normalized (resp. extended) system is built from
+	 * sys and eps_h if norm_sys (resp. ext_sys) is NULL.
+	 */
+	DefaultOptimizer(NormalizedSystem* norm_sys, ExtendedSystem* ext_sys, const System& sys,
+			double rel_eps_f, double abs_eps_f, double eps_h, bool rigor, bool inHC4,
+			double random_seed, double eps_x);
+
     /**
      * The contractor: HC4 + acid(HC4) + X-Newton
      */
 	Ctc& ctc(const System& ext_sys);
 
-	NormalizedSystem& get_norm_sys(const System& sys, double eps_h);
+	NormalizedSystem& get_norm_sys(NormalizedSystem* norm_sys, const System& sys, double eps_h);
 
-	ExtendedSystem& get_ext_sys(const System& sys, double eps_h);
+	ExtendedSystem& get_ext_sys(ExtendedSystem* ext_sys, const System& sys, double eps_h);
 
 };
 
@@ -12,16 +12,48 @@
 
 #include "Ponts30.h"
 #include "ibex_LinearizerCombo.h"
+#include "ibex_LinearizerXTaylor.h"
 #include "ibex_CtcFwdBwd.h"
 #include "ibex_SystemFactory.h"
 #include "ibex_System.h"
 #include "ibex_CtcPolytopeHull.h"
 #include "ibex_Array.h"
+#include "ibex_LargestFirst.h"
+
+#include <algorithm>
 
 using namespace std;
 
 namespace ibex {
 
+namespace {
+
+// the non-zero rows of a LP, sorted
+vector<vector<double> > nonzero_rows(const LPSolver& lp, int n) {
+	Matrix A(lp.get_nb_rows(),n);
+	lp.get_rows(A);
+	IntervalVector lhs_rhs(lp.get_nb_rows());
+	lp.get_lhs_rhs(lhs_rhs);
+
+	vector<vector<double> > rows;
+	for (int i=0; i<A.nb_rows(); i++) {
+		if (A[i]==Vector::zeros(n)) continue;
+		vector<double> row(&A[i][0],&A[i][0]+n);
+		row.push_back(lhs_rhs[i].lb());
+		row.push_back(lhs_rhs[i].ub());
+		rows.push_back(row);
+	}
+	sort(rows.begin(),rows.end());
+	return rows;
+}
+
+// whether the LPs have the same non-trivial constraints
+bool same_rows(const LPSolver& lp1, const LPSolver& lp2) {
+	return nonzero_rows(lp1,5)==nonzero_rows(lp2,5);
+}
+
+}
+
 void TestCtcPolytopeHull::lp01() {
 	//! [ctc-polytope-hull]
 
@@ -66,5 +98,95 @@ void TestCtcPolytopeHull::fixbug01() {
 	check(box,box2);
 }
 
+void TestCtcPolytopeHull::incremental() {
+	// each constraint only depends on a few variables
+	const ExprSymbol& x=ExprSymbol::new_("x",Dim::col_vec(5));
+	SystemFactory f;
+	f.add_var(x);
+	f.add_ctr(sqr(x[0])+sqr(x[1])<=1);
+	f.add_ctr(x[1]*x[2]-x[3]=0);
+	f.add_ctr(exp(x[3])-x[4]>=0);
+	f.add_ctr(x[0]+2*x[4]<=1);
+	f.add_ctr(sqr(x[2])+x[4]*x[0]=0.5);
+	System sys(f);
+
+	// a corner policy without randomness, so that the
+	// linearizations must be the same in both modes
+	LinearizerXTaylor lr(sys,LinearizerXTaylor::RELAX,LinearizerXTaylor::INF);
+	LinearizerXTaylor lr_inc(sys,LinearizerXTaylor::RELAX,LinearizerXTaylor::INF);
+	lr_inc.set_incremental(true);
+	CPPUNIT_ASSERT(!lr.is_incremental());
+	CPPUNIT_ASSERT(lr_inc.is_incremental());
+
+	LPSolver lp(5);
+	LPSolver lp_inc(5);
+
+	LargestFirst bsc;
+	IntervalVector box(5,Interval(-2,2));
+
+	// depth-first descent: the bisected variable is the only
+	// one that changes from one call to the other
+	for (int i=0; i<30; i++) {
+		lp.clean_ctrs();
+		int n=lr.linearize(box,lp);
+
+		// the rows of the incremental linearizer are
+		// removed once, so that they are all added again
+		if (i==3) lp_inc.clean_ctrs();
+		int n_inc=lr_inc.linearize(box,lp_inc);
+
+		CPPUNIT_ASSERT(n_inc==n);
+		if (n==-1) break;
+		CPPUNIT_ASSERT(same_rows(lp,lp_inc));
+		// at most one trivial row per non-trivial one
+		CPPUNIT_ASSERT(lp_inc.get_nb_rows()-lp.get_nb_rows()<=n);
+
+		box=bsc.bisect(box).first;
+	}
+}
+
+void TestCtcPolytopeHull::incremental_compact() {
+	const ExprSymbol& x=ExprSymbol::new_("x",Dim::col_vec(5));
+	SystemFactory f;
+	f.add_var(x);
+	for (int i=0; i<4; i++)
+		f.add_ctr(sqr(x[i])+x[i+1]<=1);
+	f.add_ctr(sqr(x[4])<=1);
+	System sys(f);
+
+	LinearizerXTaylor lr(sys,LinearizerXTaylor::RELAX,LinearizerXTaylor::INF);
+	LinearizerXTaylor lr_inc(sys,LinearizerXTaylor::RELAX,LinearizerXTaylor::INF);
+	lr_inc.set_incremental(true);
+
+	LPSolver lp(5);
+	LPSolver lp_inc(5);
+
+	// the constraints are all active
+	IntervalVector box(5,Interval(-2,2));
+	int n=lr.linearize(box,lp);
+	CPPUNIT_ASSERT(n==5);
+	CPPUNIT_ASSERT(lr_inc.linearize(box,lp_inc)==5);
+	CPPUNIT_ASSERT(same_rows(lp,lp_inc));
+
+	// only the first constraint is active: the 4 trivial rows
+	// are removed
+	box=IntervalVector(5,Interval(-0.5,0.5));
+	box[0]=Interval(-2,2);
+	lp.clean_ctrs();
+	n=lr.linearize(box,lp);
+	CPPUNIT_ASSERT(n==1);
+	CPPUNIT_ASSERT(lr_inc.linearize(box,lp_inc)==1);
+	CPPUNIT_ASSERT(same_rows(lp,lp_inc));
+	CPPUNIT_ASSERT(lp_inc.get_nb_rows()==lp.get_nb_rows());
+
+	// the second constraint is active again: its row is added
+	box[1]=Interval(-2,2);
+	lp.clean_ctrs();
+	n=lr.linearize(box,lp);
+	CPPUNIT_ASSERT(n==2);
+	CPPUNIT_ASSERT(lr_inc.linearize(box,lp_inc)==2);
+	CPPUNIT_ASSERT(same_rows(lp,lp_inc));
+	CPPUNIT_ASSERT(lp_inc.get_nb_rows()==lp.get_nb_rows());
+}
 
 } // end namespace ibex
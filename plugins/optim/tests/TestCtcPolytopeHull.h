@@ -26,6 +26,8 @@ public:
 
 		CPPUNIT_TEST(lp01);
 		CPPUNIT_TEST(fixbug01);
+		CPPUNIT_TEST(incremental);
+		CPPUNIT_TEST(incremental_compact);
 
 #endif //_IBEX_WITH_NOLP_
 
@@ -34,6 +36,10 @@ public:
 	void lp01();
 
 	void fixbug01();
+
+	void incremental();
+
+	void incremental_compact();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestCtcPolytopeHull);
@@ -13,49 +13,66 @@
 
 namespace ibex {
 
-CtcQInter2::CtcQInter2(const Array<Ctc>& list, int q) : Ctc(list), list(list), q(q), boxes(list.size(), nb_var) { }
+CtcQInterAbstract::CtcQInterAbstract(const Array<Ctc>& list, int q, int nb_threads) : Ctc(list), list(list), q(q), incremental(false),
+		boxes(list.size(), nb_var), last_box(nb_var), survivors(new Mistral::BitSet(0,list.size()-1,Mistral::BitSet::empt)),
+		groups(list), pool(nb_threads>1 && groups.size()>1? new ThreadPool(nb_threads) : NULL) {
+	last_box.set_empty();
+}
 
+CtcQInterAbstract::~CtcQInterAbstract() {
+	delete survivors;
+	if (pool) delete pool;
+}
 
-void CtcQInter2::contract(IntervalVector& box) {
+void CtcQInterAbstract::contract(IntervalVector& box) {
 	Array<IntervalVector> refs(list.size());
 
+	// the contractors that returned an empty box for a superset can be skipped
+	bool skip = incremental && !last_box.is_empty() && box.is_subset(last_box);
+
 	for (int i=0; i<list.size(); i++) {
-		boxes[i]=box;
-		list[i].contract(boxes[i]);
 		refs.set_ref(i,boxes[i]);
+		if (skip && !survivors->contain(i))
+			boxes[i].set_empty();
+		else
+			boxes[i]=box;
 	}
 
-	box = qinter2(refs,q);
-}
-
-CtcQInterProjF::CtcQInterProjF(const Array<Ctc>& list, int q) : Ctc(list), list(list), q(q), boxes(list.size(), nb_var) { }
-
-
-void CtcQInterProjF::contract(IntervalVector& box) {
-	Array<IntervalVector> refs(list.size());
-
-	for (int i=0; i<list.size(); i++) {
-		boxes[i]=box;
-		list[i].contract(boxes[i]);
-		refs.set_ref(i,boxes[i]);
+	if (pool)
+		pool->run(groups.size(), [this](int g) {
+			for (std::vector<int>::const_iterator i=groups[g].begin(); i!=groups[g].end(); i++)
+				if (!boxes[*i].is_empty()) list[*i].contract(boxes[*i]);
+		});
+	else
+		for (int i=0; i<list.size(); i++)
+			if (!boxes[i].is_empty()) list[i].contract(boxes[i]);
+
+	if (incremental) {
+		last_box = box;
+		survivors->clear();
+		for (int i=0; i<list.size(); i++)
+			if (!boxes[i].is_empty()) survivors->add(i);
 	}
 
-	box = qinter_projf(refs,q);
+	box = qinter(refs,q);
 }
 
-CtcQInterCoreF::CtcQInterCoreF(const Array<Ctc>& list, int q) :  Ctc(list), list(list), q(q), boxes(list.size(), nb_var) { }
+CtcQInter2::CtcQInter2(const Array<Ctc>& list, int q, int nb_threads) : CtcQInterAbstract(list, q, nb_threads) { }
 
+IntervalVector CtcQInter2::qinter(const Array<IntervalVector>& boxes, int q) {
+	return qinter2(boxes,q);
+}
 
-void CtcQInterCoreF::contract(IntervalVector& box) {
-	Array<IntervalVector> refs(list.size());
+CtcQInterProjF::CtcQInterProjF(const Array<Ctc>& list, int q, int nb_threads) : CtcQInterAbstract(list, q, nb_threads) { }
 
-	for (int i=0; i<list.size(); i++) {
-		boxes[i]=box;
-		list[i].contract(boxes[i]);
-		refs.set_ref(i,boxes[i]);
-	}
+IntervalVector CtcQInterProjF::qinter(const Array<IntervalVector>& boxes, int q) {
+	return qinter_projf(boxes,q);
+}
+
+CtcQInterCoreF::CtcQInterCoreF(const Array<Ctc>& list, int q, int nb_threads) : CtcQInterAbstract(list, q, nb_threads) { }
 
-	box = qinter_coref(refs,q);
+IntervalVector CtcQInterCoreF::qinter(const Array<IntervalVector>& boxes, int q) {
+	return qinter_coref(boxes,q);
 }
 
 } // end namespace ibex
@@ -14,22 +14,35 @@
 #include "ibex_Ctc.h"
 #include "ibex_Array.h"
 #include "ibex_IntervalMatrix.h"
+#include "ibex_mistral_Bitset.h"
+#include "ibex_ThreadPool.h"
+#include "ibex_ParallelGroups.h"
 
 namespace ibex {
 
 /**
  * \ingroup contractor
- * \brief Q-intersection contractor.
+ * \brief Q-intersection contractor (common part).
  *
+ * The box is contracted by each contractor of the list and
+ * the resulting boxes are q-intersected by #qinter().
  */
-class CtcQInter2 : public Ctc {
+class CtcQInterAbstract : public Ctc {
 public:
 	/**
 	 * \brief q-intersection on a list of contractors.
 	 *
 	 * The list itself is not kept by reference.
+	 *
+	 * With nb_threads>1, the contractors are applied in parallel
+	 * (see #CtcQInter::CtcQInter(const Array<Ctc>&, int, int)).
+	 */
+	CtcQInterAbstract(const Array<Ctc>& list, int q, int nb_threads=1);
+
+	/**
+	 * \brief Delete *this.
 	 */
-	CtcQInter2(const Array<Ctc>& list, int q);
+	virtual ~CtcQInterAbstract();
 
 	/**
 	 * \brief Contract the box.
@@ -47,66 +60,90 @@ public:
 	 */
 	int q;
 
-protected:
-	IntervalMatrix boxes; // store boxes for each contraction
-};
-
-class CtcQInterProjF : public Ctc {
-public:
 	/**
-	 * \brief q-intersection on a list of contractors.
+	 * \brief Incremental mode (default: false).
 	 *
-	 * The list itself is not kept by reference.
+	 * If true and if the box is a subset of the box of the previous call
+	 * (typically, a descendant of the previous node in a depth-first search),
+	 * the contractors that returned an empty box at the previous call are
+	 * not called again: their box is directly set to the empty set.
 	 */
-	CtcQInterProjF(const Array<Ctc>& list, int q);
+	bool incremental;
 
+protected:
 	/**
-	 * \brief Contract the box.
+	 * \brief The q-intersection algorithm.
 	 */
-	virtual void contract(IntervalVector& box);
+	virtual IntervalVector qinter(const Array<IntervalVector>& boxes, int q)=0;
 
-	/**
-	 * List of contractors
-	 */
-	Array<Ctc> list;
+	IntervalMatrix boxes; // store boxes for each contraction
 
-	/**
-	 * The number of contractors we have to intersect the
-	 * result.
-	 */
-	int q;
+	IntervalVector last_box;         // box of the previous call (incremental mode)
+	Mistral::BitSet* survivors;      // nonempty boxes at the previous call (incremental mode)
 
-protected:
-	IntervalMatrix boxes; // store boxes for each contraction
+	ParallelGroups groups;           // contractors that can be applied in parallel
+
+	ThreadPool* pool;                // NULL for a sequential contraction
+
+private:
+	CtcQInterAbstract(const CtcQInterAbstract&); // forbidden
 };
 
-class CtcQInterCoreF : public Ctc {
+/**
+ * \ingroup contractor
+ * \brief Q-intersection contractor.
+ *
+ * Exact q-intersection (see #qinter2).
+ */
+class CtcQInter2 : public CtcQInterAbstract {
 public:
 	/**
 	 * \brief q-intersection on a list of contractors.
 	 *
 	 * The list itself is not kept by reference.
 	 */
-	CtcQInterCoreF(const Array<Ctc>& list, int q);
+	CtcQInter2(const Array<Ctc>& list, int q, int nb_threads=1);
 
-	/**
-	 * \brief Contract the box.
-	 */
-	virtual void contract(IntervalVector& box);
+protected:
+	virtual IntervalVector qinter(const Array<IntervalVector>& boxes, int q);
+};
 
+/**
+ * \ingroup contractor
+ * \brief Q-intersection contractor.
+ *
+ * Projective filtering (see #qinter_projf).
+ */
+class CtcQInterProjF : public CtcQInterAbstract {
+public:
 	/**
-	 * List of contractors
+	 * \brief q-intersection on a list of contractors.
+	 *
+	 * The list itself is not kept by reference.
 	 */
-	Array<Ctc> list;
+	CtcQInterProjF(const Array<Ctc>& list, int q, int nb_threads=1);
 
+protected:
+	virtual IntervalVector qinter(const Array<IntervalVector>& boxes, int q);
+};
+
+/**
+ * \ingroup contractor
+ * \brief Q-intersection contractor.
+ *
+ * k-core filtering and greedy coloring (see #qinter_coref).
+ */
+class CtcQInterCoreF : public CtcQInterAbstract {
+public:
 	/**
-	 * The number of contractors we have to intersect the
-	 * result.
+	 * \brief q-intersection on a list of contractors.
+	 *
+	 * The list itself is not kept by reference.
 	 */
-	int q;
+	CtcQInterCoreF(const Array<Ctc>& list, int q, int nb_threads=1);
 
 protected:
-	IntervalMatrix boxes; // store boxes for each contraction
+	virtual IntervalVector qinter(const Array<IntervalVector>& boxes, int q);
 };
 
 } // end namespace ibex
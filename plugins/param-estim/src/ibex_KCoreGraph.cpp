@@ -15,10 +15,11 @@ KCoreGraph::KCoreGraph(const int maxs, const int mind, bool full) {
 	tbr = new IntStack(0,maxs-1,false);
 	neighbourhoods.resize(maxs);
 	colors = (int *)calloc(maxs, sizeof(int));
+	degree = (int *)calloc(maxs, sizeof(int));
 	used = new BitSet(0,maxs,BitSet::empt);
 	
 	if (full) {
-		for (int i=0; i<maxs; i++) neighbourhoods.at(i) = new IntStack(0,maxs-1,false);
+		for (int i=0; i<maxs; i++) neighbourhoods.at(i) = new BitSet(0,maxs-1,BitSet::empt);
 	} else {
 		for (int i=0; i<maxs; i++) neighbourhoods.at(i) = NULL;
 	}
@@ -31,11 +32,17 @@ KCoreGraph::KCoreGraph(KCoreGraph *cpy) {
 	tbr = new IntStack(0, cpy->maxsize()-1, false);
 	neighbourhoods.resize(cpy->maxsize());
 	colors = (int *)calloc(cpy->maxsize(), sizeof(int));
+	degree = (int *)malloc(cpy->maxsize()*sizeof(int));
+	memcpy(degree, cpy->degree, cpy->maxsize()*sizeof(int));
 	used = new BitSet(0,cpy->maxsize(),BitSet::empt);
 	
 	// Initialization
 	for (unsigned int i=0; i<neighbourhoods.size(); i++) {
-		(cpy->neighbourhoods.at(i) != NULL) ? neighbourhoods.at(i) = new IntStack(cpy->neighbourhoods.at(i)) : neighbourhoods.at(i) = NULL;
+		if (cpy->neighbourhoods.at(i) != NULL) {
+			neighbourhoods.at(i) = new BitSet(0,cpy->maxsize()-1,BitSet::empt);
+			neighbourhoods.at(i)->copy(*cpy->neighbourhoods.at(i));
+		} else
+			neighbourhoods.at(i) = NULL;
 	}
 };
 
@@ -49,6 +56,7 @@ KCoreGraph::~KCoreGraph() {
 		allid->remove(val);
 	}
 	free(colors);
+	free(degree);
 	delete(used);
 	delete(allid);
 	delete(tbr);
@@ -58,27 +66,29 @@ void KCoreGraph::remove_vertex(const int idvert) {
 	assert(neighbourhoods.at(idvert) != NULL);
 	
 	/* Vertex to be removed */
-	IntStack *vn = neighbourhoods.at(idvert);
+	BitSet *vn = neighbourhoods.at(idvert);
 	
 	/* Remove the edges between vn and its neighbors */
-	int val;
-	while (!vn->empty()) {
-		val = vn->head();
+	int val = -1, next;
+	while ((next = vn->next(val)) != val) {
+		val = next;
 		neighbourhoods.at(val)->remove(idvert);
-		if (((int)(neighbourhoods.at(val)->size)) < k) {
+		degree[val]--;
+		if (degree[val] < k) {
 			if (!tbr->contain(val)) tbr->add(val);
 		}
-		vn->remove(val);
 	}
 	
 	/* Remove vn */
 	neighbourhoods.at(idvert) = NULL;
+	degree[idvert] = 0;
 	delete(vn);
 };
 
 void KCoreGraph::add_vertex(const int idvert) {
 	assert(neighbourhoods.at(idvert) == NULL);
-	neighbourhoods.at(idvert) = new IntStack(0,maxsize()-1,false);
+	neighbourhoods.at(idvert) = new BitSet(0,maxsize()-1,BitSet::empt);
+	degree[idvert] = 0;
 };
 	
 void KCoreGraph::propagate() {
@@ -98,7 +108,7 @@ void KCoreGraph::apply_coreness() {
 	
 	/* Not optimal, obviously */
 	for (unsigned int i=0; i<neighbourhoods.size(); i++) {
-		if ((neighbourhoods.at(i) != NULL) && (((int)(neighbourhoods.at(i)->size)) < k)) {
+		if ((neighbourhoods.at(i) != NULL) && (degree[i] < k)) {
 			remove_vertex(i);
 			allid->remove(i);
 			propagate();
@@ -125,21 +135,19 @@ int KCoreGraph::qcoloring(const std::pair<double, int>* boxes, int nboxes, int q
 		
 		if (!allid->contain(vert)) continue;
 		
-		if (neighbourhoods.at(vert)->empty()) {
+		if (degree[vert] == 0) {
 			colors[vert] = 1;
 			continue;
 		}
 		
 		used->clear();
 		
-		int val = neighbourhoods.at(vert)->head();
-		int preval = val-1;
-		while (val != preval) {
+		int val = -1, next;
+		while ((next = neighbourhoods.at(vert)->next(val)) != val) {
+			val = next;
 			if (colors[val] != 0) {
 				used->add(colors[val]);
 			}
-			preval = val;
-			val = neighbourhoods.at(vert)->next(preval);
 		}
 		
 		/* "used" now contains all the colors used in the neighbourhood of "vert" */
@@ -162,22 +170,18 @@ graph_t *KCoreGraph::subgraph(IntStack *vset) {
 	assert(!vset->empty());
 	
 	graph_t *g = graph_new(maxsize());
-	IntStack *nb;
+	BitSet *nb;
 	
-	int val,preval,val2,preval2;
+	int val,preval,val2,next2;
 	
 	val = vset->head();
 	preval = val-1;
 	while (val != preval) {
 		nb = neighbourhoods.at(val);
-		if (!nb->empty()) {
-			val2 = nb->head();
-			preval2 = val2-1;
-			while (val2 != preval2) {
-				if ((val > val2) && vset->contain(val2)) GRAPH_ADD_EDGE(g,val,val2);
-				preval2 = val2;
-				val2 = nb->next(preval2);
-			}
+		val2 = -1;
+		while ((next2 = nb->next(val2)) != val2) {
+			val2 = next2;
+			if ((val > val2) && vset->contain(val2)) GRAPH_ADD_EDGE(g,val,val2);
 		}
 		preval = val;
 		val = vset->next(preval);
@@ -13,6 +13,8 @@
  * 
  * Can be used like an IntStack of vertices. The edges must be added independently. 
  * 
+ * The neighbourhoods are stored as bitsets (maxs/8 bytes per vertex).
+ * 
  */
  
 // Forward declaration of graph_t type (quick and (very) dirty workaround to prevent 
@@ -50,8 +52,11 @@ public:
 	
 	/* Graph-specific methods */
 	inline void add_edge(const int elt1, const int elt2) {
+		if (neighbourhoods.at(elt1)->contain(elt2)) return;
 		neighbourhoods.at(elt1)->add(elt2);
 		neighbourhoods.at(elt2)->add(elt1);
+		degree[elt1]++;
+		degree[elt2]++;
 	};
 	inline bool is_edge(const int elt1, const int elt2) {
 		return neighbourhoods.at(elt1)->contain(elt2);
@@ -64,6 +69,9 @@ public:
 	 * Returns the first box of color at least q (or -1 if none is found) */
 	int qcoloring(const std::pair<double, int>* boxes, int nboxes, int q);
 	
+	/* Neighbourhood of a vertex (NULL if the vertex has been removed) */
+	inline const Mistral::BitSet* neighbours(const int elt) {return neighbourhoods.at(elt);};
+	
 	/* Misc */
 	inline int maxsize() {return neighbourhoods.size();};
 	graph_t *subgraph(IntStack *vset);
@@ -74,8 +82,11 @@ private:
 	/* All the active vertices' ids */
 	IntStack *allid;
 	
-	/* Adjacency lists */
-	std::vector<IntStack *> neighbourhoods;
+	/* Adjacency bitsets */
+	std::vector<Mistral::BitSet *> neighbourhoods;
+	
+	/* Degrees of the vertices */
+	int* degree;
 	
 	/* Coloring structures */
 	int* colors;
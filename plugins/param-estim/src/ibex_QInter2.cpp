@@ -114,6 +114,117 @@ void propagate_no_ub(const Array<IntervalVector>& boxes, IntStack ***dirboxes, i
 	nogoods.push_back(newNogood);
 }
 
+/*
+ * Initialize the set of boxes preceding the (q-1)th box in the sorted list x and the rank of all the boxes.
+ */
+static void init_before(const pair<double,int>* x, int nboxes, int q, BitSet* before, int* rank) {
+	before->clear();
+	for (int l=0; l<nboxes; l++) {
+		rank[x[l].second] = l;
+		if (l<q-1) before->add(x[l].second);
+	}
+}
+
+static bool rankcomp(const pair<int,int>& i, const pair<int,int>& j) { return (i.first<j.first); }
+
+/*
+ * Find the neighbors of b among the boxes "before" (with bitset operations) and sort them by rank.
+ * curr_set receives b and its neighbors.
+ * Return false if there are less than q-1 neighbors.
+ */
+static bool neighbors(KCoreGraph* origin, int b, const BitSet* before, const int* rank, BitSet* curr_set, int q,
+		const Array<IntervalVector>& boxes, vector<IntervalVector *>& neighboxes, vector<int>& n_indices) {
+	
+	curr_set->copy(*origin->neighbours(b));
+	curr_set->intersect_with(*before);
+	
+	neighboxes.clear();
+	n_indices.clear();
+	
+	if (((int) curr_set->size()) < q-1) return false;
+	
+	vector<pair<int,int> > ranked;
+	int b2 = -1, next;
+	while ((next = curr_set->next(b2)) != b2) {
+		b2 = next;
+		ranked.push_back(make_pair(rank[b2],b2));
+	}
+	sort(ranked.begin(),ranked.end(),rankcomp);
+	
+	for (unsigned int l=0; l<ranked.size(); l++) {
+		neighboxes.push_back(&(boxes[ranked[l].second]));
+		n_indices.push_back(ranked[l].second);
+	}
+	
+	curr_set->add(b);
+	return true;
+}
+
+/*
+ * Number of pairs of intervals that overlap in dimension i.
+ * A pair is disjoint iff the upper bound of one interval is less than the lower bound of the other.
+ */
+static double nb_overlaps(const Array<IntervalVector>& boxes, int i, vector<double>& lbs, vector<double>& ubs) {
+	int p = boxes.size();
+	for (int j=0; j<p; j++) {
+		lbs[j] = boxes[j][i].lb();
+		ubs[j] = boxes[j][i].ub();
+	}
+	sort(ubs.begin(),ubs.end());
+	
+	double disjoint = 0;
+	for (int j=0; j<p; j++) {
+		disjoint += lower_bound(ubs.begin(),ubs.end(),lbs[j]) - ubs.begin();
+	}
+	return 0.5*((double) p)*(p-1) - disjoint;
+}
+
+void qinter_graph(const Array<IntervalVector>& boxes, KCoreGraph& g) {
+	
+	int p = boxes.size();
+	if (p==0) return;
+	int n = boxes[0].size();
+	
+	/* Select the dimension of the sweep */
+	
+	vector<double> lbs(p), ubs(p);
+	int d = 0;
+	double min_overlaps = POS_INFINITY;
+	for (int i=0; i<n; i++) {
+		double o = nb_overlaps(boxes,i,lbs,ubs);
+		if (o < min_overlaps) {
+			min_overlaps = o;
+			d = i;
+		}
+	}
+	
+	/* Sort the boxes by increasing order of their left bounds */
+	
+	vector<pair<double,int> > x(p);
+	for (int j=0; j<p; j++) {
+		x[j] = make_pair(boxes[j][d].lb(),j);
+	}
+	sort(x.begin(),x.end(),leftpaircomp);
+	
+	/* Sweep: the active boxes are those whose right bound has not been passed yet */
+	
+	vector<int> active;
+	active.reserve(p);
+	for (int k=0; k<p; k++) {
+		int b = x[k].second;
+		double lb = x[k].first;
+		unsigned int m = 0;
+		for (unsigned int a=0; a<active.size(); a++) {
+			int b2 = active[a];
+			if (boxes[b2][d].ub() < lb) continue;
+			active[m++] = b2;
+			if (boxes[b].intersects(boxes[b2])) g.add_edge(b2,b);
+		}
+		active.resize(m);
+		active.push_back(b);
+	}
+}
+
 /* 
  * Improved q-intersection algorithm.
  */
@@ -156,11 +267,7 @@ IntervalVector qinter2(const Array<IntervalVector>& _boxes, int q) {
 	
 	/* Add edges */
 	
-	for (int i=0; i<p; i++) {
-		for (int j=i+1; j<p; j++) {
-			if (boxes[i].intersects(boxes[j])) origin->add_edge(i,j);
-		}
-	}
+	qinter_graph(boxes, *origin);
 	
 	/* Initialize the data structures */
 	
@@ -168,6 +275,10 @@ IntervalVector qinter2(const Array<IntervalVector>& _boxes, int q) {
 	nogoods.reserve(2*n);
 	BitSet *curr_set = new BitSet(0,p-1,BitSet::empt);
 	
+	/* The boxes before the current one in the sorted list, and the rank of each box in this list */
+	BitSet *before = new BitSet(0,p-1,BitSet::empt);
+	int *rank = new int[p];
+	
 	IntervalVector curr_qinter(n);
 	curr_qinter.set_empty();
 	IntervalVector hull_qinter(n);
@@ -178,7 +289,7 @@ IntervalVector qinter2(const Array<IntervalVector>& _boxes, int q) {
 	vector<int> n_indices;
 	n_indices.reserve(p);
 	
-	int b,b2,nboxes;
+	int b,nboxes;
 	pair<double,int>  *x = new pair<double,int>[p];
 	bool first_pass = true;
 	bool ng;
@@ -207,24 +318,15 @@ IntervalVector qinter2(const Array<IntervalVector>& _boxes, int q) {
 		
 		/* For each box, look for a (q-1)-inter in its left neighbourhood */
 		
+		init_before(x, nboxes, q, before, rank);
+		
 		for (int k=q-1; k<nboxes; k++) {
-			curr_set->clear();
+			if (k>q-1) before->add(x[k-1].second);
+			
 			b = x[k].second;
-			curr_set->add(b);
 			
 			/* Find the left neighbors */
-			neighboxes.clear();
-			n_indices.clear();
-			for (int l=0; l<k; l++) {
-				b2 = x[l].second;
-				if (origin->is_edge(b,b2)) {
-					neighboxes.push_back(&(boxes[b2]));
-					n_indices.push_back(b2);
-					curr_set->add(b2);
-				}
-			}
-			
-			if (((int)neighboxes.size() )< q-1) continue;
+			if (!neighbors(origin, b, before, rank, curr_set, q, boxes, neighboxes, n_indices)) continue;
 			
 			/* Check if it's a nogood */
 			ng = false;
@@ -282,24 +384,15 @@ IntervalVector qinter2(const Array<IntervalVector>& _boxes, int q) {
 		
 		/* For each box, look for a (q-1)-inter in its right neighbourhood */
 		
+		init_before(x, nboxes, q, before, rank);
+		
 		for (int k=q-1; k<nboxes; k++) {
-			curr_set->clear();
+			if (k>q-1) before->add(x[k-1].second);
+			
 			b = x[k].second;
-			curr_set->add(b);
 			
 			/* Find the right neighbors */
-			neighboxes.clear();
-			n_indices.clear();
-			for (int l=0; l<k; l++) {
-				b2 = x[l].second;
-				if (origin->is_edge(b,b2)) {
-					neighboxes.push_back(&(boxes[b2]));
-					n_indices.push_back(b2);
-					curr_set->add(b2);
-				}
-			}
-			
-			if (((int)neighboxes.size()) < q-1) continue;
+			if (!neighbors(origin, b, before, rank, curr_set, q, boxes, neighboxes, n_indices)) continue;
 			
 			/* Check if it's a nogood */
 			ng = false;
@@ -344,6 +437,8 @@ IntervalVector qinter2(const Array<IntervalVector>& _boxes, int q) {
 	delete(origin);
 	
 	delete(curr_set);
+	delete(before);
+	delete [] rank;
 	for (unsigned int i=0; i<nogoods.size(); i++) delete(nogoods.at(i));
 	
 	return hull_qinter;
@@ -47,6 +47,15 @@ IntervalVector qinter2(const Array<IntervalVector>& _boxes, int q);
  */
 IntervalVector qinterex_cliquer(const std::vector<IntervalVector *>& boxes, const std::vector<int>& indices, int q, KCoreGraph* origin);
 
+/**
+ * \ingroup combinatorial
+ * \brief Adds the edges of the intersection graph of the (nonempty) boxes to g
+ *
+ * Sweep-line algorithm on the dimension with the fewest overlapping pairs:
+ * only the boxes overlapping in this dimension are compared.
+ */
+void qinter_graph(const Array<IntervalVector>& boxes, KCoreGraph& g);
+
 } // end namespace ibex
 
 
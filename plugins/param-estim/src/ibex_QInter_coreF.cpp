@@ -9,6 +9,7 @@
 //============================================================================
 
 #include "ibex_QInter.h"
+#include "ibex_QInter2.h"
 #include "ibex_KCoreGraph.h"
 #include <algorithm>
 
@@ -46,11 +47,7 @@ IntervalVector qinter_coref(const Array<IntervalVector>& _boxes, int q) {
 	
 	/* Add edges */
 	
-	for (int i=0; i<p; i++) {
-		for (int j=i+1; j<p; j++) {
-			if (boxes[i].intersects(boxes[j])) origin->add_edge(i,j);
-		}
-	}
+	qinter_graph(boxes, *origin);
 	
 	IntervalVector res(n);
 	res.set_empty();
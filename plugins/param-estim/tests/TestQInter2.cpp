@@ -10,11 +10,55 @@
 #include "TestQInter2.h"
 #include "ibex_Function.h"
 #include "ibex_QInter2.h"
+#include "ibex_CtcQInter2.h"
+#include "ibex_CtcFwdBwd.h"
+#include "ibex_ParallelGroups.h"
 
 using namespace std;
 
 namespace ibex {
 
+namespace {
+
+// deterministic pseudo-random boxes
+vector<IntervalVector> random_boxes(int p, int n, unsigned int seed) {
+	vector<IntervalVector> v(p, IntervalVector(n));
+	for (int j=0; j<p; j++) {
+		for (int i=0; i<n; i++) {
+			seed = seed*1103515245+12345;
+			double lb = (seed/65536) % 100;
+			seed = seed*1103515245+12345;
+			double w = (seed/65536) % 30;
+			v[j][i] = Interval(lb, lb+w);
+		}
+	}
+	return v;
+}
+
+// q-intersection by enumeration of the subsets of q boxes
+void brute_qinter(const vector<IntervalVector>& v, int q, int start, IntervalVector inter, int nb, IntervalVector& hull) {
+	if (inter.is_empty()) return;
+	if (nb==q) { hull |= inter; return; }
+	for (int j=start; j<(int) v.size(); j++)
+		brute_qinter(v, q, j+1, nb==0? v[j] : inter & v[j], nb+1, hull);
+}
+
+// contractor that counts its calls
+class CtcCount : public Ctc {
+public:
+	CtcCount(Ctc& c) : Ctc(c.nb_var), c(c), calls(0) { }
+
+	void contract(IntervalVector& box) {
+		calls++;
+		c.contract(box);
+	}
+
+	Ctc& c;
+	int calls;
+};
+
+}
+
 void TestQInter::test_projF_1(){
     IntervalVector X1(2); X1[0] = Interval(-2, 2); X1[1] = Interval(2);   
     IntervalVector X2(2); X2[0] = Interval(0, 4); X2[1] = Interval(2);   
@@ -77,5 +121,196 @@ void TestQInter::test_projF_3(){
     CPPUNIT_ASSERT(!x_res.is_empty());
 }
 
-} // end namespace
+void TestQInter::test_graph() {
+	for (int n=1; n<=3; n++) {
+		vector<IntervalVector> v=random_boxes(60, n, n);
+		Array<IntervalVector> boxes(v.size());
+		for (int j=0; j<(int) v.size(); j++) boxes.set_ref(j, v[j]);
+
+		KCoreGraph g(v.size(), 0, true);
+		qinter_graph(boxes, g);
+
+		for (int i=0; i<(int) v.size(); i++)
+			for (int j=0; j<(int) v.size(); j++)
+				if (i!=j) CPPUNIT_ASSERT(g.is_edge(i,j) == v[i].intersects(v[j]));
+	}
+}
+
+void TestQInter::test_qinter2() {
+	for (int n=1; n<=3; n++) {
+		vector<IntervalVector> v=random_boxes(12, n, 10+n);
+		Array<IntervalVector> boxes(v.size());
+		for (int j=0; j<(int) v.size(); j++) boxes.set_ref(j, v[j]);
+
+		for (int q=2; q<=6; q++) {
+			IntervalVector hull(n);
+			hull.set_empty();
+			brute_qinter(v, q, 0, IntervalVector(n), 0, hull);
+			CPPUNIT_ASSERT(qinter2(boxes, q) == hull);
+		}
+	}
+}
+
+void TestQInter::test_incremental() {
+	// measurements y_i of y=a*t_i+b, three of them are outliers
+	const int p=10;
+	double t[p] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+	double y[p] = { 1, 3, 5, 7, 9, 11, -20, 15, 40, 0 };
+
+	Variable a, b;
+	Array<Function> f(p);
+	Array<Ctc> ctc(p);
+	for (int i=0; i<p; i++) {
+		f.set_ref(i, *new Function(a, b, a*t[i]+b-Interval(y[i]-0.5,y[i]+0.5)));
+		ctc.set_ref(i, *new CtcFwdBwd(f[i]));
+	}
+
+	CtcQInterProjF c1(ctc, 7);
+	CtcQInterProjF c2(ctc, 7);
+	c2.incremental = true;
+
+	IntervalVector box(2, Interval(-100,100));
+	IntervalVector sub(2);
+	sub[0]=Interval(1,3); sub[1]=Interval(-2,2);
+
+	// a box, a sub-box and an unrelated box
+	IntervalVector other(2);
+	other[0]=Interval(-50,0); other[1]=Interval(0,50);
 
+	IntervalVector list[4] = { box, sub, other, box };
+	for (int k=0; k<4; k++) {
+		IntervalVector x1(list[k]), x2(list[k]);
+		c1.contract(x1);
+		c2.contract(x2);
+		CPPUNIT_ASSERT(x1==x2);
+	}
+
+	for (int i=0; i<p; i++) {
+		delete &ctc[i];
+		delete &f[i];
+	}
+}
+
+void TestQInter::test_incremental_skip() {
+	// measurements y_i of y=2*t_i+1, three of them are outliers
+	const int p=10;
+	double t[p] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+	double y[p] = { 1, 3, 5, 7, 9, 11, -20, 15, 40, 0 };
+	bool outlier[p] = { false, false, false, false, false, false, true, false, true, true };
+
+	Variable a, b;
+	Array<Function> f(p);
+	Array<CtcFwdBwd> ctc(p);
+	Array<Ctc> count1(p), count2(p);
+	for (int i=0; i<p; i++) {
+		f.set_ref(i, *new Function(a, b, a*t[i]+b-Interval(y[i]-0.5,y[i]+0.5)));
+		ctc.set_ref(i, *new CtcFwdBwd(f[i]));
+		count1.set_ref(i, *new CtcCount(ctc[i]));
+		count2.set_ref(i, *new CtcCount(ctc[i]));
+	}
+
+	CtcQInterProjF c1(count1, 7);
+	CtcQInterProjF c2(count2, 7);
+	c2.incremental = true;
+
+	// the initial box (all the contractors survive),
+	// a sub-box where the outliers are removed and a
+	// sub-box of the latter.
+	IntervalVector list[3] = { IntervalVector(2, Interval(-100,100)), IntervalVector(2), IntervalVector(2) };
+	list[1][0]=Interval(1.5,2.5); list[1][1]=Interval(0.5,1.5);
+	list[2][0]=Interval(1.8,2.2); list[2][1]=Interval(0.8,1.2);
+
+	for (int k=0; k<3; k++) {
+		IntervalVector x1(list[k]), x2(list[k]);
+		c1.contract(x1);
+		c2.contract(x2);
+		CPPUNIT_ASSERT(!x2.is_empty());
+		CPPUNIT_ASSERT(x1==x2);
+		for (int i=0; i<p; i++) {
+			int calls=((CtcCount&) count2[i]).calls;
+			CPPUNIT_ASSERT(((CtcCount&) count1[i]).calls==k+1);
+			// the outliers are skipped at the last call
+			CPPUNIT_ASSERT(calls==(k==2 && outlier[i]? 2 : k+1));
+		}
+	}
+
+	for (int i=0; i<p; i++) {
+		delete &count1[i];
+		delete &count2[i];
+		delete &ctc[i];
+		delete &f[i];
+	}
+}
+
+void TestQInter::test_threads() {
+	// measurements y_i of y=a*t_i+b, one out of five is an outlier
+	const int p=200;
+	Variable a, b;
+	Array<Function> f(p);
+	Array<Ctc> ctc(p);
+	for (int i=0; i<p; i++) {
+		double y = 2*i+1 + (i%5==0? 10+i : 0);
+		f.set_ref(i, *new Function(a, b, a*i+b-Interval(y-0.5,y+0.5)));
+		ctc.set_ref(i, *new CtcFwdBwd(f[i]));
+	}
+
+	CtcQInter2 c1(ctc, 150);
+	CtcQInter2 c3(ctc, 150, 3);
+	c3.incremental = true;
+
+	for (int k=0; k<10; k++) {
+		IntervalVector x1(2), x3(2);
+		x1[0]=x3[0]=Interval(-10+k,10);
+		x1[1]=x3[1]=Interval(-10,10-k);
+		c1.contract(x1);
+		c3.contract(x3);
+		CPPUNIT_ASSERT(x1==x3);
+	}
+
+	for (int i=0; i<p; i++) {
+		delete &ctc[i];
+		delete &f[i];
+	}
+}
+
+void TestQInter::test_threads_shared() {
+	// 10 measurements y_ij of y=a*t_i+b for each of the 20 instants t_i
+	// (the same function a*t_i+b for all the measurements of t_i)
+	const int nt=20, m=10, p=nt*m;
+	Variable a, b;
+	Array<Function> f(nt);
+	Array<Ctc> ctc(p);
+	for (int i=0; i<nt; i++) {
+		f.set_ref(i, *new Function(a, b, a*i+b));
+		for (int j=0; j<m; j++) {
+			double y = 2*i+1 + 0.1*j + (j%5==0? 10+i : 0);
+			ctc.set_ref(j*nt+i, *new CtcFwdBwd(f[i], Interval(y-0.5,y+0.5)));
+		}
+	}
+
+	CPPUNIT_ASSERT(ParallelGroups(ctc).size()==nt);
+
+	CtcQInter2 c1(ctc, 150);
+	CtcQInter2 c3(ctc, 150, 3);
+
+	for (int k=0; k<10; k++) {
+		IntervalVector x1(2);
+		x1[0]=Interval(-10+k,10);
+		x1[1]=Interval(-10,10-k);
+		IntervalVector x(x1);
+		c1.contract(x1);
+		// several times, to detect a possible race
+		for (int r=0; r<50; r++) {
+			IntervalVector x3(x);
+			c3.contract(x3);
+			CPPUNIT_ASSERT(x1==x3);
+		}
+	}
+
+	for (int i=0; i<p; i++)
+		delete &ctc[i];
+	for (int i=0; i<nt; i++)
+		delete &f[i];
+}
+
+} // end namespace
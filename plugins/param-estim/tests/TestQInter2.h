@@ -26,11 +26,24 @@ public:
 	CPPUNIT_TEST( test_projF_1 );
 	CPPUNIT_TEST( test_projF_2 );
 	CPPUNIT_TEST( test_projF_3 );
+	CPPUNIT_TEST( test_graph );
+	CPPUNIT_TEST( test_qinter2 );
+	CPPUNIT_TEST( test_incremental );
+	CPPUNIT_TEST( test_incremental_skip );
+	CPPUNIT_TEST( test_threads );
+	CPPUNIT_TEST( test_threads_shared );
 	CPPUNIT_TEST_SUITE_END();
 
     void test_projF_1();
     void test_projF_2();
     void test_projF_3();
+    void test_graph();
+    void test_qinter2();
+    void test_incremental();
+    void test_incremental_skip();
+    void test_threads();
+    // parallel contraction with contractors sharing the same function
+    void test_threads_shared();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION( TestQInter );
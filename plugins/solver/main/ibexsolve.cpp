@@ -42,6 +42,8 @@ int main(int argc, char** argv) {
 			"(intermediate) description of the manifold with boxes in the MNF (binary) format.", {'i',"input"});
 	args::ValueFlag<string> output_file(parser, "filename", "Manifold output file. The file will contain the "
 			"description of the manifold with boxes in the MNF (binary) format.", {'o',"output"});
+	args::ValueFlag<string> cache(parser, "directory", "Directory of precompiled models. The system is loaded from "
+			"this directory if the MINIBEX file has already been compiled, and saved there otherwise.", {"cache"});
 	args::Flag format(parser, "format", "Show the output text format", {"format"});
 	args::Flag bfs(parser, "bfs", "Perform breadth-first search (instead of depth-first search, by default)", {"bfs"});
 	args::Flag txt(parser, "txt", "Write the output manifold in a easy-to-parse text file. See --format", {"txt"});
@@ -92,8 +94,9 @@ int main(int argc, char** argv) {
 
 	try {
 
-		// Load a system of equations
-		System sys(filename.Get().c_str());
+		// Load a system of equations (without parsing if precompiled)
+		ModelCache models(cache ? cache.Get().c_str() : NULL);
+		System& sys=models.system(filename.Get().c_str());
 
 		string output_manifold_file; // manifold output file
 		bool overwitten=false;       // is it overwritten?
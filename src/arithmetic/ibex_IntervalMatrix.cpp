@@ -388,5 +388,20 @@ double infinite_norm(const IntervalMatrix& m) {
 	return _infinite_normM(m);
 }
 
+IntervalMatrix operator*(const Matrix& m1, const IntervalMatrix& m2) {
+	assert(m1.nb_cols()==m2.nb_rows());
+
+	if (m2.is_empty()) return mulMM<Matrix,IntervalMatrix,IntervalMatrix>(m1,m2);
+
+	// row i of the result is the sum of the rows of m2
+	// weighted by m1[i][k] (one bulk operation per row)
+	IntervalMatrix m3(m1.nb_rows(),m2.nb_cols(),Interval::ZERO);
+	for (int i=0; i<m1.nb_rows(); i++) {
+		for (int k=0; k<m1.nb_cols(); k++)
+			simd_axpy(m1[i][k],&m2[k][0],&m3[i][0],m2.nb_cols());
+	}
+	return m3;
+}
+
 
 } // namespace ibex
@@ -832,10 +832,6 @@ inline IntervalVector operator*(const IntervalVector& v, const IntervalMatrix& m
 	return mulVM<IntervalVector,IntervalMatrix,IntervalVector>(v,m);
 }
 
-inline IntervalMatrix operator*(const Matrix& m1, const IntervalMatrix& m2) {
-	return mulMM<Matrix,IntervalMatrix,IntervalMatrix>(m1,m2);
-}
-
 inline IntervalMatrix operator*(const IntervalMatrix& m1, const Matrix& m2) {
 	return mulMM<IntervalMatrix,Matrix,IntervalMatrix>(m1,m2);
 }
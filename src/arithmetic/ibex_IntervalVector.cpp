@@ -86,13 +86,9 @@ IntervalVector& IntervalVector::operator&=(const IntervalVector& x)  {
 	if (is_empty()) return *this;
 	if (x.is_empty()) { set_empty(); return *this; }
 
-	for (int i=0; i<size(); i++) {
-		(*this)[i] &= x[i];
-		if ((*this)[i].is_empty()) {
-			set_empty();
-			return *this;
-		}
-	}
+	if (!simd_inter(vec,x.vec,n))
+		set_empty();
+
 	return *this;
 }
 
@@ -103,12 +99,30 @@ IntervalVector& IntervalVector::operator|=(const IntervalVector& x)  {
 	if (x.is_empty()) return *this;
 	if (is_empty()) { *this=x; return *this; }
 
-	for (int i=0; i<size(); i++) {
-		(*this)[i] |= x[i];
-	}
+	simd_hull(vec,x.vec,n);
+
 	return *this;
 }
 
+Vector IntervalVector::diam() const {
+	if (is_empty()) return _diam(*this);
+
+	Vector d(n);
+	simd_diam(vec,&d[0],n);
+	return d;
+}
+
+IntervalVector operator*(const Matrix& m, const IntervalVector& x) {
+	assert(m.nb_cols()==x.size());
+
+	if (x.is_empty()) return mulMV<Matrix,IntervalVector,IntervalVector>(m,x);
+
+	IntervalVector y(m.nb_rows());
+	for (int i=0; i<m.nb_rows(); i++)
+		y[i]=simd_dot(&m[i][0],&x[0],x.size());
+	return y;
+}
+
 
 namespace {
 
@@ -343,7 +357,6 @@ bool            IntervalVector::is_unbounded() const
 bool            IntervalVector::is_zero() const                                   { return _is_zero(*this); }
 bool            IntervalVector::is_bisectable() const                             { return _is_bisectable(*this); }
 Vector          IntervalVector::rad() const                                       { return _rad(*this); }
-Vector          IntervalVector::diam() const                                      { return _diam(*this); }
 int             IntervalVector::extr_diam_index(bool min) const                   { return _extr_diam_index(*this,min); }
 std::ostream&   operator<<(std::ostream& os, const IntervalVector& x)             { return _displayV(os,x); }
 double          IntervalVector::volume() const                                    { return _volume(*this); }
@@ -20,6 +20,7 @@
 #include "ibex_Vector.h"
 #include "ibex_Matrix.h"
 #include "ibex_Array.h"
+#include "ibex_SimdArith.h"
 
 namespace ibex {
 
@@ -880,7 +881,10 @@ inline IntervalVector& IntervalVector::operator+=(const Vector& x) {
 }
 
 inline IntervalVector& IntervalVector::operator+=(const IntervalVector& x) {
-	return set_addV<IntervalVector,IntervalVector>(*this,x);
+	assert(size()==x.size());
+	if (is_empty() || x.is_empty()) { set_empty(); return *this; }
+	simd_add(vec,x.vec,n);
+	return *this;
 }
 
 inline IntervalVector& IntervalVector::operator-=(const Vector& x) {
@@ -888,7 +892,10 @@ inline IntervalVector& IntervalVector::operator-=(const Vector& x) {
 }
 
 inline IntervalVector& IntervalVector::operator-=(const IntervalVector& x) {
-	return set_subV<IntervalVector,IntervalVector>(*this,x);
+	assert(size()==x.size());
+	if (is_empty() || x.is_empty()) { set_empty(); return *this; }
+	simd_sub(vec,x.vec,n);
+	return *this;
 }
 
 inline IntervalVector& IntervalVector::operator*=(double x) {
@@ -963,10 +970,6 @@ inline IntervalVector hadamard_product(const IntervalVector& v1, const IntervalV
 	return hadamard_prod<IntervalVector,IntervalVector,IntervalVector>(v1,v2);
 }
 
-inline IntervalVector operator*(const Matrix& m, const IntervalVector& v) {
-	return mulMV<Matrix,IntervalVector,IntervalVector>(m,v);
-}
-
 inline IntervalVector operator*(const IntervalVector& v, const Matrix& m) {
 	return mulVM<IntervalVector,Matrix,IntervalVector>(v,m);
 }
@@ -0,0 +1,218 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_MidRadArith.cpp
+// Author      : Gilles Chabert
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "ibex_MidRadArith.h"
+
+#include <vector>
+#include <limits>
+#include <math.h>
+
+#ifdef _IBEX_WITH_BLAS_
+extern "C" {
+// Fortran BLAS (column-major storage)
+void dgemm_(const char* transa, const char* transb, const int* m, const int* n, const int* k,
+		const double* alpha, const double* a, const int* lda, const double* b, const int* ldb,
+		const double* beta, double* c, const int* ldc);
+}
+#endif
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/*
+ * C:=A*B where A is (m x k), B is (k x n) and C is (m x n),
+ * all stored row by row in contiguous arrays.
+ *
+ * Nothing is assumed on the rounding mode nor on the order
+ * of the operations (see _gamma below).
+ */
+void gemm(int m, int k, int n, const double* A, const double* B, double* C) {
+#ifdef _IBEX_WITH_BLAS_
+	// The arrays are read by BLAS as the transposed matrices,
+	// so we compute C^T:=B^T*A^T.
+	const char N='N';
+	const double one=1.0;
+	const double zero=0.0;
+	dgemm_(&N,&N,&n,&m,&k,&one,B,&n,A,&k,&zero,C,&n);
+#else
+	for (int i=0; i<m*n; i++) C[i]=0;
+
+	for (int i=0; i<m; i++) {
+		double* ci=&C[i*n];
+		for (int l=0; l<k; l++) {
+			const double a=A[i*k+l];
+			const double* bl=&B[l*n];
+			for (int j=0; j<n; j++)
+				ci[j]+=a*bl[j];
+		}
+	}
+#endif
+}
+
+/*
+ * Upper bound of gamma_k=k*u/(1-k*u), where u=2^-52.
+ *
+ * If C=fl(A*B) is computed with any order of the operations, with or
+ * without FMA, then |C-A*B|<=gamma_k*|A|*|B|+2k*eta (k is the inner
+ * dimension and eta the smallest positive subnormal number). We take for
+ * u the unit roundoff of directed rounding (2^-52 instead of 2^-53) so
+ * that the bound holds whatever the rounding mode set by the caller
+ * (and by the threads of the BLAS library).
+ */
+double _gamma(int k) {
+	Interval ku=Interval((double) k)*::ldexp(1.0,-52);
+	return (ku/(1.0-ku)).ub();
+}
+
+const double eta = numeric_limits<double>::denorm_min();
+
+/*
+ * Midpoint and radius of x (the radius is rounded upward so that
+ * x is included in [m-r,m+r]).
+ */
+inline void split(const Interval& x, double& m, double& r) {
+	m=x.mid();
+	double r1=(x.ub()-Interval(m)).ub();
+	double r2=(Interval(m)-x.lb()).ub();
+	r=r1>r2? r1 : r2;
+}
+
+/*
+ * Copy a real matrix in a contiguous array.
+ * Return false if one entry is unbounded.
+ */
+bool load(const Matrix& A, vector<double>& mA) {
+	int m=A.nb_rows();
+	int n=A.nb_cols();
+	mA.resize(m*n);
+	for (int i=0; i<m; i++)
+		for (int j=0; j<n; j++) {
+			if (!(fabs(A[i][j])<POS_INFINITY)) return false;
+			mA[i*n+j]=A[i][j];
+		}
+	return true;
+}
+
+/*
+ * Copy the midpoint and radius matrices of A in contiguous arrays.
+ * Return false if A is empty or one entry is unbounded.
+ */
+bool load(const IntervalMatrix& A, vector<double>& mA, vector<double>& rA) {
+	if (A.is_empty()) return false;
+	int m=A.nb_rows();
+	int n=A.nb_cols();
+	mA.resize(m*n);
+	rA.resize(m*n);
+	for (int i=0; i<m; i++)
+		for (int j=0; j<n; j++) {
+			if (A[i][j].is_unbounded()) return false;
+			split(A[i][j],mA[i*n+j],rA[i*n+j]);
+		}
+	return true;
+}
+
+/*
+ * Enclosure of (mA +/- rA)*(mB +/- rB), where A is (m x k) and B is (k x n).
+ * rA (resp. rB) is NULL if A (resp. B) is real.
+ *
+ * The radius is bounded by
+ *     |mA|*rB + rA*(|mB|+rB) + gamma_k*|mA|*|mB|
+ *   = |mA|*(rB+gamma_k*|mB|) + rA*(|mB|+rB)
+ * which is computed with only one real product P*Q, by stacking the
+ * two terms (P=[|mA| rA] and Q=[rB+gamma_k*|mB| ; |mB|+rB]).
+ */
+IntervalMatrix mul(int m, int k, int n, const double* mA, const double* rA, const double* mB, const double* rB) {
+
+	// midpoint (+rounding errors bounded below)
+	vector<double> C(m*n);
+	gemm(m,k,n,mA,mB,&C[0]);
+
+	double g=_gamma(k);
+
+	int k2=(rA && rB)? 2*k : k;
+	vector<double> P(m*k2);
+	vector<double> Q(k2*n);
+
+	for (int i=0; i<m; i++) {
+		for (int l=0; l<k; l++) {
+			double a=fabs(mA[i*k+l]);
+			if (!rA)      P[i*k2+l]=a;
+			else if (!rB) P[i*k2+l]=(rA[i*k+l]+g*Interval(a)).ub();
+			else {        P[i*k2+l]=a;
+			              P[i*k2+k+l]=rA[i*k+l]; }
+		}
+	}
+
+	for (int l=0; l<k; l++) {
+		for (int j=0; j<n; j++) {
+			double b=fabs(mB[l*n+j]);
+			if (!rB)      Q[l*n+j]=b;
+			else          Q[l*n+j]=(rB[l*n+j]+g*Interval(b)).ub();
+			if (rA && rB) Q[(k+l)*n+j]=(rB[l*n+j]+Interval(b)).ub();
+		}
+	}
+
+	// radius (+rounding errors)
+	vector<double> T(m*n);
+	gemm(m,k2,n,&P[0],&Q[0],&T[0]);
+
+	// All the entries of P and Q are nonnegative so the computed
+	// product satisfies T >= (1-gamma_k2)*P*Q - 2*k2*eta.
+	Interval g2=_gamma(k2);
+	double e1=(Interval(2.0*k)*eta).ub();
+	double e2=(Interval(2.0*k2)*eta).ub();
+
+	IntervalMatrix res(m,n);
+	for (int i=0; i<m; i++)
+		for (int j=0; j<n; j++) {
+			double r=((T[i*n+j]+Interval(e2))/(1.0-g2)+e1).ub();
+			double c=C[i*n+j];
+			// overflow (possibly NaN) in one of the products
+			if (!(fabs(c)<POS_INFINITY) || !(r<POS_INFINITY))
+				res[i][j]=Interval::ALL_REALS;
+			else
+				res[i][j]=c+Interval(-r,r);
+		}
+	return res;
+}
+
+} // end anonymous namespace
+
+IntervalMatrix midrad_mul(const Matrix& A, const IntervalMatrix& B) {
+	assert(A.nb_cols()==B.nb_rows());
+
+	vector<double> mA, mB, rB;
+	if (!load(A,mA) || !load(B,mB,rB)) return A*B;
+
+	return mul(A.nb_rows(),A.nb_cols(),B.nb_cols(),&mA[0],NULL,&mB[0],&rB[0]);
+}
+
+IntervalMatrix midrad_mul(const IntervalMatrix& A, const Matrix& B) {
+	assert(A.nb_cols()==B.nb_rows());
+
+	vector<double> mA, rA, mB;
+	if (!load(A,mA,rA) || !load(B,mB)) return A*B;
+
+	return mul(A.nb_rows(),A.nb_cols(),B.nb_cols(),&mA[0],&rA[0],&mB[0],NULL);
+}
+
+IntervalMatrix midrad_mul(const IntervalMatrix& A, const IntervalMatrix& B) {
+	assert(A.nb_cols()==B.nb_rows());
+
+	vector<double> mA, rA, mB, rB;
+	if (!load(A,mA,rA) || !load(B,mB,rB)) return A*B;
+
+	return mul(A.nb_rows(),A.nb_cols(),B.nb_cols(),&mA[0],&rA[0],&mB[0],&rB[0]);
+}
+
+} // end namespace ibex
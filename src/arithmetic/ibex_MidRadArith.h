@@ -0,0 +1,63 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_MidRadArith.h
+// Author      : Gilles Chabert
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_MID_RAD_ARITH_H__
+#define __IBEX_MID_RAD_ARITH_H__
+
+#include "ibex_IntervalMatrix.h"
+
+namespace ibex {
+
+/**\ingroup arithmetic */
+/*@{*/
+
+/**
+ * \brief Midpoint-radius product of a real matrix by an interval matrix.
+ *
+ * The interval matrix B is split into a midpoint matrix mB and a radius
+ * matrix rB. The product is enclosed by A*mB +/- |A|*rB (S.M. Rump,
+ * "Fast and parallel interval arithmetic", BIT 39(3), 1999), where both
+ * terms are computed by two real matrix products plus an a priori bound
+ * of their rounding errors. The real products can therefore be done by
+ * any (optimized) kernel, in any order and with any rounding mode: with
+ * the --with-blas option, BLAS (dgemm) is used.
+ *
+ * The result is a rigorous enclosure of the product. It is as sharp as
+ * A*B (up to the rounding errors).
+ *
+ * If one entry of A or B is unbounded (or if B is empty), the result is A*B.
+ */
+IntervalMatrix midrad_mul(const Matrix& A, const IntervalMatrix& B);
+
+/**
+ * \brief Midpoint-radius product of an interval matrix by a real matrix.
+ *
+ * \see #midrad_mul(const Matrix&, const IntervalMatrix&).
+ */
+IntervalMatrix midrad_mul(const IntervalMatrix& A, const Matrix& B);
+
+/**
+ * \brief Midpoint-radius product of two interval matrices.
+ *
+ * The product is enclosed by mA*mB +/- (|mA|*rB+rA*(|mB|+rB)).
+ *
+ * Contrary to the real cases, the radius can overestimate the one of A*B,
+ * by a factor 1.5 at most. The product costs two real matrix products
+ * (instead of n^3 interval multiplications).
+ *
+ * \see #midrad_mul(const Matrix&, const IntervalMatrix&).
+ */
+IntervalMatrix midrad_mul(const IntervalMatrix& A, const IntervalMatrix& B);
+
+/*@}*/
+
+} // end namespace ibex
+
+#endif // __IBEX_MID_RAD_ARITH_H__
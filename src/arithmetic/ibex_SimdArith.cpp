@@ -0,0 +1,607 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SimdArith.cpp
+// Author      : Gilles Chabert
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "ibex_SimdArith.h"
+
+#include <cfenv>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && defined(__linux__)
+#define __IBEX_SIMD_X86__
+#include <immintrin.h>
+#endif
+
+// A contraction a*b+c into a fused multiply-add would change the
+// results from one backend to another (avx512f implies fma).
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC optimize ("fp-contract=off")
+#else
+#pragma STDC FP_CONTRACT OFF
+#endif
+
+// On x86-64, doubles are computed with SSE/AVX (no excess precision):
+// -ffloat-store (set with filib) would only add a store/reload to each
+// operation of the loops below.
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__)
+#pragma GCC optimize ("no-float-store")
+#endif
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/*
+ * All the kernels work on "packed" arrays of doubles:
+ * the ith interval [a,b] is stored as (-a,b) at positions 2i and 2i+1.
+ *
+ * With gaol, this is exactly the memory layout of an array of
+ * intervals (no copy is needed). With filib, intervals are stored
+ * as (a,b): the array that is updated is converted in place, the other
+ * one is copied. Otherwise, intervals are copied by chunks into/from
+ * buffers allocated on the stack.
+ */
+
+/*
+ * Below this number of intervals, a plain loop with interval
+ * operations is faster than packing and setting the rounding mode.
+ */
+const int MIN_SIZE=4;
+
+/* Number of intervals packed at a time (size of the buffers). */
+const int CHUNK=128;
+
+/*
+ * Set the rounding mode upward (and restore it at destruction).
+ *
+ * On x86-64, the kernels only use SSE/AVX instructions: only the MXCSR
+ * register is set, and only if necessary (with gaol, the rounding mode is
+ * already upward). This is much cheaper than fegetround/fesetround, which
+ * also set the control word of the x87 unit.
+ */
+class RoundUp {
+public:
+#if defined(__IBEX_SIMD_X86__) && defined(__x86_64__)
+	RoundUp() : csr(_mm_getcsr()) {
+		if ((csr & _MM_ROUND_MASK)!=_MM_ROUND_UP) _mm_setcsr((csr & ~_MM_ROUND_MASK) | _MM_ROUND_UP);
+	}
+	~RoundUp() {
+		if ((csr & _MM_ROUND_MASK)!=_MM_ROUND_UP) _mm_setcsr(csr);
+	}
+private:
+	unsigned int csr;
+#else
+	RoundUp() : mode(fegetround()) { fesetround(FE_UPWARD); }
+	~RoundUp() { fesetround(mode); }
+private:
+	int mode;
+#endif
+};
+
+/*================================== scalar backend ==================================*/
+
+void add_scalar(double* x, const double* y, int m) {
+	for (int i=0; i<m; i++) x[i]+=y[i];
+}
+
+void sub_scalar(double* x, const double* y, int m) {
+	for (int i=0; i<m; i+=2) {
+		double l=y[i+1], u=y[i]; // x and y may be the same array
+		x[i]+=l;
+		x[i+1]+=u;
+	}
+}
+
+bool inter_scalar(double* x, const double* y, int m) {
+	for (int i=0; i<m; i+=2) {
+		if (y[i]<x[i]) x[i]=y[i];
+		if (y[i+1]<x[i+1]) x[i+1]=y[i+1];
+		if (-x[i]>x[i+1]) return false;
+	}
+	return true;
+}
+
+void hull_scalar(double* x, const double* y, int m) {
+	for (int i=0; i<m; i++)
+		if (y[i]>x[i]) x[i]=y[i];
+}
+
+void diam_scalar(const double* x, double* d, int m) {
+	for (int i=0; i<m; i+=2)
+		d[i/2]=x[i]+x[i+1];
+}
+
+void axpy_scalar(double a, const double* x, double* y, int m) {
+	if (a>0)
+		for (int i=0; i<m; i++) y[i]+=a*x[i];
+	else
+		for (int i=0; i<m; i+=2) {
+			double l=(-a)*x[i+1], u=(-a)*x[i]; // x and y may be the same array
+			y[i]+=l;
+			y[i+1]+=u;
+		}
+}
+
+/* p[i]:=a[i]*x[i] */
+void mul_scalar(const double* a, const double* x, double* p, int m) {
+	for (int i=0; i<m; i+=2) {
+		double c=a[i/2];
+		if (c>0) {
+			p[i]=c*x[i];
+			p[i+1]=c*x[i+1];
+		} else if (c<0) {
+			p[i]=(-c)*x[i+1];
+			p[i+1]=(-c)*x[i];
+		} else {
+			p[i]=p[i+1]=0;
+		}
+	}
+}
+
+/*
+ * nl+=p[0]+p[2]+...; u+=p[1]+p[3]+...
+ * (not inlined so that the sums are performed under the rounding mode set by the caller)
+ */
+#ifdef __GNUC__
+__attribute__((noinline))
+#endif
+void sum_scalar(const double* p, int m, double& nl, double& u) {
+	double _nl=nl, _u=u; // (nl and u could alias p)
+	for (int i=0; i<m; i+=2) {
+		_nl+=p[i];
+		_u+=p[i+1];
+	}
+	nl=_nl;
+	u=_u;
+}
+
+#ifdef __IBEX_SIMD_X86__
+
+/*================================== AVX2 backend ==================================*/
+
+#define __IBEX_AVX2__ __attribute__((target("avx2")))
+
+/*
+ * The scalar functions called for the remaining elements are compiled
+ * without AVX: the upper part of the registers is cleared before (gcc
+ * does not always insert vzeroupper before a tail call), otherwise the
+ * SSE instructions executed afterwards are penalized.
+ */
+
+__IBEX_AVX2__ void add_avx2(double* x, const double* y, int m) {
+	int i=0;
+	for (; i+4<=m; i+=4)
+		_mm256_storeu_pd(x+i,_mm256_add_pd(_mm256_loadu_pd(x+i),_mm256_loadu_pd(y+i)));
+	_mm256_zeroupper();
+	add_scalar(x+i,y+i,m-i);
+}
+
+__IBEX_AVX2__ void sub_avx2(double* x, const double* y, int m) {
+	int i=0;
+	for (; i+4<=m; i+=4)
+		_mm256_storeu_pd(x+i,_mm256_add_pd(_mm256_loadu_pd(x+i),_mm256_permute_pd(_mm256_loadu_pd(y+i),0x5)));
+	_mm256_zeroupper();
+	sub_scalar(x+i,y+i,m-i);
+}
+
+__IBEX_AVX2__ bool inter_avx2(double* x, const double* y, int m) {
+	const __m256d sign=_mm256_set_pd(0.0,-0.0,0.0,-0.0); // flip lower bounds
+	int i=0;
+	for (; i+4<=m; i+=4) {
+		__m256d v=_mm256_min_pd(_mm256_loadu_pd(x+i),_mm256_loadu_pd(y+i));
+		_mm256_storeu_pd(x+i,v);
+		v=_mm256_xor_pd(v,sign);                                            // (a,b)
+		__m256d gt=_mm256_cmp_pd(v,_mm256_permute_pd(v,0x5),_CMP_GT_OQ);    // a>b?
+		if (_mm256_movemask_pd(gt) & 0x5) return false;
+	}
+	_mm256_zeroupper();
+	return inter_scalar(x+i,y+i,m-i);
+}
+
+__IBEX_AVX2__ void hull_avx2(double* x, const double* y, int m) {
+	int i=0;
+	for (; i+4<=m; i+=4)
+		_mm256_storeu_pd(x+i,_mm256_max_pd(_mm256_loadu_pd(x+i),_mm256_loadu_pd(y+i)));
+	_mm256_zeroupper();
+	hull_scalar(x+i,y+i,m-i);
+}
+
+__IBEX_AVX2__ void diam_avx2(const double* x, double* d, int m) {
+	int i=0;
+	for (; i+8<=m; i+=8) {
+		// (d0,d2,d1,d3)
+		__m256d h=_mm256_hadd_pd(_mm256_loadu_pd(x+i),_mm256_loadu_pd(x+i+4));
+		_mm256_storeu_pd(d+i/2,_mm256_permute4x64_pd(h,_MM_SHUFFLE(3,1,2,0)));
+	}
+	_mm256_zeroupper();
+	diam_scalar(x+i,d+i/2,m-i);
+}
+
+__IBEX_AVX2__ void axpy_avx2(double a, const double* x, double* y, int m) {
+	int i=0;
+	if (a>0) {
+		const __m256d av=_mm256_set1_pd(a);
+		for (; i+4<=m; i+=4)
+			_mm256_storeu_pd(y+i,_mm256_add_pd(_mm256_loadu_pd(y+i),_mm256_mul_pd(av,_mm256_loadu_pd(x+i))));
+	} else {
+		const __m256d av=_mm256_set1_pd(-a);
+		for (; i+4<=m; i+=4)
+			_mm256_storeu_pd(y+i,_mm256_add_pd(_mm256_loadu_pd(y+i),_mm256_mul_pd(av,_mm256_permute_pd(_mm256_loadu_pd(x+i),0x5))));
+	}
+	_mm256_zeroupper();
+	axpy_scalar(a,x+i,y+i,m-i);
+}
+
+__IBEX_AVX2__ void mul_avx2(const double* a, const double* x, double* p, int m) {
+	const __m256d zero=_mm256_setzero_pd();
+	const __m256d sign=_mm256_set1_pd(-0.0);
+	int i=0;
+	for (; i+4<=m; i+=4) {
+		// (a0,a0,a1,a1)
+		__m256d av=_mm256_permute4x64_pd(_mm256_castpd128_pd256(_mm_loadu_pd(a+i/2)),_MM_SHUFFLE(1,1,0,0));
+		__m256d xv=_mm256_loadu_pd(x+i);
+		// swap the bounds of x when a<0
+		xv=_mm256_blendv_pd(xv,_mm256_permute_pd(xv,0x5),_mm256_cmp_pd(av,zero,_CMP_LT_OQ));
+		__m256d pv=_mm256_mul_pd(_mm256_andnot_pd(sign,av),xv);
+		// 0*[x]=0 (avoid 0*inf)
+		_mm256_storeu_pd(p+i,_mm256_andnot_pd(_mm256_cmp_pd(av,zero,_CMP_EQ_OQ),pv));
+	}
+	_mm256_zeroupper();
+	mul_scalar(a+i/2,x+i,p+i,m-i);
+}
+
+/*================================== AVX-512 backend ==================================*/
+
+#define __IBEX_AVX512__ __attribute__((target("avx512f")))
+
+/*
+ * gcc implements the unmasked AVX-512 intrinsics with an uninitialized
+ * source register (_mm512_undefined_pd), which triggers -Wmaybe-uninitialized
+ * warnings once inlined. We use the masked forms with an initialized source.
+ */
+const __mmask8 ALL=0xFF;
+
+/* (a,b,...)->(b,a,...) */
+__IBEX_AVX512__ inline __m512d swap512(__m512d v) {
+	return _mm512_mask_permute_pd(v,ALL,v,0x55);
+}
+
+__IBEX_AVX512__ void add_avx512(double* x, const double* y, int m) {
+	int i=0;
+	for (; i+8<=m; i+=8)
+		_mm512_storeu_pd(x+i,_mm512_add_pd(_mm512_loadu_pd(x+i),_mm512_loadu_pd(y+i)));
+	_mm256_zeroupper();
+	add_scalar(x+i,y+i,m-i);
+}
+
+__IBEX_AVX512__ void sub_avx512(double* x, const double* y, int m) {
+	int i=0;
+	for (; i+8<=m; i+=8)
+		_mm512_storeu_pd(x+i,_mm512_add_pd(_mm512_loadu_pd(x+i),swap512(_mm512_loadu_pd(y+i))));
+	_mm256_zeroupper();
+	sub_scalar(x+i,y+i,m-i);
+}
+
+__IBEX_AVX512__ bool inter_avx512(double* x, const double* y, int m) {
+	const __m512d sign=_mm512_set_pd(0.0,-0.0,0.0,-0.0,0.0,-0.0,0.0,-0.0);
+	int i=0;
+	for (; i+8<=m; i+=8) {
+		__m512d xv=_mm512_loadu_pd(x+i);
+		__m512d v=_mm512_mask_min_pd(xv,ALL,xv,_mm512_loadu_pd(y+i));
+		_mm512_storeu_pd(x+i,v);
+		v=_mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(v),_mm512_castpd_si512(sign)));
+		if (_mm512_cmp_pd_mask(v,swap512(v),_CMP_GT_OQ) & 0x55) return false;
+	}
+	_mm256_zeroupper();
+	return inter_scalar(x+i,y+i,m-i);
+}
+
+__IBEX_AVX512__ void hull_avx512(double* x, const double* y, int m) {
+	int i=0;
+	for (; i+8<=m; i+=8) {
+		__m512d xv=_mm512_loadu_pd(x+i);
+		_mm512_storeu_pd(x+i,_mm512_mask_max_pd(xv,ALL,xv,_mm512_loadu_pd(y+i)));
+	}
+	_mm256_zeroupper();
+	hull_scalar(x+i,y+i,m-i);
+}
+
+__IBEX_AVX512__ void diam_avx512(const double* x, double* d, int m) {
+	const __m512i even=_mm512_set_epi64(14,12,10,8,6,4,2,0);
+	const __m512i odd =_mm512_set_epi64(15,13,11,9,7,5,3,1);
+	int i=0;
+	for (; i+16<=m; i+=16) {
+		__m512d x1=_mm512_loadu_pd(x+i);
+		__m512d x2=_mm512_loadu_pd(x+i+8);
+		_mm512_storeu_pd(d+i/2,_mm512_add_pd(_mm512_permutex2var_pd(x1,even,x2),_mm512_permutex2var_pd(x1,odd,x2)));
+	}
+	_mm256_zeroupper();
+	diam_scalar(x+i,d+i/2,m-i);
+}
+
+__IBEX_AVX512__ void axpy_avx512(double a, const double* x, double* y, int m) {
+	int i=0;
+	if (a>0) {
+		const __m512d av=_mm512_set1_pd(a);
+		for (; i+8<=m; i+=8)
+			_mm512_storeu_pd(y+i,_mm512_add_pd(_mm512_loadu_pd(y+i),_mm512_mul_pd(av,_mm512_loadu_pd(x+i))));
+	} else {
+		const __m512d av=_mm512_set1_pd(-a);
+		for (; i+8<=m; i+=8)
+			_mm512_storeu_pd(y+i,_mm512_add_pd(_mm512_loadu_pd(y+i),_mm512_mul_pd(av,swap512(_mm512_loadu_pd(x+i)))));
+	}
+	_mm256_zeroupper();
+	axpy_scalar(a,x+i,y+i,m-i);
+}
+
+__IBEX_AVX512__ void mul_avx512(const double* a, const double* x, double* p, int m) {
+	const __m512i dup=_mm512_set_epi64(3,3,2,2,1,1,0,0);
+	const __m512d zero=_mm512_setzero_pd();
+	int i=0;
+	for (; i+8<=m; i+=8) {
+		// (a0,a0,a1,a1,a2,a2,a3,a3)
+		__m512d av=_mm512_mask_permutexvar_pd(zero,ALL,dup,_mm512_castpd256_pd512(_mm256_loadu_pd(a+i/2)));
+		__m512d xv=_mm512_loadu_pd(x+i);
+		xv=_mm512_mask_blend_pd(_mm512_cmp_pd_mask(av,zero,_CMP_LT_OQ),xv,swap512(xv));
+		__m512d pv=_mm512_mul_pd(_mm512_abs_pd(av),xv);
+		_mm512_storeu_pd(p+i,_mm512_mask_blend_pd(_mm512_cmp_pd_mask(av,zero,_CMP_EQ_OQ),pv,zero));
+	}
+	_mm256_zeroupper();
+	mul_scalar(a+i/2,x+i,p+i,m-i);
+}
+
+#endif // __IBEX_SIMD_X86__
+
+/*================================== dispatch ==================================*/
+
+struct Kernels {
+	void (*add)(double*, const double*, int);
+	void (*sub)(double*, const double*, int);
+	bool (*inter)(double*, const double*, int);
+	void (*hull)(double*, const double*, int);
+	void (*diam)(const double*, double*, int);
+	void (*axpy)(double, const double*, double*, int);
+	void (*mul)(const double*, const double*, double*, int);
+};
+
+const Kernels scalar_kernels = { add_scalar, sub_scalar, inter_scalar, hull_scalar, diam_scalar, axpy_scalar, mul_scalar };
+
+#ifdef __IBEX_SIMD_X86__
+const Kernels avx2_kernels   = { add_avx2, sub_avx2, inter_avx2, hull_avx2, diam_avx2, axpy_avx2, mul_avx2 };
+const Kernels avx512_kernels = { add_avx512, sub_avx512, inter_avx512, hull_avx512, diam_avx512, axpy_avx512, mul_avx512 };
+#endif
+
+SimdBackend best_backend() {
+#ifdef __IBEX_SIMD_X86__
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx512f")) return SIMD_AVX512;
+	if (__builtin_cpu_supports("avx2")) return SIMD_AVX2;
+#endif
+	return SIMD_SCALAR;
+}
+
+const Kernels& kernels_of(SimdBackend b) {
+#ifdef __IBEX_SIMD_X86__
+	switch (b) {
+	case SIMD_AVX512: return avx512_kernels;
+	case SIMD_AVX2:   return avx2_kernels;
+	default:          return scalar_kernels;
+	}
+#else
+	return scalar_kernels;
+#endif
+}
+
+// The scalar backend is statically initialized (bulk operations
+// may be called during the initialization of other static objects).
+SimdBackend _backend=SIMD_SCALAR;
+
+const Kernels* kernels=&scalar_kernels;
+
+struct SelectBestBackend {
+	SelectBestBackend() {
+		_backend=best_backend();
+		kernels=&kernels_of(_backend);
+	}
+} _select_best_backend;
+
+/*================================== packing ==================================*/
+
+#ifdef IBEX_INTERVAL_NEG_LB_LAYOUT
+
+static_assert(sizeof(Interval)==2*sizeof(double), "unexpected memory layout of intervals");
+
+#else
+
+#ifdef IBEX_INTERVAL_LB_UB_LAYOUT
+
+static_assert(sizeof(Interval)==2*sizeof(double), "unexpected memory layout of intervals");
+
+/* (a,b)->(-a,b) in place (and conversely) */
+inline void neg_lb(Interval* x, int n) {
+	double* p=(double*) x;
+	for (int i=0; i<2*n; i+=2)
+		p[i]=-p[i];
+}
+
+#else
+
+inline void unpack(const double* p, Interval* x, int n) {
+	for (int i=0; i<n; i++)
+		x[i]=Interval(-p[2*i],p[2*i+1]);
+}
+
+#endif
+
+inline void pack(const Interval* x, int n, double* p) {
+	for (int i=0; i<n; i++) {
+		p[2*i]=-x[i].lb();
+		p[2*i+1]=x[i].ub();
+	}
+}
+
+#endif
+
+/*
+ * Apply k(px,py,m) to the packed arrays of x and y, where k
+ * updates px. Stop as soon as k returns false.
+ */
+template<typename K>
+bool apply(K k, Interval* x, const Interval* y, int n) {
+#ifdef IBEX_INTERVAL_NEG_LB_LAYOUT
+	return k((double*) x, (const double*) y, 2*n);
+#else
+	double py[2*CHUNK];
+#ifndef IBEX_INTERVAL_LB_UB_LAYOUT
+	double px[2*CHUNK];
+#endif
+	for (int i=0; i<n; i+=CHUNK) {
+		int c=n-i<CHUNK? n-i : CHUNK;
+		// y is packed first (x and y may be the same array)
+		pack(y+i,c,py);
+#ifdef IBEX_INTERVAL_LB_UB_LAYOUT
+		// x is packed in place
+		neg_lb(x+i,c);
+		bool ok=k((double*) (x+i),py,2*c);
+		neg_lb(x+i,c);
+		if (!ok) return false;
+#else
+		pack(x+i,c,px);
+		if (!k(px,py,2*c)) return false;
+		unpack(px,x+i,c);
+#endif
+	}
+	return true;
+#endif
+}
+
+} // end anonymous namespace
+
+SimdBackend simd_backend() {
+	return _backend;
+}
+
+SimdBackend simd_set_backend(SimdBackend b) {
+	SimdBackend best=best_backend();
+	_backend = b>best ? best : b;
+	kernels=&kernels_of(_backend);
+	return _backend;
+}
+
+const char* simd_backend_name(SimdBackend b) {
+	switch (b) {
+	case SIMD_AVX512: return "avx512";
+	case SIMD_AVX2:   return "avx2";
+	default:          return "scalar";
+	}
+}
+
+void simd_add(Interval* x, const Interval* y, int n) {
+	if (n<MIN_SIZE) {
+		for (int i=0; i<n; i++) x[i]+=y[i];
+		return;
+	}
+	RoundUp r;
+	apply([](double* px, const double* py, int m) { kernels->add(px,py,m); return true; }, x, y, n);
+}
+
+void simd_sub(Interval* x, const Interval* y, int n) {
+	if (n<MIN_SIZE) {
+		for (int i=0; i<n; i++) x[i]-=y[i];
+		return;
+	}
+	RoundUp r;
+	apply([](double* px, const double* py, int m) { kernels->sub(px,py,m); return true; }, x, y, n);
+}
+
+bool simd_inter(Interval* x, const Interval* y, int n) {
+	if (n<MIN_SIZE) {
+		for (int i=0; i<n; i++) {
+			x[i]&=y[i];
+			if (x[i].is_empty()) return false;
+		}
+		return true;
+	}
+	return apply([](double* px, const double* py, int m) { return kernels->inter(px,py,m); }, x, y, n);
+}
+
+void simd_hull(Interval* x, const Interval* y, int n) {
+	if (n<MIN_SIZE) {
+		for (int i=0; i<n; i++) x[i]|=y[i];
+		return;
+	}
+	apply([](double* px, const double* py, int m) { kernels->hull(px,py,m); return true; }, x, y, n);
+}
+
+void simd_diam(const Interval* x, double* d, int n) {
+	if (n<MIN_SIZE) {
+		for (int i=0; i<n; i++) d[i]=x[i].diam();
+		return;
+	}
+#ifndef IBEX_INTERVAL_DIAM_ROUND_NEAR
+	// same rounding as Interval::diam
+	RoundUp r;
+#endif
+#ifdef IBEX_INTERVAL_NEG_LB_LAYOUT
+	kernels->diam((const double*) x,d,2*n);
+#else
+	double px[2*CHUNK];
+	for (int i=0; i<n; i+=CHUNK) {
+		int c=n-i<CHUNK? n-i : CHUNK;
+		pack(x+i,c,px);
+		kernels->diam(px,d+i,2*c);
+	}
+#endif
+}
+
+void simd_axpy(double a, const Interval* x, Interval* y, int n) {
+	if (a==0) return;
+	if (a==POS_INFINITY || a==NEG_INFINITY) {
+		for (int i=0; i<n; i++) y[i].set_empty();
+		return;
+	}
+	if (n<MIN_SIZE) {
+		for (int i=0; i<n; i++) y[i]+=a*x[i];
+		return;
+	}
+	RoundUp r;
+	// y plays the role of x in "apply"
+	apply([a](double* py, const double* px, int m) { kernels->axpy(a,px,py,m); return true; }, y, x, n);
+}
+
+Interval simd_dot(const double* a, const Interval* x, int n) {
+	for (int i=0; i<n; i++)
+		if (a[i]==POS_INFINITY || a[i]==NEG_INFINITY) return Interval::EMPTY_SET;
+
+	if (n<MIN_SIZE) {
+		Interval s=Interval::ZERO;
+		for (int i=0; i<n; i++)
+			if (a[i]!=0) s+=a[i]*x[i]; // 0*[x]=0, even if x is unbounded
+		return s;
+	}
+
+	double p[2*CHUNK];
+	double nl=0, u=0;
+	RoundUp r;
+	for (int i=0; i<n; i+=CHUNK) {
+		int c=n-i<CHUNK? n-i : CHUNK;
+#ifdef IBEX_INTERVAL_NEG_LB_LAYOUT
+		kernels->mul(a+i,(const double*) (x+i),p,2*c);
+#else
+		double px[2*CHUNK];
+		pack(x+i,c,px);
+		kernels->mul(a+i,px,p,2*c);
+#endif
+		sum_scalar(p,2*c,nl,u);
+	}
+	return Interval(-nl,u);
+}
+
+} // end namespace ibex
@@ -0,0 +1,116 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SimdArith.h
+// Author      : Gilles Chabert
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_SIMD_ARITH_H__
+#define __IBEX_SIMD_ARITH_H__
+
+#include "ibex_Interval.h"
+
+namespace ibex {
+
+/**\ingroup arithmetic */
+/*@{*/
+
+/**
+ * \brief Backends for bulk interval operations.
+ *
+ * The bulk operations below work on arrays of intervals. An interval [a,b]
+ * is handled as the pair (-a,b) and the rounding mode is set upward once
+ * for the whole loop, so that both bounds are computed with the same
+ * (upward) rounding: the lower bound of x+y is -((-a)+(-c)), etc.
+ *
+ * The backend is selected at runtime (Linux/x86 only, with gcc/clang)
+ * according to the instruction set of the processor. On other platforms,
+ * the scalar backend is used.
+ */
+typedef enum { SIMD_SCALAR, SIMD_AVX2, SIMD_AVX512 } SimdBackend;
+
+/**
+ * \brief The backend currently used.
+ */
+SimdBackend simd_backend();
+
+/**
+ * \brief Force the backend (for tests and benchmarks).
+ *
+ * If the backend is not supported by the processor, the best supported one
+ * is used instead. Return the backend actually selected.
+ */
+SimdBackend simd_set_backend(SimdBackend b);
+
+/**
+ * \brief Name of a backend ("scalar", "avx2" or "avx512").
+ */
+const char* simd_backend_name(SimdBackend b);
+
+/**
+ * \brief x[i]:=x[i]+y[i] for i=0..n-1.
+ *
+ * \pre No interval is empty.
+ */
+void simd_add(Interval* x, const Interval* y, int n);
+
+/**
+ * \brief x[i]:=x[i]-y[i] for i=0..n-1.
+ *
+ * \pre No interval is empty.
+ */
+void simd_sub(Interval* x, const Interval* y, int n);
+
+/**
+ * \brief x[i]:=x[i]&y[i] for i=0..n-1.
+ *
+ * \pre No interval is empty.
+ * \return false if one of the x[i] is empty (in this case,
+ *         the content of x is undefined).
+ */
+bool simd_inter(Interval* x, const Interval* y, int n);
+
+/**
+ * \brief x[i]:=x[i]|y[i] for i=0..n-1.
+ *
+ * \pre No interval is empty.
+ */
+void simd_hull(Interval* x, const Interval* y, int n);
+
+/**
+ * \brief d[i]:=diam(x[i]) for i=0..n-1.
+ *
+ * The result is rounded like Interval::diam() (upward, except
+ * for the direct backend).
+ *
+ * \pre No interval is empty.
+ */
+void simd_diam(const Interval* x, double* d, int n);
+
+/**
+ * \brief y[i]:=y[i]+a*x[i] for i=0..n-1.
+ *
+ * As with scalar operations, if a is infinite, all the y[i] are set to the empty set.
+ *
+ * \pre No interval is empty.
+ */
+void simd_axpy(double a, const Interval* x, Interval* y, int n);
+
+/**
+ * \brief Return a[0]*x[0]+...+a[n-1]*x[n-1].
+ *
+ * The sum is performed in the natural order (left to right).
+ * As with scalar operations, the result is empty if one of the a[i] is infinite.
+ *
+ * \pre No interval is empty.
+ */
+Interval simd_dot(const double* a, const Interval* x, int n);
+
+/*@}*/
+
+} // end namespace ibex
+
+#endif // __IBEX_SIMD_ARITH_H__
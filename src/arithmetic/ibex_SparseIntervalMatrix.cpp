@@ -0,0 +1,133 @@
+/* ============================================================================
+ * I B E X - ibex_SparseIntervalMatrix.cpp
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_SparseIntervalMatrix.h"
+
+#include <algorithm>
+
+using namespace std;
+
+namespace ibex {
+
+SparseIntervalMatrix::SparseIntervalMatrix(int nb_rows, int nb_cols) :
+		_nb_rows(nb_rows), _nb_cols(nb_cols), ptr(nb_rows+1,0), empty(false) {
+	assert(nb_rows>0);
+	assert(nb_cols>0);
+}
+
+SparseIntervalMatrix::SparseIntervalMatrix(int nb_cols, const vector<vector<int> >& rows) :
+		_nb_rows((int) rows.size()), _nb_cols(nb_cols), ptr(rows.size()+1), empty(false) {
+	assert(_nb_rows>0);
+	assert(nb_cols>0);
+
+	ptr[0]=0;
+	for (int i=0; i<_nb_rows; i++)
+		ptr[i+1]=ptr[i]+(int) rows[i].size();
+
+	idx.reserve(ptr[_nb_rows]);
+	for (int i=0; i<_nb_rows; i++) {
+		for (vector<int>::const_iterator it=rows[i].begin(); it!=rows[i].end(); it++) {
+			assert(*it>=0 && *it<nb_cols);
+			assert(it==rows[i].begin() || *it>*(it-1));
+			idx.push_back(*it);
+		}
+	}
+
+	values.resize(idx.size(),Interval::ZERO);
+}
+
+SparseIntervalMatrix::SparseIntervalMatrix(const IntervalMatrix& A) :
+		_nb_rows(A.nb_rows()), _nb_cols(A.nb_cols()), ptr(A.nb_rows()+1), empty(A.is_empty()) {
+
+	ptr[0]=0;
+	for (int i=0; i<_nb_rows; i++) {
+		if (!empty) {
+			for (int j=0; j<_nb_cols; j++) {
+				if (A[i][j]==Interval::ZERO) continue;
+				idx.push_back(j);
+				values.push_back(A[i][j]);
+			}
+		}
+		ptr[i+1]=(int) idx.size();
+	}
+}
+
+int SparseIntervalMatrix::find(int i, int j) const {
+	assert(j>=0 && j<_nb_cols);
+	vector<int>::const_iterator begin=idx.begin()+row_begin(i);
+	vector<int>::const_iterator end=idx.begin()+row_end(i);
+	vector<int>::const_iterator it=lower_bound(begin,end,j);
+	return (it==end || *it!=j) ? -1 : (int) (it-idx.begin());
+}
+
+SparseIntervalMatrix SparseIntervalMatrix::rows(const BitSet& rows) const {
+	assert(!rows.empty() && rows.max()<_nb_rows);
+
+	SparseIntervalMatrix A(rows.size(), _nb_cols);
+
+	int i=rows.min(); // row number in this matrix
+
+	for (int r=0; r<rows.size(); r++) {
+		if (r>0) i=rows.next(i);
+		A.idx.insert(A.idx.end(), idx.begin()+ptr[i], idx.begin()+ptr[i+1]);
+		A.values.insert(A.values.end(), values.begin()+ptr[i], values.begin()+ptr[i+1]);
+		A.ptr[r+1]=(int) A.idx.size();
+	}
+	A.empty=empty;
+	return A;
+}
+
+IntervalMatrix SparseIntervalMatrix::dense() const {
+	IntervalMatrix A(_nb_rows, _nb_cols, Interval::ZERO);
+
+	if (empty)
+		A.set_empty();
+	else
+		for (int i=0; i<_nb_rows; i++)
+			for (int k=ptr[i]; k<ptr[i+1]; k++)
+				A[i][idx[k]]=values[k];
+
+	return A;
+}
+
+void SparseIntervalMatrix::set_empty() {
+	empty=true;
+	fill(values.begin(), values.end(), Interval::EMPTY_SET);
+}
+
+void SparseIntervalMatrix::clear() {
+	empty=false;
+	fill(values.begin(), values.end(), Interval::ZERO);
+}
+
+IntervalVector operator*(const SparseIntervalMatrix& A, const IntervalVector& x) {
+	assert(A.nb_cols()==x.size());
+
+	IntervalVector y(A.nb_rows());
+
+	if (A.is_empty() || x.is_empty()) {
+		y.set_empty();
+		return y;
+	}
+
+	for (int i=0; i<A.nb_rows(); i++) {
+		y[i]=Interval::ZERO;
+		for (int k=A.row_begin(i); k<A.row_end(i); k++)
+			y[i]+=A.val(k)*x[A.col(k)];
+	}
+	return y;
+}
+
+std::ostream& operator<<(std::ostream& os, const SparseIntervalMatrix& A) {
+	return os << A.dense();
+}
+
+} // namespace ibex
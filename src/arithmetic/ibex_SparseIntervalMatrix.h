@@ -0,0 +1,208 @@
+/* ============================================================================
+ * I B E X - Sparse matrix of intervals
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_SPARSE_INTERVAL_MATRIX_H__
+#define __IBEX_SPARSE_INTERVAL_MATRIX_H__
+
+#include "ibex_IntervalMatrix.h"
+#include "ibex_BitSet.h"
+
+#include <vector>
+#include <iostream>
+
+namespace ibex {
+
+/**
+ * \ingroup arithmetic
+ *
+ * \brief Sparse interval matrix (compressed sparse row format).
+ *
+ * Only the entries of a given <i>pattern</i> are stored; all the other
+ * entries are (exactly) [0,0]. The entries of the ith row are stored at
+ * positions row_begin(i),...,row_end(i)-1, by increasing column number:
+ * <pre>
+ *   for (int k=A.row_begin(i); k<A.row_end(i); k++)
+ *       ... A.col(k) ... A.val(k) ...
+ * </pre>
+ *
+ * The pattern is fixed at construction. A stored entry may be [0,0].
+ */
+class SparseIntervalMatrix {
+
+public:
+	/**
+	 * \brief Create a (nb_rows x nb_cols) zero matrix (no stored entry).
+	 */
+	SparseIntervalMatrix(int nb_rows, int nb_cols);
+
+	/**
+	 * \brief Create a (rows.size() x nb_cols) matrix with a given pattern.
+	 *
+	 * rows[i] contains the column numbers of the stored entries of the ith row,
+	 * in increasing order. The entries are initialized to [0,0].
+	 */
+	SparseIntervalMatrix(int nb_cols, const std::vector<std::vector<int> >& rows);
+
+	/**
+	 * \brief Create a sparse copy of a dense matrix.
+	 *
+	 * The [0,0] entries of A are not stored.
+	 * If A is empty, the matrix is empty.
+	 */
+	explicit SparseIntervalMatrix(const IntervalMatrix& A);
+
+	/**
+	 * \brief Number of rows.
+	 */
+	int nb_rows() const;
+
+	/**
+	 * \brief Number of columns.
+	 */
+	int nb_cols() const;
+
+	/**
+	 * \brief Number of stored entries.
+	 */
+	int nnz() const;
+
+	/**
+	 * \brief Position of the first stored entry of the ith row.
+	 */
+	int row_begin(int i) const;
+
+	/**
+	 * \brief Position after the last stored entry of the ith row.
+	 */
+	int row_end(int i) const;
+
+	/**
+	 * \brief Column of the kth stored entry.
+	 */
+	int col(int k) const;
+
+	/**
+	 * \brief Value of the kth stored entry.
+	 */
+	Interval& val(int k);
+
+	/**
+	 * \brief Value of the kth stored entry (const version).
+	 */
+	const Interval& val(int k) const;
+
+	/**
+	 * \brief Position of the entry (i,j), -1 if not stored.
+	 *
+	 * Complexity: logarithmic in the number of stored entries of the ith row.
+	 */
+	int find(int i, int j) const;
+
+	/**
+	 * \brief The entry (i,j) ([0,0] if not stored).
+	 */
+	Interval operator()(int i, int j) const;
+
+	/**
+	 * \brief The submatrix made of the selected rows.
+	 */
+	SparseIntervalMatrix rows(const BitSet& rows) const;
+
+	/**
+	 * \brief Dense copy.
+	 */
+	IntervalMatrix dense() const;
+
+	/**
+	 * \brief Set this matrix to the empty matrix.
+	 */
+	void set_empty();
+
+	/**
+	 * \brief True iff this matrix is empty.
+	 *
+	 * \note A matrix is empty only if set_empty() was called
+	 *       (or if it was built from an empty dense matrix).
+	 */
+	bool is_empty() const;
+
+	/**
+	 * \brief Set all the stored entries to [0,0] (the pattern is kept).
+	 */
+	void clear();
+
+protected:
+	int _nb_rows;
+	int _nb_cols;
+	std::vector<int> ptr;         // first position of each row (size nb_rows+1)
+	std::vector<int> idx;         // column of each stored entry
+	std::vector<Interval> values; // value of each stored entry
+	bool empty;
+};
+
+/**
+ * \brief Product of a sparse matrix by a vector.
+ */
+IntervalVector operator*(const SparseIntervalMatrix& A, const IntervalVector& x);
+
+/**
+ * \brief Display the sparse matrix (in dense form).
+ */
+std::ostream& operator<<(std::ostream& os, const SparseIntervalMatrix& A);
+
+/*================================== inline implementations ========================================*/
+
+inline int SparseIntervalMatrix::nb_rows() const {
+	return _nb_rows;
+}
+
+inline int SparseIntervalMatrix::nb_cols() const {
+	return _nb_cols;
+}
+
+inline int SparseIntervalMatrix::nnz() const {
+	return (int) idx.size();
+}
+
+inline int SparseIntervalMatrix::row_begin(int i) const {
+	assert(i>=0 && i<_nb_rows);
+	return ptr[i];
+}
+
+inline int SparseIntervalMatrix::row_end(int i) const {
+	assert(i>=0 && i<_nb_rows);
+	return ptr[i+1];
+}
+
+inline int SparseIntervalMatrix::col(int k) const {
+	return idx[k];
+}
+
+inline Interval& SparseIntervalMatrix::val(int k) {
+	return values[k];
+}
+
+inline const Interval& SparseIntervalMatrix::val(int k) const {
+	return values[k];
+}
+
+inline Interval SparseIntervalMatrix::operator()(int i, int j) const {
+	int k=find(i,j);
+	return k==-1? Interval::ZERO : values[k];
+}
+
+inline bool SparseIntervalMatrix::is_empty() const {
+	return empty;
+}
+
+} // namespace ibex
+
+#endif // __IBEX_SPARSE_INTERVAL_MATRIX_H__
@@ -27,27 +27,32 @@ static int precond_OK=0;
 
 namespace ibex {
 
-CtcKhunTucker::CtcKhunTucker(const NormalizedSystem& sys) : Ctc(sys.nb_var), sys(sys) {
+CtcKhunTucker::CtcKhunTucker(const NormalizedSystem& sys) : Ctc(sys.nb_var), sys(sys), df(NULL), dg(NULL), diff_done(false) {
+
+	for (int i=0; i<sys.nb_ctr; i++) {
+		if (!sys.ctrs[i].f.expr().dim.is_scalar())
+			not_implemented("Khun-Tucker conditions with vector/matrix constraints.");
+	}
+}
+
+void CtcKhunTucker::diff() {
+	diff_done=true;
+
 	try {
-		df = new Function(*sys.goal,Function::DIFF);
+		df = &sys.goal->diff();
 	} catch(Exception&) {
 		//TODO: replace with ExprDiffException.
 		// Currently, DimException is also sometimes raised.
 		cerr << "Warning: symbolic differentiation of the goal function has failed ==> first-order contraction disabled" << endl;
 		df = NULL;
+		return;
 	}
 
 	if (sys.nb_ctr>0) {
-		dg = new Function*[sys.nb_ctr];
-
-		for (int i=0; i<sys.nb_ctr; i++) {
-			if (!sys.ctrs[i].f.expr().dim.is_scalar())
-				not_implemented("Khun-Tucker conditions with vector/matrix constraints.");
+		dg = new const Function*[sys.nb_ctr];
 
-			dg[i] = new Function(sys.ctrs[i].f,Function::DIFF);
-		}
-	} else {
-		dg = NULL;
+		for (int i=0; i<sys.nb_ctr; i++)
+			dg[i] = &sys.ctrs[i].f.diff();
 	}
 }
 
@@ -60,12 +65,13 @@ CtcKhunTucker::~CtcKhunTucker() {
 	cout << " lu_OK=" << lu_OK << endl;
 	cout << " precond_OK" << precond_OK << endl;
 
-	if (df) delete df;
 	if (dg!=NULL) delete[] dg;
 }
 
 void CtcKhunTucker::contract(IntervalVector& box) {
 
+	if (!diff_done) diff();
+
 	if (df==NULL) return;
 
 //	if (sys.nb_ctr==0) {
@@ -26,8 +26,10 @@ public:
 	/**
 	 * \brief Build the contractor for a given NLP problem.
 	 *
-	 * \warning: building this object is **costly** in both time and memory!
-	 *           Don't build this contractor on-the-fly.
+	 * The symbolic gradients of the objective and the constraints
+	 * are only calculated at the first contraction. They are the
+	 * derivatives of the functions of sys (see Function::diff()),
+	 * hence shared with any other user of these derivatives.
 	 *
 	 * \warning: sys.box should be properly set before calling this constructor.
 	 *           In particular, this field **should not change** once this
@@ -53,15 +55,27 @@ protected:
 	 */
 	const NormalizedSystem& sys;
 
+	/**
+	 * \brief Calculate the symbolic gradients.
+	 */
+	void diff();
+
 	/**
 	 * \brief Symbolic gradient of the objective.
+	 *
+	 * NULL if not calculated yet or if differentiation has failed.
 	 */
-	Function* df;
+	const Function* df;
 
 	/**
 	 * \brief Symbolic gradient of constraints.
 	 */
-	Function** dg;
+	const Function** dg;
+
+	/**
+	 * \brief Whether #diff() has been called.
+	 */
+	bool diff_done;
 };
 
 } /* namespace ibex */
@@ -55,6 +55,8 @@ public:
 	virtual void contract(IntervalVector& box);
 
 protected:
+	friend class ParallelGroups;
+
 	const Function& f;
 
 	/**
@@ -66,7 +66,10 @@ void CtcPolytopeHull::contract(IntervalVector& box) {
 		//mylinearsolver.writeFile("LP.lp");
 		//system ("cat LP.lp");
 		//cout << "[polytope-hull] box after LR: " << box << endl;
-		mylinearsolver.clean_ctrs();
+
+		// an incremental linearizer updates its rows at the next call
+		if (!lr.is_incremental())
+			mylinearsolver.clean_ctrs();
 	}
 	catch(LPException&) {
 		mylinearsolver.clean_ctrs();
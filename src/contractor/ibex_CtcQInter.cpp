@@ -13,18 +13,33 @@
 
 namespace ibex {
 
-CtcQInter::CtcQInter(const Array<Ctc>& list, int q) : Ctc(list), list(list), q(q), boxes(list.size(), nb_var) { }
+CtcQInter::CtcQInter(const Array<Ctc>& list, int q, int nb_threads) : Ctc(list), list(list), q(q), boxes(list.size(), nb_var),
+		groups(list), pool(nb_threads>1 && groups.size()>1? new ThreadPool(nb_threads) : NULL) { }
 
+CtcQInter::CtcQInter(const CtcQInter& c) : Ctc(c), list(c.list), q(c.q), boxes(c.boxes),
+		groups(c.groups), pool(c.pool? new ThreadPool(c.pool->nb_threads) : NULL) { }
+
+CtcQInter::~CtcQInter() {
+	if (pool) delete pool;
+}
 
 void CtcQInter::contract(IntervalVector& box) {
 	Array<IntervalVector> refs(list.size());
 
 	for (int i=0; i<list.size(); i++) {
 		boxes[i]=box;
-		list[i].contract(boxes[i]);
 		refs.set_ref(i,boxes[i]);
 	}
 
+	if (pool)
+		pool->run(groups.size(), [this](int g) {
+			for (std::vector<int>::const_iterator i=groups[g].begin(); i!=groups[g].end(); i++)
+				list[*i].contract(boxes[*i]);
+		});
+	else
+		for (int i=0; i<list.size(); i++)
+			list[i].contract(boxes[i]);
+
 	box = qinter(refs,q);
 }
 
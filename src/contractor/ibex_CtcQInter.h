@@ -14,6 +14,8 @@
 #include "ibex_Ctc.h"
 #include "ibex_Array.h"
 #include "ibex_IntervalMatrix.h"
+#include "ibex_ThreadPool.h"
+#include "ibex_ParallelGroups.h"
 
 namespace ibex {
 
@@ -28,8 +30,24 @@ public:
 	 * \brief q-intersection on a list of contractors.
 	 *
 	 * The list itself is not kept by reference.
+	 *
+	 * With nb_threads>1, the contractors of the list are applied in parallel
+	 * (the result is the same as with a sequential contraction). Contractors
+	 * that share a function are applied by the same thread, one after the other
+	 * (see #ParallelGroups). In particular, if all the contractors are built
+	 * on the same function, the contraction is sequential.
 	 */
-	CtcQInter(const Array<Ctc>& list, int q);
+	CtcQInter(const Array<Ctc>& list, int q, int nb_threads=1);
+
+	/**
+	 * \brief Duplicate a q-intersection (with its own threads).
+	 */
+	CtcQInter(const CtcQInter& c);
+
+	/**
+	 * \brief Delete *this.
+	 */
+	virtual ~CtcQInter();
 
 	/**
 	 * \brief Contract the box.
@@ -48,7 +66,11 @@ public:
 	int q;
 
 protected:
-	IntervalMatrix boxes; // store boxes for each contraction
+	IntervalMatrix boxes;  // store boxes for each contraction
+
+	ParallelGroups groups; // contractors that can be applied in parallel
+
+	ThreadPool* pool;      // NULL for a sequential contraction
 };
 
 } // end namespace ibex
@@ -0,0 +1,155 @@
+//============================================================================
+//                                  I B E X                                   
+// File        : HC4 with a shared DAG
+// Author      : Gilles Chabert
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "ibex_CtcSharedHC4.h"
+#include "ibex_Expr2DAG.h"
+#include "ibex_ExprCopy.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/* right-hand side of "f_i(x) op 0" (see NumConstraint::right_hand_side()) */
+Interval rhs(CmpOp op) {
+	switch (op) {
+	case LT :
+	case LEQ : return Interval::NEG_REALS;
+	case EQ  : return Interval::ZERO;
+	default  : return Interval::POS_REALS;
+	}
+}
+
+/*
+ * Revise of the ith component of the shared function
+ * (same as CtcFwdBwd otherwise).
+ */
+class CtcSharedFwdBwd : public Ctc {
+public:
+	CtcSharedFwdBwd(Function& f, int i, const Function& fi, CmpOp op) :
+		Ctc(f.nb_var()), f(f), i(i), y(rhs(op)), unshared_evals(0) {
+
+		input = new BitSet(nb_var);
+		output = new BitSet(nb_var);
+
+		for (int j=0; j<fi.nb_used_vars(); j++) {
+			input->add(fi.used_var(j));
+			output->add(fi.used_var(j));
+		}
+
+		Eval& eval=f.basic_evaluator();
+		vector_valued = eval.fwd_agenda!=NULL;
+
+		if (!vector_valued) eval.set_incremental(true);
+
+		size=0;
+		if (vector_valued) {
+			const Agenda& a=*eval.fwd_agenda[i];
+			for (int j=a.first(); j!=a.end(); j=a.next(j))
+				if (!dynamic_cast<const ExprSymbol*>(&f.node(j))) size++;
+		} else {
+			for (int j=0; j<f.expr().size(); j++)
+				if (!dynamic_cast<const ExprSymbol*>(&f.node(j))) size++;
+		}
+	}
+
+	~CtcSharedFwdBwd() {
+		delete input;
+		delete output;
+	}
+
+	virtual void contract(IntervalVector& box) {
+		unshared_evals += size;
+
+		bool inactive = vector_valued ?
+				f.hc4revise().proj(y,box,i) : f.backward(y,box);
+
+		if (inactive) {
+			set_flag(INACTIVE);
+			set_flag(FIXPOINT);
+		}
+
+		if (box.is_empty()) {
+			set_flag(FIXPOINT);
+		}
+	}
+
+	Function& f;
+	const int i;
+	const Interval y;
+	bool vector_valued;
+	int size;            // number of nodes of the component (except symbols)
+	long unshared_evals;
+};
+
+Array<Ctc> convert(const System& sys) {
+
+	const Function& fc=sys.f_ctrs;
+
+	Array<const ExprSymbol> x(fc.nb_arg());
+	varcopy(fc.args(),x);
+
+	const ExprNode& y=Expr2DAG().transform(fc.args(),(const Array<const ExprNode>&) x,fc.expr());
+
+	Function* f=new Function(x,y);
+
+	vector<Ctc*> vec;
+	int i=0; // component index
+	for (int k=0; k<sys.ctrs.size(); k++) {
+		const Function& fk=sys.ctrs[k].f;
+		for (int l=0; l<fk.image_dim(); l++, i++)
+			vec.push_back(new CtcSharedFwdBwd(*f,i,fk,sys.ops[i]));
+	}
+	return vec;
+}
+
+inline CtcSharedFwdBwd& revise(const Array<Ctc>& list, int i) {
+	return (CtcSharedFwdBwd&) list[i];
+}
+
+}
+
+CtcSharedHC4::CtcSharedHC4(const System& sys, double ratio, bool incremental) :
+		CtcPropag(convert(sys), ratio, incremental), _nb_nodes_unshared(sys.f_ctrs.expr().size()) {
+
+}
+
+CtcSharedHC4::~CtcSharedHC4() {
+	Function* f=&revise(list,0).f;
+	for (int i=0; i<list.size(); i++)
+		delete &list[i];
+	delete f;
+}
+
+const Function& CtcSharedHC4::f() const {
+	return revise(list,0).f;
+}
+
+int CtcSharedHC4::nb_nodes() const {
+	return f().expr().size();
+}
+
+int CtcSharedHC4::nb_nodes_unshared() const {
+	return _nb_nodes_unshared;
+}
+
+long CtcSharedHC4::nb_evals() const {
+	return f().basic_evaluator().nb_incremental_evals();
+}
+
+long CtcSharedHC4::nb_evals_unshared() const {
+	long n=0;
+	for (int i=0; i<list.size(); i++)
+		n+=revise(list,i).unshared_evals;
+	return n;
+}
+
+} // end namespace ibex
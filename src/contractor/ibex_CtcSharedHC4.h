@@ -0,0 +1,83 @@
+//============================================================================
+//                                  I B E X                                   
+// File        : HC4 with a shared DAG
+// Author      : Gilles Chabert
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_CTC_SHARED_HC4_H__
+#define __IBEX_CTC_SHARED_HC4_H__
+
+#include "ibex_CtcPropag.h"
+#include "ibex_System.h"
+
+namespace ibex {
+
+/** \ingroup contractor
+ *
+ * \brief HC4 propagation with common subexpressions shared by all the constraints.
+ *
+ * Contrary to CtcHC4, where each constraint has its own function, all the
+ * constraints of the system are compiled into a single DAG, where the
+ * subexpressions common to several constraints appear only once.
+ *
+ * The forward phase of each revise is incremental: a node is only
+ * evaluated if the domain of a variable it depends on has changed since its
+ * last evaluation. In particular, a subexpression shared by several
+ * constraints is evaluated once for all these constraints (on the same box).
+ *
+ * There is one revise per component of sys.f_ctrs (a vector
+ * constraint results in several revises).
+ */
+class CtcSharedHC4 : public CtcPropag {
+public:
+	/**
+	 * \brief Create the HC4 propagation with a system.
+	 *
+	 * \param sys - The system
+	 * \param ratio (optional) - \see #ibex::Propagation
+	 * \param incremental (optional) - \see #ibex::Propagation
+	 */
+	CtcSharedHC4(const System& sys, double ratio=default_ratio, bool incremental=false);
+
+	/**
+	 * \brief Delete *this.
+	 */
+	~CtcSharedHC4();
+
+	/**
+	 * \brief Number of nodes of the shared DAG.
+	 */
+	int nb_nodes() const;
+
+	/**
+	 * \brief Number of nodes without sharing subexpressions between constraints.
+	 */
+	int nb_nodes_unshared() const;
+
+	/**
+	 * \brief Number of node evaluations performed so far.
+	 */
+	long nb_evals() const;
+
+	/**
+	 * \brief Number of node evaluations that the same revises would have
+	 *        performed without sharing (and without incrementality).
+	 */
+	long nb_evals_unshared() const;
+
+	/**
+	 * \brief The function with the shared DAG.
+	 */
+	const Function& f() const;
+
+protected:
+	/** Number of nodes of sys.f_ctrs. */
+	int _nb_nodes_unshared;
+};
+
+} // end namespace ibex
+#endif // __IBEX_CTC_SHARED_HC4_H__
@@ -0,0 +1,161 @@
+//============================================================================
+//                                  I B E X
+// File        : Groups of contractors applied in parallel
+// Author      : Gilles Chabert
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "ibex_ParallelGroups.h"
+#include "ibex_CtcFwdBwd.h"
+#include "ibex_CtcNotIn.h"
+#include "ibex_CtcCompo.h"
+#include "ibex_CtcUnion.h"
+#include "ibex_CtcIdentity.h"
+#include "ibex_CtcEmpty.h"
+#include "ibex_SepCtcPair.h"
+#include "ibex_SepNot.h"
+#include "ibex_SepInter.h"
+#include "ibex_SepUnion.h"
+#include "ibex_Expr.h"
+
+#include <map>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// Add f and the functions it calls (ExprApply nodes)
+void add(const Function& f, vector<const Function*>& fs) {
+	for (vector<const Function*>::const_iterator it=fs.begin(); it!=fs.end(); it++)
+		if (*it==&f) return;
+
+	fs.push_back(&f);
+
+	for (int i=0; i<f.nb_nodes(); i++) {
+		const ExprApply* a=dynamic_cast<const ExprApply*>(&f.node(i));
+		if (a) add(a->func,fs);
+	}
+}
+
+} // end anonymous namespace
+
+bool ParallelGroups::functions(Ctc& c, vector<const Function*>& fs) {
+	if (CtcFwdBwd* fb=dynamic_cast<CtcFwdBwd*>(&c)) {
+		add(fb->f,fs);
+		return true;
+	}
+	if (CtcNotIn* n=dynamic_cast<CtcNotIn*>(&c)) {
+		add(n->f,fs);
+		return true;
+	}
+	if (CtcCompo* compo=dynamic_cast<CtcCompo*>(&c)) {
+		for (int i=0; i<compo->list.size(); i++)
+			if (!functions(compo->list[i],fs)) return false;
+		return true;
+	}
+	if (CtcUnion* u=dynamic_cast<CtcUnion*>(&c)) {
+		for (int i=0; i<u->list.size(); i++)
+			if (!functions(u->list[i],fs)) return false;
+		return true;
+	}
+	return dynamic_cast<CtcIdentity*>(&c) || dynamic_cast<CtcEmpty*>(&c);
+}
+
+bool ParallelGroups::functions(Sep& s, vector<const Function*>& fs) {
+	if (SepCtcPair* pair=dynamic_cast<SepCtcPair*>(&s))
+		return functions(pair->ctc_in,fs) && functions(pair->ctc_out,fs);
+
+	if (SepNot* n=dynamic_cast<SepNot*>(&s))
+		return functions(n->sep,fs);
+
+	if (SepInter* inter=dynamic_cast<SepInter*>(&s)) {
+		for (int i=0; i<inter->list.size(); i++)
+			if (!functions(inter->list[i],fs)) return false;
+		return true;
+	}
+	if (SepUnion* u=dynamic_cast<SepUnion*>(&s)) {
+		for (int i=0; i<u->list.size(); i++)
+			if (!functions(u->list[i],fs)) return false;
+		return true;
+	}
+	return false;
+}
+
+namespace {
+
+// Representative of i (union-find)
+int find(vector<int>& parent, int i) {
+	while (parent[i]!=i) {
+		parent[i]=parent[parent[i]];
+		i=parent[i];
+	}
+	return i;
+}
+
+} // end anonymous namespace
+
+ParallelGroups::ParallelGroups(const Array<Ctc>& list) {
+	vector<vector<const Function*> > f(list.size());
+	bool known=true;
+	for (int i=0; known && i<list.size(); i++)
+		known=functions(list[i],f[i]);
+	build(f,known);
+}
+
+ParallelGroups::ParallelGroups(const Array<Sep>& list) {
+	vector<vector<const Function*> > f(list.size());
+	bool known=true;
+	for (int i=0; known && i<list.size(); i++)
+		known=functions(list[i],f[i]);
+	build(f,known);
+}
+
+void ParallelGroups::build(const vector<vector<const Function*> >& f, bool known) {
+	int n=(int) f.size();
+
+	if (!known) {
+		groups.push_back(vector<int>());
+		for (int i=0; i<n; i++)
+			groups[0].push_back(i);
+		return;
+	}
+
+	vector<int> parent(n);
+	for (int i=0; i<n; i++) parent[i]=i;
+
+	// first contractor using each function
+	map<const Function*,int> owner;
+
+	for (int i=0; i<n; i++) {
+		for (vector<const Function*>::const_iterator it=f[i].begin(); it!=f[i].end(); it++) {
+			map<const Function*,int>::iterator o=owner.find(*it);
+			if (o==owner.end())
+				owner[*it]=i;
+			else {
+				int r1=find(parent,o->second);
+				int r2=find(parent,i);
+				// the smallest index is the representative
+				if (r1<r2) parent[r2]=r1;
+				else parent[r1]=r2;
+			}
+		}
+	}
+
+	// group number of each representative
+	vector<int> num(n,-1);
+	for (int i=0; i<n; i++) {
+		int r=find(parent,i);
+		if (num[r]==-1) {
+			num[r]=(int) groups.size();
+			groups.push_back(vector<int>());
+		}
+		groups[num[r]].push_back(i);
+	}
+}
+
+} // end namespace ibex
@@ -0,0 +1,85 @@
+//============================================================================
+//                                  I B E X
+// File        : Groups of contractors applied in parallel
+// Author      : Gilles Chabert
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_PARALLEL_GROUPS_H__
+#define __IBEX_PARALLEL_GROUPS_H__
+
+#include "ibex_Ctc.h"
+#include "ibex_Sep.h"
+#include "ibex_Function.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup contractor
+ * \brief Partition of a list of contractors (or separators) for a parallel loop.
+ *
+ * The evaluation of a function is not thread-safe (a Function stores
+ * the intermediate domains of its DAG), so two contractors that use the
+ * same function cannot be called concurrently. The list is partitioned
+ * into groups such that two contractors sharing a function (directly or
+ * through a function call) are in the same group. The groups can then
+ * be processed by different threads, the contractors of a group being
+ * applied sequentially, in the order of the list.
+ *
+ * The functions are only known for CtcFwdBwd, CtcNotIn, CtcCompo, CtcUnion,
+ * CtcIdentity, CtcEmpty and for SepCtcPair (e.g., SepFwdBwd), SepNot,
+ * SepInter, SepUnion built on them. If another contractor appears in the
+ * list, all the contractors are put in a single group.
+ */
+class ParallelGroups {
+public:
+	/**
+	 * \brief Build the groups of a list of contractors.
+	 */
+	explicit ParallelGroups(const Array<Ctc>& list);
+
+	/**
+	 * \brief Build the groups of a list of separators.
+	 */
+	explicit ParallelGroups(const Array<Sep>& list);
+
+	/**
+	 * \brief Number of groups.
+	 */
+	int size() const;
+
+	/**
+	 * \brief Indices (in the list) of the contractors of the ith group.
+	 */
+	const std::vector<int>& operator[](int i) const;
+
+private:
+	/** Add the functions used by c. Return false if they are unknown. */
+	static bool functions(Ctc& c, std::vector<const Function*>& fs);
+
+	/** Add the functions used by s. Return false if they are unknown. */
+	static bool functions(Sep& s, std::vector<const Function*>& fs);
+
+	void build(const std::vector<std::vector<const Function*> >& f, bool known);
+
+	std::vector<std::vector<int> > groups;
+};
+
+/*============================================ inline implementation ============================================ */
+
+inline int ParallelGroups::size() const {
+	return (int) groups.size();
+}
+
+inline const std::vector<int>& ParallelGroups::operator[](int i) const {
+	return groups[i];
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_PARALLEL_GROUPS_H__
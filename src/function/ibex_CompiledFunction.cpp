@@ -31,7 +31,7 @@ CompiledFunction::CompiledFunction() : n(0), n_total(0), nodes(NULL), code(NULL)
 
 void CompiledFunction::compile(Function& f) {
 
-	n=f.expr().size;
+	n=f.expr().size();
 	nodes = &f.nodes;
 	n_total = nodes->size();
 
@@ -65,6 +65,18 @@ Agenda* CompiledFunction::agenda(int rank) const {
 	return a;
 }
 
+void CompiledFunction::parents(vector<vector<int> >& p) const {
+	p.clear();
+	p.resize(n);
+
+	for (int i=0; i<n; i++) {
+		// note: i may appear twice in the list of
+		// an argument (e.g., x*x)
+		for (int j=0; j<nb_args[i]; j++)
+			p[args[i][j]].push_back(i);
+	}
+}
+
 void CompiledFunction::visit(const ExprNode& e) {
 	e.acceptVisitor(*this);
 }
@@ -12,6 +12,7 @@
 #define __IBEX_COMPILED_FUNCTION_H__
 
 #include <stack>
+#include <vector>
 
 #include "ibex_Expr.h"
 #include "ibex_ExprVisitor.h"
@@ -83,6 +84,15 @@ public:
 	 */
 	Agenda* agenda(int rank) const;
 
+	/**
+	 * Compute, for each operation i, the list of
+	 * operations that directly use the result of i
+	 * (the reverse of the arguments lists).
+	 *
+	 * Used for incremental evaluation (see #ibex::Eval::eval_incremental).
+	 */
+	void parents(std::vector<std::vector<int> >& p) const;
+
 	/**
 	 * Print the structure to the standard output.
 	 */
@@ -13,12 +13,208 @@
 #include "ibex_Eval.h"
 
 #include <typeinfo>
+#include <algorithm>
+#include <functional>
 
 using namespace std;
 
 namespace ibex {
 
-Eval::Eval(Function& f) : f(f), d(f), fwd_agenda(NULL), bwd_agenda(NULL) {
+/*
+ * A node is "valid" if its domain in "save" is the result of the forward
+ * evaluation with the current "box". If a node is valid, so are all its
+ * sub-nodes (or, equivalently, if a node is invalid, so are all the nodes
+ * depending on it).
+ *
+ * The domain of a valid node in e.d is equal to the domain in "save"
+ * except for the nodes in "modified" (or all of them if "all_modified" is true).
+ */
+class Eval::Incremental {
+public:
+	Incremental(Eval& e);
+
+	~Incremental();
+
+	/* Restore the modified domains and invalidate the nodes depending on
+	 * the variables that differ from the current box. */
+	void update(const IntervalVector& box);
+
+	/* Invalidate the nodes depending on the jth variable */
+	void invalidate(int j);
+
+	/* Run the forward algorithm on the nodes of the agenda and validate them */
+	void forward();
+
+	/* Mark the nodes of the agenda as modified */
+	void modified(const Agenda& a);
+
+	/* Push the nodes depending on the jth variable (in the forward order) */
+	void dependents(int j, vector<int>& nodes);
+
+	Eval& e;
+	int n;                        // number of nodes
+	vector<vector<int> > parents; // parents of each node
+	vector<vector<int> > seeds;   // nodes directly depending on each variable
+	vector<char> valid;           // see above
+	vector<int> pending;          // invalid nodes (possibly with valid or duplicate ones)
+	vector<char> is_modified;     // nodes in "modified"
+	vector<int> _modified;        // nodes whose domain in e.d differs from "save"
+	bool all_modified;            // true if all the domains may differ
+	vector<int> stack;            // for the depth-first traversal of the DAG
+	vector<char> visited;         // for "dependents"
+	Agenda agenda;                // nodes to evaluate, in the forward order
+	Domain** save;                // forward domains (NULL for symbols and references)
+	IntervalVector box;           // box of the valid nodes
+	bool first;                   // true if no box has been evaluated yet
+	long nb_evals;                // number of node evaluations
+};
+
+Eval::Incremental::Incremental(Eval& e) : e(e), n(e.f.expr().size()), valid(n,0),
+		is_modified(n,0), all_modified(false), visited(n,0), agenda(n), box(e.f.nb_var()), first(true), nb_evals(0) {
+
+	Function& f=e.f;
+
+	f.cf.parents(parents);
+
+	save = new Domain*[n];
+	for (int i=0; i<n; i++) {
+		if (dynamic_cast<const ExprSymbol*>(&f.node(i))) {
+			save[i]=NULL;
+			valid[i]=1; // the domain of a symbol is set directly from the box
+		} else {
+			save[i]=e.d.is_alias(i) ? NULL : new Domain(e.d[i]);
+			pending.push_back(i);
+		}
+	}
+
+	seeds.resize(f.nb_var());
+
+	int j=0; // variable index
+
+	for (int s=0; s<f.nb_arg(); s++) {
+		const ExprSymbol& x=f.arg(s);
+		int r=f.nodes.rank(x);
+		int nb_cols=x.dim.nb_cols();
+
+		for (int c=0; c<x.dim.size(); c++, j++) {
+			if (r>=n) continue; // symbol not used
+
+			int row=c/nb_cols;
+			int col=c%nb_cols;
+
+			for (vector<int>::const_iterator it=parents[r].begin(); it!=parents[r].end(); it++) {
+				const ExprIndex* idx=dynamic_cast<const ExprIndex*>(&f.node(*it));
+				// skip the indices of other components of the symbol
+				if (idx && (row<idx->index.first_row() || row>idx->index.last_row() ||
+							col<idx->index.first_col() || col>idx->index.last_col()))
+					continue;
+				seeds[j].push_back(*it);
+			}
+		}
+	}
+}
+
+Eval::Incremental::~Incremental() {
+	for (int i=0; i<n; i++)
+		if (save[i]) delete save[i];
+	delete[] save;
+}
+
+void Eval::Incremental::update(const IntervalVector& x) {
+
+	if (all_modified) {
+		for (int i=0; i<n; i++)
+			if (save[i] && valid[i]) e.d[i] = *save[i];
+		all_modified=false;
+	} else {
+		for (vector<int>::const_iterator it=_modified.begin(); it!=_modified.end(); it++)
+			if (save[*it] && valid[*it]) e.d[*it] = *save[*it];
+	}
+
+	for (vector<int>::const_iterator it=_modified.begin(); it!=_modified.end(); it++)
+		is_modified[*it]=0;
+	_modified.clear();
+
+	Function& f=e.f;
+
+	if (first) {
+		box=x;
+		first=false;
+	} else {
+		for (int k=0; k<f.nb_used_vars(); k++) {
+			int j=f.used_var(k);
+			if (x[j]!=box[j]) {
+				invalidate(j);
+				box[j]=x[j];
+			}
+		}
+	}
+
+	e.d.write_arg_domains(x);
+}
+
+void Eval::Incremental::invalidate(int j) {
+
+	stack.assign(seeds[j].begin(), seeds[j].end());
+
+	while (!stack.empty()) {
+		int i=stack.back();
+		stack.pop_back();
+		// if i is already invalid, so are the nodes depending on it.
+		if (!valid[i]) continue;
+		valid[i]=0;
+		pending.push_back(i);
+		for (vector<int>::const_iterator it=parents[i].begin(); it!=parents[i].end(); it++)
+			if (valid[*it]) stack.push_back(*it);
+	}
+}
+
+void Eval::Incremental::forward() {
+	if (agenda.empty()) return;
+
+	e.f.cf.forward<Eval>(e,agenda); // may throw an EmptyBoxException
+
+	for (int i=agenda.first(); i!=agenda.end(); i=agenda.next(i)) {
+		valid[i]=1;
+		if (save[i]) *save[i] = e.d[i];
+		nb_evals++;
+	}
+}
+
+void Eval::Incremental::modified(const Agenda& a) {
+	if (all_modified) return;
+
+	for (int i=a.first(); i!=a.end(); i=a.next(i)) {
+		if (!is_modified[i]) {
+			is_modified[i]=1;
+			_modified.push_back(i);
+		}
+	}
+}
+
+void Eval::Incremental::dependents(int j, vector<int>& nodes) {
+
+	size_t first=nodes.size();
+
+	stack.assign(seeds[j].begin(), seeds[j].end());
+
+	while (!stack.empty()) {
+		int i=stack.back();
+		stack.pop_back();
+		if (visited[i]) continue;
+		visited[i]=1;
+		nodes.push_back(i);
+		for (vector<int>::const_iterator it=parents[i].begin(); it!=parents[i].end(); it++)
+			if (!visited[*it]) stack.push_back(*it);
+	}
+
+	for (vector<int>::const_iterator it=nodes.begin()+first; it!=nodes.end(); it++)
+		visited[*it]=0;
+
+	sort(nodes.begin()+first, nodes.end(), greater<int>());
+}
+
+Eval::Eval(Function& f) : f(f), d(f), fwd_agenda(NULL), bwd_agenda(NULL), inc_mode(false), inc(NULL) {
 	int m=f.image_dim();
 	if (m>1) {
 		const ExprVector* vec=dynamic_cast<const ExprVector*>(&f.expr());
@@ -42,10 +238,31 @@ Eval::~Eval() {
 		delete[] fwd_agenda;
 		delete[] bwd_agenda;
 	}
+	if (inc) delete inc;
+}
+
+void Eval::domains_modified() {
+	if (inc) inc->all_modified=true;
+}
+
+void Eval::domains_modified(int i) {
+	assert(fwd_agenda!=NULL);
+	if (inc) inc->modified(*bwd_agenda[i]);
+}
+
+void Eval::dependent_nodes(int j, vector<int>& nodes) {
+	if (!inc) inc=new Incremental(*this);
+	inc->dependents(j,nodes);
+}
+
+long Eval::nb_incremental_evals() const {
+	return inc? inc->nb_evals : 0;
 }
 
 Domain& Eval::eval(const Array<const Domain>& d2) {
 
+	domains_modified();
+
 	d.write_arg_domains(d2);
 
 	//------------- for debug
@@ -64,6 +281,8 @@ Domain& Eval::eval(const Array<const Domain>& d2) {
 
 Domain& Eval::eval(const Array<Domain>& d2) {
 
+	domains_modified();
+
 	d.write_arg_domains(d2);
 
 	try {
@@ -76,6 +295,10 @@ Domain& Eval::eval(const Array<Domain>& d2) {
 
 Domain& Eval::eval(const IntervalVector& box) {
 
+	if (inc_mode) return eval_incremental(box);
+
+	domains_modified();
+
 	d.write_arg_domains(box);
 
 	try {
@@ -88,6 +311,8 @@ Domain& Eval::eval(const IntervalVector& box) {
 
 IntervalVector Eval::eval(const IntervalVector& box, const BitSet& components) {
 
+	domains_modified();
+
 	d.write_arg_domains(box);
 
 	assert(!components.empty());
@@ -139,6 +364,85 @@ IntervalVector Eval::eval(const IntervalVector& box, const BitSet& components) {
 	return res;
 }
 
+Domain& Eval::eval_incremental(const IntervalVector& box) {
+
+	assert(box.size()==f.nb_var());
+
+	if (!inc) inc=new Incremental(*this);
+
+	if (box.is_empty()) {
+		domains_modified();
+		d.top->set_empty();
+		return *d.top;
+	}
+
+	inc->update(box);
+
+	vector<int>& pending=inc->pending;
+
+	// note: pending may contain duplicates
+	sort(pending.begin(), pending.end(), greater<int>());
+
+	inc->agenda.flush();
+	for (vector<int>::const_iterator it=pending.begin(); it!=pending.end(); it++)
+		if (!inc->valid[*it]) inc->agenda.push(*it);
+
+	try {
+		inc->forward();
+	} catch(EmptyBoxException&) {
+		// the nodes of the agenda remain invalid
+		d.top->set_empty();
+		return *d.top;
+	}
+
+	pending.clear();
+	return *d.top;
+}
+
+Domain& Eval::eval_incremental(const IntervalVector& box, int i) {
+
+	assert(box.size()==f.nb_var());
+	assert(fwd_agenda!=NULL);
+
+	if (!inc) inc=new Incremental(*this);
+
+	Domain& y=d[bwd_agenda[i]->first()];
+
+	if (box.is_empty()) {
+		domains_modified();
+		y.set_empty();
+		return y;
+	}
+
+	inc->update(box);
+
+	const Agenda& a=*fwd_agenda[i];
+
+	inc->agenda.flush();
+	for (int j=a.first(); j!=a.end(); j=a.next(j))
+		if (!inc->valid[j]) inc->agenda.push(j);
+
+	try {
+		inc->forward();
+	} catch(EmptyBoxException&) {
+		y.set_empty();
+		return y;
+	}
+
+	// remove the nodes validated by evaluations of components
+	// from time to time (otherwise the list would grow indefinitely)
+	vector<int>& pending=inc->pending;
+	if ((int) pending.size()>2*inc->n) {
+		vector<int> tmp;
+		sort(pending.begin(), pending.end());
+		for (vector<int>::const_iterator it=pending.begin(); it!=pending.end(); it++)
+			if (!inc->valid[*it] && (tmp.empty() || tmp.back()!=*it)) tmp.push_back(*it);
+		pending.swap(tmp);
+	}
+
+	return y;
+}
+
 void Eval::idx_cp_fwd(int x, int y) {
 	assert(dynamic_cast<const ExprIndex*> (&f.node(y)));
 
@@ -13,6 +13,7 @@
 #define __IBEX_EVAL_H__
 
 #include <iostream>
+#include <vector>
 
 #include "ibex_ExprDomain.h"
 
@@ -64,7 +65,62 @@ public:
 	 */
 	IntervalVector eval(const IntervalVector& box, const BitSet& components);
 
+	/**
+	 * \brief Incremental evaluation with an input box.
+	 *
+	 * Only the nodes depending on the components of \a box that differ
+	 * from the box of the previous incremental evaluation are re-evaluated.
+	 * The domains of the other nodes are those of the previous evaluation
+	 * (they are restored by a simple copy if they have been modified in the
+	 * meantime, e.g., by a backward algorithm).
+	 *
+	 * Typically, if \a box results from the bisection of the previous box,
+	 * only the nodes depending on the bisected variable are evaluated.
+	 * The first call performs a complete evaluation.
+	 */
+	Domain& eval_incremental(const IntervalVector& box);
+
+	/**
+	 * \brief Incremental evaluation of the ith component.
+	 *
+	 * Same as eval_incremental(const IntervalVector&) except that
+	 * only the nodes of the ith component are (possibly) evaluated.
+	 * The nodes shared with other components are evaluated once
+	 * for all the components.
+	 *
+	 * (Specific for vector-valued functions).
+	 *
+	 * \return the domain of the ith component.
+	 */
+	Domain& eval_incremental(const IntervalVector& box, int i);
+
+	/**
+	 * \brief Number of node evaluations performed so far
+	 *        by the incremental evaluation.
+	 */
+	long nb_incremental_evals() const;
+
+	/**
+	 * \brief Set the incremental mode.
+	 *
+	 * In incremental mode, eval(const IntervalVector&) is replaced
+	 * by eval_incremental(const IntervalVector&). This makes the
+	 * algorithms based on this evaluator (HC4Revise, Gradient) incremental
+	 * as well. Disabled by default.
+	 */
+	void set_incremental(bool incremental);
+
+	/**
+	 * \brief True iff the incremental mode is set.
+	 */
+	bool incremental() const;
+
 protected:
+	/**
+	 * Data of the incremental evaluation
+	 * (built on the first call to eval_incremental).
+	 */
+	class Incremental;
 	/**
 	 * Class used internally to interrupt the forward procedure
 	 * when an empty domain occurs (<=> the input box is outside
@@ -72,6 +128,27 @@ protected:
 	 */
 	class EmptyBoxException { };
 
+public: // because called from HC4Revise/InHC4Revise
+	/**
+	 * Notify that the domains of the nodes have been modified
+	 * by another algorithm (e.g., a backward phase).
+	 */
+	void domains_modified();
+
+	/**
+	 * Notify that only the domains of the nodes of the
+	 * ith component have been modified.
+	 */
+	void domains_modified(int i);
+
+public: // because called from Gradient
+	/**
+	 * Push in \a nodes the (non-symbol) nodes depending on the jth variable,
+	 * in the forward order. Built from the data of the incremental
+	 * evaluation (built if necessary).
+	 */
+	void dependent_nodes(int j, std::vector<int>& nodes);
+
 public: // because called from CompiledFunction
 
 	       void vector_fwd (int* x, int y);
@@ -127,12 +204,20 @@ public: // because called from CompiledFunction
 	ExprDomain d;
 	Agenda** fwd_agenda; // one agenda for each component
 	Agenda** bwd_agenda; // one agenda for each component
+
+protected:
+	bool inc_mode;       // incremental mode
+	Incremental* inc;    // NULL if not built yet
 };
 
 /* ============================================================================
  	 	 	 	 	 	 	 implementation
   ============================================================================*/
 
+inline void Eval::set_incremental(bool incremental) { inc_mode = incremental; }
+
+inline bool Eval::incremental() const { return inc_mode; }
+
 inline void Eval::idx_fwd(int, int) { /* nothing to do */ }
 
 inline void Eval::symbol_fwd(int) { /* nothing to do */ }
@@ -140,52 +225,52 @@ inline void Eval::symbol_fwd(int) { /* nothing to do */ }
 inline void Eval::cst_fwd(int y) {
 	const ExprConstant& c = (const ExprConstant&) f.node(y);
 	switch (c.type()) {
-	case Dim::SCALAR:       d[y].i() = c.get_value();         break;
+	case Dim::SCALAR:       d.i(y) = c.get_value();           break;
 	case Dim::ROW_VECTOR:
 	case Dim::COL_VECTOR:   d[y].v() = c.get_vector_value();  break;
 	case Dim::MATRIX:       d[y].m() = c.get_matrix_value();  break;
 	}
 }
 
-inline void Eval::chi_fwd(int x1, int x2, int x3, int y) { d[y].i() = chi(d[x1].i(),d[x2].i(),d[x3].i()); }
-inline void Eval::add_fwd(int x1, int x2, int y)   { d[y].i()=d[x1].i()+d[x2].i(); }
-inline void Eval::mul_fwd(int x1, int x2, int y)   { d[y].i()=d[x1].i()*d[x2].i(); }
-inline void Eval::sub_fwd(int x1, int x2, int y)   { d[y].i()=d[x1].i()-d[x2].i(); }
-inline void Eval::div_fwd(int x1, int x2, int y)   { d[y].i()=d[x1].i()/d[x2].i(); }
-inline void Eval::max_fwd(int x1, int x2, int y)   { d[y].i()=max(d[x1].i(),d[x2].i()); }
-inline void Eval::min_fwd(int x1, int x2, int y)   { d[y].i()=min(d[x1].i(),d[x2].i()); }
-inline void Eval::atan2_fwd(int x1, int x2, int y) { d[y].i()=atan2(d[x1].i(),d[x2].i()); }
+inline void Eval::chi_fwd(int x1, int x2, int x3, int y) { d.i(y) = chi(d.i(x1),d.i(x2),d.i(x3)); }
+inline void Eval::add_fwd(int x1, int x2, int y)   { d.i(y)=d.i(x1)+d.i(x2); }
+inline void Eval::mul_fwd(int x1, int x2, int y)   { d.i(y)=d.i(x1)*d.i(x2); }
+inline void Eval::sub_fwd(int x1, int x2, int y)   { d.i(y)=d.i(x1)-d.i(x2); }
+inline void Eval::div_fwd(int x1, int x2, int y)   { d.i(y)=d.i(x1)/d.i(x2); }
+inline void Eval::max_fwd(int x1, int x2, int y)   { d.i(y)=max(d.i(x1),d.i(x2)); }
+inline void Eval::min_fwd(int x1, int x2, int y)   { d.i(y)=min(d.i(x1),d.i(x2)); }
+inline void Eval::atan2_fwd(int x1, int x2, int y) { d.i(y)=atan2(d.i(x1),d.i(x2)); }
 
-inline void Eval::minus_fwd(int x, int y)          { d[y].i()=-d[x].i(); }
+inline void Eval::minus_fwd(int x, int y)          { d.i(y)=-d.i(x); }
 inline void Eval::minus_V_fwd(int x, int y)        { d[y].v()=-d[x].v(); }
 inline void Eval::minus_M_fwd(int x, int y)        { d[y].m()=-d[x].m(); }
-inline void Eval::sign_fwd(int x, int y)           { d[y].i()=sign(d[x].i()); }
-inline void Eval::abs_fwd(int x, int y)            { d[y].i()=abs(d[x].i()); }
-inline void Eval::power_fwd(int x, int y, int p)   { d[y].i()=pow(d[x].i(),p); }
-inline void Eval::sqr_fwd(int x, int y)            { d[y].i()=sqr(d[x].i()); }
-inline void Eval::sqrt_fwd(int x, int y)           { if ((d[y].i()=sqrt(d[x].i())).is_empty()) throw EmptyBoxException(); }
-inline void Eval::exp_fwd(int x, int y)            { d[y].i()=exp(d[x].i()); }
-inline void Eval::log_fwd(int x, int y)            { if ((d[y].i()=log(d[x].i())).is_empty()) throw EmptyBoxException(); }
-inline void Eval::cos_fwd(int x, int y)            { d[y].i()=cos(d[x].i()); }
-inline void Eval::sin_fwd(int x, int y)            { d[y].i()=sin(d[x].i()); }
-inline void Eval::tan_fwd(int x, int y)            { if ((d[y].i()=tan(d[x].i())).is_empty()) throw EmptyBoxException(); }
-inline void Eval::cosh_fwd(int x, int y)           { d[y].i()=cosh(d[x].i()); }
-inline void Eval::sinh_fwd(int x, int y)           { d[y].i()=sinh(d[x].i()); }
-inline void Eval::tanh_fwd(int x, int y)           { d[y].i()=tanh(d[x].i()); }
-inline void Eval::acos_fwd(int x, int y)           { if ((d[y].i()=acos(d[x].i())).is_empty()) throw EmptyBoxException(); }
-inline void Eval::asin_fwd(int x, int y)           { if ((d[y].i()=asin(d[x].i())).is_empty()) throw EmptyBoxException(); }
-inline void Eval::atan_fwd(int x, int y)           { d[y].i()=atan(d[x].i()); }
-inline void Eval::acosh_fwd(int x, int y)          { if ((d[y].i()=acosh(d[x].i())).is_empty()) throw EmptyBoxException(); }
-inline void Eval::asinh_fwd(int x, int y)          { d[y].i()=asinh(d[x].i()); }
-inline void Eval::atanh_fwd(int x, int y)          { if ((d[y].i()=atanh(d[x].i())).is_empty()) throw EmptyBoxException(); }
+inline void Eval::sign_fwd(int x, int y)           { d.i(y)=sign(d.i(x)); }
+inline void Eval::abs_fwd(int x, int y)            { d.i(y)=abs(d.i(x)); }
+inline void Eval::power_fwd(int x, int y, int p)   { d.i(y)=pow(d.i(x),p); }
+inline void Eval::sqr_fwd(int x, int y)            { d.i(y)=sqr(d.i(x)); }
+inline void Eval::sqrt_fwd(int x, int y)           { if ((d.i(y)=sqrt(d.i(x))).is_empty()) throw EmptyBoxException(); }
+inline void Eval::exp_fwd(int x, int y)            { d.i(y)=exp(d.i(x)); }
+inline void Eval::log_fwd(int x, int y)            { if ((d.i(y)=log(d.i(x))).is_empty()) throw EmptyBoxException(); }
+inline void Eval::cos_fwd(int x, int y)            { d.i(y)=cos(d.i(x)); }
+inline void Eval::sin_fwd(int x, int y)            { d.i(y)=sin(d.i(x)); }
+inline void Eval::tan_fwd(int x, int y)            { if ((d.i(y)=tan(d.i(x))).is_empty()) throw EmptyBoxException(); }
+inline void Eval::cosh_fwd(int x, int y)           { d.i(y)=cosh(d.i(x)); }
+inline void Eval::sinh_fwd(int x, int y)           { d.i(y)=sinh(d.i(x)); }
+inline void Eval::tanh_fwd(int x, int y)           { d.i(y)=tanh(d.i(x)); }
+inline void Eval::acos_fwd(int x, int y)           { if ((d.i(y)=acos(d.i(x))).is_empty()) throw EmptyBoxException(); }
+inline void Eval::asin_fwd(int x, int y)           { if ((d.i(y)=asin(d.i(x))).is_empty()) throw EmptyBoxException(); }
+inline void Eval::atan_fwd(int x, int y)           { d.i(y)=atan(d.i(x)); }
+inline void Eval::acosh_fwd(int x, int y)          { if ((d.i(y)=acosh(d.i(x))).is_empty()) throw EmptyBoxException(); }
+inline void Eval::asinh_fwd(int x, int y)          { d.i(y)=asinh(d.i(x)); }
+inline void Eval::atanh_fwd(int x, int y)          { if ((d.i(y)=atanh(d.i(x))).is_empty()) throw EmptyBoxException(); }
 
 inline void Eval::trans_V_fwd(int x, int y)        { d[y].v()=d[x].v(); }
 inline void Eval::trans_M_fwd(int x, int y)        { d[y].m()=d[x].m().transpose(); }
 inline void Eval::add_V_fwd(int x1, int x2, int y) { d[y].v()=d[x1].v()+d[x2].v(); }
 inline void Eval::add_M_fwd(int x1, int x2, int y) { d[y].m()=d[x1].m()+d[x2].m(); }
-inline void Eval::mul_SV_fwd(int x1, int x2, int y){ d[y].v()=d[x1].i()*d[x2].v(); }
-inline void Eval::mul_SM_fwd(int x1, int x2, int y){ d[y].m()=d[x1].i()*d[x2].m(); }
-inline void Eval::mul_VV_fwd(int x1, int x2, int y){ d[y].i()=d[x1].v()*d[x2].v(); }
+inline void Eval::mul_SV_fwd(int x1, int x2, int y){ d[y].v()=d.i(x1)*d[x2].v(); }
+inline void Eval::mul_SM_fwd(int x1, int x2, int y){ d[y].m()=d.i(x1)*d[x2].m(); }
+inline void Eval::mul_VV_fwd(int x1, int x2, int y){ d.i(y)=d[x1].v()*d[x2].v(); }
 inline void Eval::mul_MV_fwd(int x1, int x2, int y){ d[y].v()=d[x1].m()*d[x2].v(); }
 inline void Eval::mul_VM_fwd(int x1, int x2, int y){ d[y].v()=d[x1].v()*d[x2].m(); }
 inline void Eval::mul_MM_fwd(int x1, int x2, int y){ d[y].m()=d[x1].m()*d[x2].m(); }
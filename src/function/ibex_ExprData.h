@@ -30,6 +30,11 @@ public:
 	 */
 	void build(ExprData<T>& data) const;
 
+	/**
+	 * \brief Create the factory.
+	 */
+	ExprDataFactory() : data(NULL) { }
+
 	/**
 	 * (Does nothing)
 	 */
@@ -375,7 +380,12 @@ public:
 	 */
 	T* const top;
 
-
+protected:
+	/**
+	 * Initialize this data without building it. The subclass
+	 * has to call ExprDataFactory::build itself.
+	 */
+	explicit ExprData(const Function& f);
 };
 
 template<class T>
@@ -441,6 +451,11 @@ ExprData<T>::ExprData(const Function& f, const ExprDataFactory<T>& factory) : f(
 	factory.build(*this);
 }
 
+template<class T>
+ExprData<T>::ExprData(const Function& f) : f(f), data(f.nodes.size()), args(f.nb_arg()), top(NULL) {
+
+}
+
 template<class T>
 ExprData<T>::~ExprData() {
 }
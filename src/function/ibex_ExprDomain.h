@@ -10,6 +10,14 @@ namespace ibex {
 template<class D>
 class ExprDomainFactory : public ExprDataFactory<TemplateDomain<D> > {
 public:
+	/**
+	 * \brief Create the factory.
+	 *
+	 * \param flat - if not NULL, the domain of every scalar node that is
+	 *               not a reference to another domain is stored in flat[i]
+	 *               where i is the rank of the node (see ExprTemplateDomain).
+	 */
+	explicit ExprDomainFactory(typename D::SCALAR* flat=NULL);
 	/** Delete this. */
 	virtual ~ExprDomainFactory();
 	/** Visit an indexed expression. */
@@ -24,6 +32,12 @@ public:
 	virtual TemplateDomain<D>* init(const ExprUnaryOp& e, TemplateDomain<D>& expr_deco);
 	/** Visit a transpose. */
 	virtual TemplateDomain<D>* init(const ExprTrans& e, TemplateDomain<D>& expr_deco);
+
+protected:
+	/** New domain of a node (in the flat array if possible). */
+	TemplateDomain<D>* new_domain(const ExprNode& e);
+
+	typename D::SCALAR* const flat;
 };
 
 /**
@@ -32,6 +46,12 @@ public:
  * These data are used by all forward/backward algorithms
  * (Eval, Gradient, HC4Revise, etc.).
  *
+ * The domains of scalar nodes are stored in one contiguous array
+ * indexed by the rank of the nodes (except for nodes that are
+ * references to a component of another domain, like x[i]). The
+ * TemplateDomain objects of these nodes are references to this array.
+ * Scalar operators should access domains through #i(int), which
+ * avoids the indirection through the TemplateDomain object.
  */
 template<class D>
 class ExprTemplateDomain : public ExprData<TemplateDomain<D> > {
@@ -47,6 +67,27 @@ public:
 	TemplateDomain<D>& operator[](int i);
 	// ------------------------------------------------------
 
+	/**
+	 * \brief Domain of the ith node, if scalar.
+	 *
+	 * Same as (*this)[i].i().
+	 */
+	typename D::SCALAR& i(int i);
+
+	/**
+	 * \brief Domain of the ith node, if scalar.
+	 */
+	const typename D::SCALAR& i(int i) const;
+
+	/**
+	 * \brief True if the domain of the ith node is a reference to
+	 * (a component of) the domain of another node.
+	 *
+	 * Unlike TemplateDomain::is_reference, false for a domain stored
+	 * in the flat array.
+	 */
+	bool is_alias(int i) const;
+
 	/**
 	 * \brief Initialize symbols domains from d
 	 *
@@ -89,6 +130,12 @@ public:
 
 private:
 	ExprTemplateDomain(const ExprTemplateDomain&); // forbidden
+
+	/** Domains of scalar nodes, indexed by rank. */
+	typename D::SCALAR* const flat;
+
+	/** Pointers to the domains of scalar nodes (NULL for other nodes). */
+	typename D::SCALAR** const scalars;
 };
 
 typedef ExprTemplateDomain<Interval> ExprDomain;
@@ -96,11 +143,24 @@ typedef ExprTemplateDomain<Interval> ExprDomain;
 /* ============================================================================
  	 	 	 	 	 	 	 inline implementation
   ============================================================================*/
+template<class D>
+ExprDomainFactory<D>::ExprDomainFactory(typename D::SCALAR* flat) : flat(flat) {
+
+}
+
 template<class D>
 ExprDomainFactory<D>::~ExprDomainFactory() {
 
 }
 
+template<class D>
+TemplateDomain<D>* ExprDomainFactory<D>::new_domain(const ExprNode& e) {
+	if (flat && e.dim.is_scalar())
+		return new TemplateDomain<D>(flat[this->data->f.nodes.rank(e)]);
+	else
+		return new TemplateDomain<D>(e.dim);
+}
+
 template<class D>
 TemplateDomain<D>* ExprDomainFactory<D>::init(const ExprIndex& e, TemplateDomain<D>& d_expr) {
 	TemplateDomain<D> d(d_expr[e.index]); // Depending on the type of index, can be a reference or a copy.
@@ -109,22 +169,22 @@ TemplateDomain<D>* ExprDomainFactory<D>::init(const ExprIndex& e, TemplateDomain
 
 template<class D>
 TemplateDomain<D>* ExprDomainFactory<D>::init(const ExprLeaf& e) {
-	return new TemplateDomain<D>(e.dim);
+	return new_domain(e);
 }
 
 template<class D>
 TemplateDomain<D>* ExprDomainFactory<D>::init(const ExprNAryOp& e, Array<TemplateDomain<D> >&) {
-	return new TemplateDomain<D>(e.dim);
+	return new_domain(e);
 }
 
 template<class D>
 TemplateDomain<D>* ExprDomainFactory<D>::init(const ExprBinaryOp& e, TemplateDomain<D>&, TemplateDomain<D>&) {
-	return new TemplateDomain<D>(e.dim);
+	return new_domain(e);
 }
 
 template<class D>
 TemplateDomain<D>* ExprDomainFactory<D>::init(const ExprUnaryOp& e, TemplateDomain<D>&) {
-	return new TemplateDomain<D>(e.dim);
+	return new_domain(e);
 }
 
 template<class D>
@@ -136,13 +196,21 @@ TemplateDomain<D>* ExprDomainFactory<D>::init(const ExprTrans& e, TemplateDomain
 	} else {
 		// TODO: seems impossible to have references
 		// in case of matrices...
-		return new TemplateDomain<D>(e.dim);
+		return new_domain(e);
 	}
 }
 
 template<class D>
-inline ExprTemplateDomain<D>::ExprTemplateDomain(const Function& f) : ExprData<TemplateDomain<D> >(f, ExprDomainFactory<D>()) {
+inline ExprTemplateDomain<D>::ExprTemplateDomain(const Function& f) : ExprData<TemplateDomain<D> >(f),
+		flat(new typename D::SCALAR[ExprData<TemplateDomain<D> >::data.size()]),
+		scalars(new typename D::SCALAR*[ExprData<TemplateDomain<D> >::data.size()]) {
 
+	ExprDomainFactory<D>(flat).build(*this);
+
+	for (int i=0; i<ExprData<TemplateDomain<D> >::data.size(); i++) {
+		TemplateDomain<D>& d=ExprData<TemplateDomain<D> >::data[i];
+		scalars[i] = d.dim.is_scalar() ? &d.i() : NULL;
+	}
 }
 
 template<class D>
@@ -150,6 +218,8 @@ inline ExprTemplateDomain<D>::~ExprTemplateDomain() {
 	for (int i=0; i<ExprData<TemplateDomain<D> >::data.size(); i++) {
 		delete &ExprData<TemplateDomain<D> >::data[i];
 	}
+	delete[] scalars;
+	delete[] flat;
 }
 
 template<class D>
@@ -162,6 +232,23 @@ inline TemplateDomain<D>& ExprTemplateDomain<D>::operator[](int i) {
 	return ExprData<TemplateDomain<D> >::data[i];
 }
 
+template<class D>
+inline typename D::SCALAR& ExprTemplateDomain<D>::i(int i) {
+	assert(scalars[i]);
+	return *scalars[i];
+}
+
+template<class D>
+inline const typename D::SCALAR& ExprTemplateDomain<D>::i(int i) const {
+	assert(scalars[i]);
+	return *scalars[i];
+}
+
+template<class D>
+inline bool ExprTemplateDomain<D>::is_alias(int i) const {
+	return ExprData<TemplateDomain<D> >::data[i].is_reference && scalars[i]!=&flat[i];
+}
+
 template<class D>
 inline void ExprTemplateDomain<D>::write_arg_domains(const Array<TemplateDomain<D> >& d) {
 	load(ExprData<TemplateDomain<D> >::args, d, ExprData<TemplateDomain<D> >::f.nb_used_vars(), ExprData<TemplateDomain<D> >::f.used_vars());
@@ -40,6 +40,12 @@ void Fnc::jacobian(const IntervalVector& box, IntervalMatrix& J_var, IntervalMat
 	}
 }
 
+void Fnc::jacobian(const IntervalVector& x, SparseIntervalMatrix& J, const BitSet& components) const {
+	IntervalMatrix D(components.size(), nb_var());
+	jacobian(x,D,components);
+	J=SparseIntervalMatrix(D);
+}
+
 //void Fnc::jacobian(const IntervalVector& x, const BitSet& fi, const BitSet& xj, IntervalMatrix& J) const {
 //	IntervalMatrix Jfull(image_dim(),nb_var());
 //	assert(J.nb_rows()==((int) fi.size()));
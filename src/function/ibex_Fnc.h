@@ -13,6 +13,7 @@
 #define __IBEX_FNC_H__
 
 #include "ibex_IntervalMatrix.h"
+#include "ibex_SparseIntervalMatrix.h"
 #include "ibex_VarSet.h"
 
 namespace ibex {
@@ -176,6 +177,28 @@ public:
 	 */
 	virtual void jacobian(const IntervalVector& x, IntervalMatrix& J, const BitSet& components, int v=-1) const;
 
+	/**
+	 * \brief Calculate the Jacobian matrix of f in sparse form.
+	 *
+	 * \param x - the input box
+	 * \param J - where the Jacobian matrix has to be stored (output parameter).
+	 *            J is replaced by a matrix with the pattern of the Jacobian.
+	 */
+	void jacobian(const IntervalVector& x, SparseIntervalMatrix& J) const;
+
+	/**
+	 * \brief Calculate some rows of the Jacobian matrix of f in sparse form.
+	 *
+	 * Default implementation: the dense submatrix is calculated and its
+	 * [0,0] entries are removed.
+	 *
+	 * \param x - the input box
+	 * \param J - where the Jacobian matrix has to be stored (output parameter).
+	 *            J is replaced by a matrix with the pattern of the Jacobian.
+	 * \param components - selected components f_i
+	 */
+	virtual void jacobian(const IntervalVector& x, SparseIntervalMatrix& J, const BitSet& components) const;
+
 	/**
 	 * \brief Calculate the Hansen matrix of f.
 	 *
@@ -196,7 +219,7 @@ public:
 	 *
 	 * \see above
 	 */
-	void hansen_matrix(const IntervalVector& x, const IntervalVector& x0, IntervalMatrix& H, const BitSet& components) const;
+	virtual void hansen_matrix(const IntervalVector& x, const IntervalVector& x0, IntervalMatrix& H, const BitSet& components) const;
 
 	/**
 	 * \brief Calculate the Hansen matrix of a restriction of f
@@ -222,7 +245,7 @@ public:
 	 * \param J_param  - The m-columned Jacobian w.r.t. p (all the x are interval constants).
 	 *                   Note: no more "Hansen scheme" here.
 	 */
-	void hansen_matrix(const IntervalVector& full_box, const IntervalVector& x0, IntervalMatrix& H_var, IntervalMatrix& J_param, const VarSet& set) const;
+	virtual void hansen_matrix(const IntervalVector& full_box, const IntervalVector& x0, IntervalMatrix& H_var, IntervalMatrix& J_param, const VarSet& set) const;
 
 protected:
 	friend class Function;
@@ -302,6 +325,10 @@ inline void Fnc::jacobian(const IntervalVector& x, IntervalMatrix& J, const BitS
 	ibex_error("Fnc: 'jacobian' called with no implementation.");
 }
 
+inline void Fnc::jacobian(const IntervalVector& x, SparseIntervalMatrix& J) const {
+	jacobian(x, J, BitSet::all(image_dim()));
+}
+
 inline void Fnc::hansen_matrix(const IntervalVector& box, IntervalMatrix& H) const {
 	hansen_matrix(box, box.mid(), H);
 }
@@ -58,6 +58,7 @@ Function::~Function() {
 	if (_eval!=NULL) {
 		delete _eval;
 		delete _hc4revise;
+		delete _hess;
 		delete _grad;
 		delete _inhc4revise;
 	}
@@ -79,6 +80,26 @@ void Function::print(std::ostream& os) const {
 	os << ")->" << expr();
 }
 
+void Function::hansen_matrix(const IntervalVector& box, const IntervalVector& x0, IntervalMatrix& H, const BitSet& components) const {
+	if (!deriv_calculator().hansen_matrix(box, x0, H, components))
+		Fnc::hansen_matrix(box, x0, H, components);
+}
+
+void Function::hansen_matrix(const IntervalVector& full_box, const IntervalVector& x0, IntervalMatrix& H_var, IntervalMatrix& J_param, const VarSet& set) const {
+
+	if (!deriv_calculator().hansen_matrix(full_box, set.full_box(x0,set.param_box(full_box)), H_var, BitSet::all(image_dim()), &set)) {
+		Fnc::hansen_matrix(full_box, x0, H_var, J_param, set);
+		return;
+	}
+
+	if (H_var.is_empty()) return;
+
+	// J_param is the Jacobian on the full box
+	IntervalMatrix J_var(H_var.nb_rows(), H_var.nb_cols());
+	Fnc::jacobian(full_box, J_var, J_param, set);
+	if (J_var.is_empty()) H_var.set_empty();
+}
+
 const ExprNode& Function::operator()(const ExprNode& arg1) const {
 	//return ExprApply::new_(*this,Array<const ExprNode>(arg1),expr());
 	return ExprCopy().copy(args(),Array<const ExprNode>(arg1),expr());
@@ -27,9 +27,11 @@ namespace ibex {
 
 class System;
 class VarSet;
+class ModelFile;
 class Eval;
 class HC4Revise;
 class Gradient;
+class Hessian;
 class InHC4Revise;
 
 /**
@@ -533,6 +535,9 @@ public:
 
 	/**
 	 * \brief Differentiate this function.
+	 *
+	 * The symbolic derivative is built on first call and
+	 * then shared by all the callers.
 	 */
 	const Function& diff() const;
 
@@ -742,6 +747,38 @@ public:
 	 */
 	virtual void jacobian(const IntervalVector& x, IntervalMatrix& J, const BitSet& components, int v=-1) const;
 
+	/**
+	 *\see #ibex::Fnc
+	 */
+	void jacobian(const IntervalVector& x, SparseIntervalMatrix& J) const;
+
+	/**
+	 * \brief Calculate some rows of the Jacobian matrix of f in sparse form.
+	 *
+	 * The pattern of J is the structural pattern of the Jacobian (see
+	 * #ibex::Gradient::jacobian(const IntervalVector&, SparseIntervalMatrix&, const BitSet&)).
+	 */
+	virtual void jacobian(const IntervalVector& x, SparseIntervalMatrix& J, const BitSet& components) const;
+
+	/**
+	 * \brief Calculate the Hessian matrix of f (real-valued).
+	 *
+	 * \see #ibex::Hessian.
+	 */
+	IntervalMatrix hessian(const IntervalVector& x) const;
+
+	/**
+	 * \brief Calculate the Hessian matrix of f (real-valued).
+	 */
+	void hessian(const IntervalVector& x, IntervalMatrix& H) const;
+
+	/**
+	 * \brief Calculate the Hessian matrix of f (real-valued) in sparse form.
+	 *
+	 * The pattern of H is the structural pattern of the Hessian.
+	 */
+	void hessian(const IntervalVector& x, SparseIntervalMatrix& H) const;
+
 	/**
 	 *\see #ibex::Fnc
 	 */
@@ -755,7 +792,7 @@ public:
 	/**
 	 *\see #ibex::Fnc
 	 */
-	void hansen_matrix(const IntervalVector& x, const IntervalVector& x0, IntervalMatrix& H, const BitSet& components) const;
+	virtual void hansen_matrix(const IntervalVector& x, const IntervalVector& x0, IntervalMatrix& H, const BitSet& components) const;
 
 	/**
 	 *\see #ibex::Fnc
@@ -765,7 +802,7 @@ public:
 	/**
 	 *\see #ibex::Fnc
 	 */
-	void hansen_matrix(const IntervalVector& full_box, const IntervalVector& x0, IntervalMatrix& H_var, IntervalMatrix& J_param, const VarSet& set) const;
+	virtual void hansen_matrix(const IntervalVector& full_box, const IntervalVector& x0, IntervalMatrix& H_var, IntervalMatrix& J_param, const VarSet& set) const;
 
 	/**
 	 * \brief Contract x w.r.t. f(x)=y.
@@ -819,12 +856,23 @@ public:
 	Eval& basic_evaluator() const;
 
 	/*
-	 * \brief Get a reference to the evaluator.
+	 * \brief Get a reference to the gradient calculator.
 	 *
 	 * For internal purposes.
+	 * The calculator is built on first call (functions that are
+	 * never differentiated do not allocate gradient domains).
 	 */
 	Gradient& deriv_calculator() const;
 
+	/**
+	 * \brief Get a reference to the Hessian calculator.
+	 *
+	 * Gives access to Hessian-vector products, the convexity test
+	 * and the second-order Taylor form (see #ibex::Hessian).
+	 * Built on first call, like the gradient calculator.
+	 */
+	Hessian& hessian_calculator() const;
+
 	/*
 	 * \brief Get a reference to the HC4Revise algorithm.
 	 *
@@ -890,6 +938,7 @@ protected:
 
 private:
 	friend class VarSet;
+	friend class ModelFile;
 
 	void build_from_string(const Array<const char*>& x, const char* y, const char* name=NULL);
 
@@ -924,8 +973,10 @@ private:
 
 	Eval *_eval;
 	HC4Revise *_hc4revise;
-	// TODO: actually never used if f is vector/matrix valued
+	// only generated if required (see #deriv_calculator())
 	Gradient *_grad;
+	// only generated if required (see #hessian_calculator())
+	Hessian *_hess;
 	InHC4Revise *_inhc4revise;
 
 	// number of used vars (value "-1" means "not yet generated")
@@ -939,6 +990,7 @@ private:
 
 #include "ibex_Eval.h"
 #include "ibex_Gradient.h"
+#include "ibex_Hessian.h"
 #include "ibex_HC4Revise.h"
 #include "ibex_InHC4Revise.h"
 #include "ibex_VarSet.h"
@@ -1097,7 +1149,7 @@ inline void Function::print_expr(std::ostream& os) const {
 inline void Function::gradient(const IntervalVector& x, IntervalVector& g) const {
 	assert(g.size()==nb_var());
 	assert(x.size()==nb_var());
-	_grad->gradient(x,g);
+	deriv_calculator().gradient(x,g);
 //	if (!df) ((Function*) this)->df=new Function(*this,DIFF);
 //	g=df->eval_vector(x);
 }
@@ -1126,7 +1178,31 @@ inline void Function::jacobian(const IntervalVector& full_box, IntervalMatrix& J
 }
 
 inline void Function::jacobian(const IntervalVector& x, IntervalMatrix& J, const BitSet& components, int v) const {
-	_grad->jacobian(x, J, components, v);
+	deriv_calculator().jacobian(x, J, components, v);
+}
+
+inline void Function::jacobian(const IntervalVector& x, SparseIntervalMatrix& J) const {
+	Fnc::jacobian(x, J);
+}
+
+inline void Function::jacobian(const IntervalVector& x, SparseIntervalMatrix& J, const BitSet& components) const {
+	deriv_calculator().jacobian(x, J, components);
+}
+
+inline IntervalMatrix Function::hessian(const IntervalVector& x) const {
+	IntervalMatrix H(nb_var(),nb_var());
+	hessian(x,H);
+	return H;
+}
+
+inline void Function::hessian(const IntervalVector& x, IntervalMatrix& H) const {
+	assert(x.size()==nb_var());
+	hessian_calculator().hessian(x,H);
+}
+
+inline void Function::hessian(const IntervalVector& x, SparseIntervalMatrix& H) const {
+	assert(x.size()==nb_var());
+	hessian_calculator().hessian(x,H);
 }
 
 inline void Function::hansen_matrix(const IntervalVector& x, IntervalMatrix& H) const {
@@ -1137,24 +1213,20 @@ inline void Function::hansen_matrix(const IntervalVector& x, const IntervalVecto
 	Fnc::hansen_matrix(x, x0, H);
 }
 
-inline void Function::hansen_matrix(const IntervalVector& x, const IntervalVector& x0, IntervalMatrix& H, const BitSet& components) const {
-	Fnc::hansen_matrix(x, x0, H, components);
-}
-
 inline void Function::hansen_matrix(const IntervalVector& full_box, IntervalMatrix& H_var, IntervalMatrix& J_param, const VarSet& set) const {
 	Fnc::hansen_matrix(full_box, H_var, J_param, set);
 }
 
-inline void Function::hansen_matrix(const IntervalVector& full_box, const IntervalVector& x0, IntervalMatrix& H_var, IntervalMatrix& J_param, const VarSet& set) const {
-	Fnc::hansen_matrix(full_box, x0, H_var, J_param,set);
-}
-
 inline Eval& Function::basic_evaluator() const {
 	return *_eval;
 }
 
 inline Gradient& Function::deriv_calculator() const {
-	return *_grad;
+	return *(_grad ? _grad : (((Gradient*&) _grad) = new Gradient(*_eval)));
+}
+
+inline Hessian& Function::hessian_calculator() const {
+	return *(_hess ? _hess : (((Hessian*&) _hess) = new Hessian(deriv_calculator())));
 }
 
 inline HC4Revise& Function::hc4revise() const {
@@ -12,13 +12,99 @@
 #include "ibex_Function.h"
 #include "ibex_Gradient.h"
 #include "ibex_ExprLinearity.h"
+#include "ibex_VarSet.h"
+
+#include <algorithm>
+#include <functional>
 
 using namespace std;
 
 namespace ibex {
 
+/*
+ * The derivative of a component w.r.t. a variable x_j only depends on the
+ * nodes of the component that depend on x_j (the ancestors of x_j). The
+ * backward phase is therefore restricted to these nodes and so is the
+ * forward phase (clearing of the gradients).
+ */
+class Gradient::Hansen {
+public:
+	Hansen(Gradient& g);
+
+	/* Calculate the derivative of the component with root "root"
+	 * w.r.t. the jth variable (the nodes depending on the jth
+	 * variable must be marked in "in_dep"). */
+	Interval derivative(int root, int j);
+
+	Gradient& grad;
+	vector<vector<int> > children; // children of each node
+	vector<int> dep;               // nodes depending on the current variable
+	vector<char> in_dep;           // nodes in "dep"
+	vector<int> sub;               // nodes of "dep" in the current component
+	vector<char> in_sub;           // nodes in "sub"
+	vector<int> stack;             // for the depth-first traversal of the DAG
+	vector<int> comp;              // selected components
+	vector<int> row;               // first row in H of the root of each selected component (-1 otherwise)
+	vector<int> next_row;          // next row with the same root (-1 if none)
+	Agenda fwd;                    // nodes of "sub", in the forward order
+	Agenda bwd;                    // nodes of "sub", in the backward order
+};
+
+Gradient::Hansen::Hansen(Gradient& grad) : grad(grad), in_dep(grad.f.nodes.size(),0),
+		in_sub(grad.f.nodes.size(),0), row(grad.f.nodes.size(),-1), fwd(grad.f.nodes.size()), bwd(grad.f.nodes.size()) {
+
+	Function& f=grad.f;
+
+	vector<vector<int> > parents;
+	f.cf.parents(parents);
+	children.resize(parents.size());
+	for (size_t i=0; i<parents.size(); i++)
+		for (vector<int>::const_iterator it=parents[i].begin(); it!=parents[i].end(); it++)
+			children[*it].push_back((int) i);
+}
+
+Interval Gradient::Hansen::derivative(int root, int j) {
+
+	stack.push_back(root);
+
+	while (!stack.empty()) {
+		int i=stack.back();
+		stack.pop_back();
+		if (in_sub[i]) continue;
+		in_sub[i]=1;
+		sub.push_back(i);
+		for (vector<int>::const_iterator it=children[i].begin(); it!=children[i].end(); it++)
+			if (in_dep[*it] && !in_sub[*it]) stack.push_back(*it);
+	}
+
+	sort(sub.begin(), sub.end(), greater<int>());
+
+	fwd.flush();
+	bwd.flush();
+	for (vector<int>::const_iterator it=sub.begin(); it!=sub.end(); it++) {
+		fwd.push(*it);
+		in_sub[*it]=0;
+	}
+	for (vector<int>::const_reverse_iterator it=sub.rbegin(); it!=sub.rend(); it++)
+		bwd.push(*it);
+	sub.clear();
+
+	grad.f.cf.forward<Gradient>(grad,fwd);
+
+	*grad.var_g[j]=0;
+
+	grad.g[root].i()=1.0;
+
+	grad.f.cf.backward<Gradient>(grad,bwd);
+
+	return *grad.var_g[j];
+}
+
 Gradient::Gradient(Eval& e): f(e.f), _eval(e), d(e.d), g(f),
-		coeff_matrix(f.image_dim(),f.nb_var()+1), is_linear(new bool[f.image_dim()]) {
+		coeff_matrix(f.image_dim(),f.nb_var()+1), is_linear(new bool[f.image_dim()]),
+		var_g(f.nb_var()), hansen(NULL), sparsity(NULL) {
+
+	init_var_g();
 
 	if (f.expr().dim.is_matrix())
 		return; // class not called in this case
@@ -35,8 +121,41 @@ Gradient::Gradient(Eval& e): f(e.f), _eval(e), d(e.d), g(f),
 	}
 }
 
+Gradient::Gradient(Eval& e, const IntervalMatrix& coeff_matrix): f(e.f), _eval(e), d(e.d), g(f),
+		coeff_matrix(coeff_matrix), is_linear(new bool[f.image_dim()]),
+		var_g(f.nb_var()), hansen(NULL), sparsity(NULL) {
+
+	assert(coeff_matrix.nb_rows()==f.image_dim() && coeff_matrix.nb_cols()==f.nb_var()+1);
+
+	init_var_g();
+
+	for (int i=0; i<f.image_dim(); i++) {
+		is_linear[i]=!coeff_matrix[i].is_unbounded();
+	}
+}
+
+void Gradient::init_var_g() {
+	int j=0; // variable index
+
+	for (int s=0; s<f.nb_arg(); s++) {
+		Domain& gs=g.args[s];
+		const Dim& dim=f.arg(s).dim;
+
+		for (int c=0; c<dim.size(); c++, j++) {
+			switch (dim.type()) {
+			case Dim::SCALAR:     var_g[j]=&gs.i(); break;
+			case Dim::ROW_VECTOR:
+			case Dim::COL_VECTOR: var_g[j]=&gs.v()[c]; break;
+			default:              var_g[j]=&gs.m()[c/dim.nb_cols()][c%dim.nb_cols()];
+			}
+		}
+	}
+}
+
 Gradient::~Gradient() {
 	delete[] is_linear;
+	if (hansen) delete hansen;
+	if (sparsity) delete sparsity;
 }
 
 void Gradient::gradient(const Array<Domain>& d2, IntervalVector& gbox) {
@@ -262,6 +381,226 @@ void Gradient::jacobian(const Array<Domain>& d, IntervalMatrix& J) {
 	// TODO
 }
 
+void Gradient::build_sparsity() {
+
+	int m=f.image_dim();
+	int n=f.nb_var();
+
+	vector<vector<int> > rows(m);
+
+	// components by root node (several components may share the same root)
+	vector<int> first(f.nodes.size(),-1);
+	vector<int> next(m,-1);
+
+	for (int c=0; c<m; c++) {
+		if (is_linear[c]) {
+			// the pattern is given by the coefficients
+			// (note: a component can also be a symbol, on which no node depends)
+			for (int j=0; j<n; j++)
+				if (coeff_matrix[c][j]!=Interval::ZERO) rows[c].push_back(j);
+		} else {
+			int root=m==1? f.nodes.rank(f.expr()) : _eval.bwd_agenda[c]->first();
+			next[c]=first[root];
+			first[root]=c;
+		}
+	}
+
+	vector<int> dep;
+
+	for (int j=0; j<n; j++) {
+		_eval.dependent_nodes(j,dep);
+		for (vector<int>::const_iterator it=dep.begin(); it!=dep.end(); it++)
+			for (int c=first[*it]; c!=-1; c=next[c])
+				rows[c].push_back(j);
+		dep.clear();
+	}
+
+	sparsity=new SparseIntervalMatrix(n,rows);
+}
+
+void Gradient::jacobian(const IntervalVector& box, SparseIntervalMatrix& J, const BitSet& components) {
+
+	int n=f.nb_var();
+	int m=components.size();
+
+	if (f.expr().dim.is_matrix()) {
+		ibex_error("Cannot called \"jacobian\" on a matrix-valued function");
+	}
+
+	assert(m<=f.image_dim());
+	assert(box.size()==n);
+	assert(!components.empty());
+
+	if (f.image_dim()>1 && _eval.fwd_agenda==NULL) {
+		// the components are not separate expressions:
+		// the dependencies are unknown
+		IntervalMatrix D(m,n);
+		jacobian(box,D,components);
+		J=SparseIntervalMatrix(D);
+		return;
+	}
+
+	if (!sparsity) build_sparsity();
+
+	J=sparsity->rows(components);
+
+	int c; // constraint number
+
+	BitSet nonlinear_components=BitSet::empty(f.image_dim());
+
+	for (int i=0; i<m; i++) {
+
+		c=(i==0? components.min() : components.next(c));
+
+		if (is_linear[c])
+			for (int k=J.row_begin(i); k<J.row_end(i); k++)
+				J.val(k)=coeff_matrix[c][J.col(k)];
+		else
+			nonlinear_components.add(c);
+	}
+
+	if (nonlinear_components.empty()) return;
+
+	if (f.image_dim()==1? _eval.eval(box).is_empty() : _eval.eval(box,nonlinear_components).is_empty()) {
+		// outside definition domain -> empty jacobian
+		J.set_empty();
+		return;
+	}
+
+	for (int i=0; i<m; i++) {
+
+		c=(i==0? components.min() : components.next(c));
+
+		if (!nonlinear_components[c]) continue;
+
+		// only the entries of the pattern are set to zero
+		// and read (the other ones are not significant)
+		if (f.image_dim()==1)
+			f.forward<Gradient>(*this);
+		else
+			f.cf.forward<Gradient>(*this, *(_eval.fwd_agenda)[c]);
+
+		for (int k=J.row_begin(i); k<J.row_end(i); k++)
+			*var_g[J.col(k)]=0;
+
+		if (f.image_dim()==1) {
+			g.top->i()=1.0;
+			f.backward<Gradient>(*this);
+		} else {
+			g[_eval.bwd_agenda[c]->first()].i()=1.0;
+			f.cf.backward<Gradient>(*this, *(_eval.bwd_agenda)[c]);
+		}
+
+		for (int k=J.row_begin(i); k<J.row_end(i); k++) {
+			J.val(k)=*var_g[J.col(k)];
+			if (J.val(k).is_empty()) {
+				J.set_empty();
+				return;
+			}
+		}
+	}
+}
+
+bool Gradient::hansen_matrix(const IntervalVector& box, const IntervalVector& x0, IntervalMatrix& H, const BitSet& components, const VarSet* set) {
+
+	int m=components.size();
+	int n=set? set->nb_var : f.nb_var();
+
+	assert(box.size()==f.nb_var());
+	assert(x0.size()==f.nb_var());
+	assert(H.nb_rows()==m);
+	assert(H.nb_cols()==n);
+
+	if (f.expr().dim.is_matrix() || (f.image_dim()>1 && _eval.fwd_agenda==NULL))
+		return false;
+
+	if (!hansen) hansen=new Hansen(*this);
+
+	vector<int>& dep=hansen->dep;
+	vector<char>& in_dep=hansen->in_dep;
+	vector<int>& comp=hansen->comp;
+	vector<int>& row=hansen->row;
+	vector<int>& next_row=hansen->next_row;
+
+	IntervalVector x=x0;
+
+	if (_eval.eval_incremental(x).is_empty())
+		return false;
+
+	int c; // component number
+
+	// note: several components may share the same root
+	// (the same expression appearing twice in the vector)
+	for (int i=0; i<m; i++) {
+		c=(i==0? components.min() : components.next(c));
+		comp.push_back(c);
+		int root=f.image_dim()==1? f.nodes.rank(f.expr()) : _eval.bwd_agenda[c]->first();
+		next_row.push_back(row[root]);
+		row[root]=i;
+	}
+
+	bool ok=true;
+
+	for (int k=0; k<n; k++) {
+
+		int j=set? set->var(k) : k; // variable number
+
+		x[j]=box[j];
+
+		// only the nodes depending on x_j are evaluated
+		if (_eval.eval_incremental(x).is_empty()) {
+			ok=false;
+			break;
+		}
+
+		// entries that do not require derivation: linear terms
+		// and components that do not depend on x_j
+		for (int i=0; i<m; i++) {
+			const Interval& a=coeff_matrix[comp[i]][j];
+			H[i][k]=a.is_unbounded()? Interval::ZERO : a;
+		}
+
+		_eval.dependent_nodes(j,dep);
+		for (vector<int>::const_iterator it=dep.begin(); it!=dep.end(); it++)
+			in_dep[*it]=1;
+
+		for (vector<int>::const_iterator it=dep.begin(); it!=dep.end() && !H.is_empty(); it++) {
+			bool calculated=false;
+			Interval gj;
+
+			for (int i=row[*it]; i!=-1; i=next_row[i]) {
+
+				if (!coeff_matrix[comp[i]][j].is_unbounded()) continue;
+
+				if (!calculated) {
+					gj=hansen->derivative(*it,j);
+					calculated=true;
+				}
+
+				if (gj.is_empty()) {
+					H.set_empty();
+					break;
+				}
+
+				H[i][k]=gj;
+			}
+		}
+
+		for (vector<int>::const_iterator it=dep.begin(); it!=dep.end(); it++)
+			in_dep[*it]=0;
+		dep.clear();
+
+		if (H.is_empty()) break;
+	}
+
+	for (vector<int>::const_iterator it=comp.begin(); it!=comp.end(); it++)
+		row[f.image_dim()==1? f.nodes.rank(f.expr()) : _eval.bwd_agenda[*it]->first()]=-1;
+	comp.clear();
+	next_row.clear();
+
+	return ok;
+}
+
 void Gradient::vector_fwd(int* x, int y) {
 	const ExprVector& v = (const ExprVector&) f.node(y);
 
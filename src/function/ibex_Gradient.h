@@ -15,9 +15,14 @@
 #include "ibex_Eval.h"
 #include "ibex_BwdAlgorithm.h"
 #include "ibex_Agenda.h"
+#include "ibex_SparseIntervalMatrix.h"
+
+#include <vector>
 
 namespace ibex {
 
+class VarSet;
+
 /**
  * \ingroup symbolic
  * \brief Calculates the gradient of a function.
@@ -35,6 +40,15 @@ public:
 	 */
 	Gradient(Eval& eval);
 
+	/**
+	 * \brief Build the gradient algorithm with a precomputed linear part.
+	 *
+	 * Same as #Gradient(Eval&) except that the coefficients of the
+	 * linear part of f (see #coeff_matrix) are given, e.g., by a model
+	 * file (see ModelFile). The symbolic analysis of f is skipped.
+	 */
+	Gradient(Eval& eval, const IntervalMatrix& coeff_matrix);
+
 	/**
 	 * \brief Delete this.
 	 */
@@ -71,6 +85,47 @@ public:
 	 */
 	void jacobian(const Array<Domain>& d, IntervalMatrix& J);
 
+	/**
+	 * \brief Calculate some components of the Jacobian of f on the box \a box, in sparse form.
+	 *
+	 * J is replaced by a matrix whose pattern is the structural pattern of the
+	 * Jacobian: the entry (i,j) is stored iff the ith selected component depends on
+	 * the jth variable in the DAG of f (or, for a linear component, iff its coefficient
+	 * is not zero). The pattern is calculated on the first call.
+	 *
+	 * Only the stored entries are calculated (in particular, the gradients of
+	 * the variables that do not appear in a component are not read).
+	 */
+	void jacobian(const IntervalVector& box, SparseIntervalMatrix& J, const BitSet& components);
+
+	/**
+	 * \brief Calculate the Hansen matrix of some components of f.
+	 *
+	 * The jth column of \a H is the jth column of the Jacobian matrix
+	 * of the selected components on the box whose first j components
+	 * are those of \a box and the other ones those of \a x0.
+	 *
+	 * Instead of a complete Jacobian calculation per column, the evaluation
+	 * is incremental (only the nodes depending on the jth variable are
+	 * re-evaluated) and the backward phase of each component is restricted
+	 * to the same nodes. Entries that are constant (linear terms) are not
+	 * calculated at all.
+	 *
+	 * This is not a single sweep: the columns are calculated on different
+	 * boxes, so each nonzero entry still has its own (restricted) sweep.
+	 * On a sparse square system, the cost is still about 3 to 4 Jacobian
+	 * evaluations.
+	 *
+	 * \param set - If not NULL, H is the Hansen matrix w.r.t. the variables
+	 *              of \a set only (the parameters are fixed to their domain
+	 *              in \a x0).
+	 *
+	 * \return false if this scheme does not apply (matrix-valued function,
+	 *         heterogeneous vector of expressions or evaluation outside the
+	 *         definition domain). H is unspecified in this case.
+	 */
+	bool hansen_matrix(const IntervalVector& box, const IntervalVector& x0, IntervalMatrix& H, const BitSet& components, const VarSet* set=NULL);
+
 	/* ====================================== Forward =================================== */
 
 	inline void idx_fwd(int , int ) { /* nothing to do */ }
@@ -183,6 +238,31 @@ public:
 	IntervalMatrix coeff_matrix;
 	// True if the ith component is linear (wrt all variables)
 	bool *is_linear;
+	// Gradient of each variable (in g)
+	std::vector<Interval*> var_g;
+
+protected:
+	/**
+	 * Set the pointers #var_g.
+	 */
+	void init_var_g();
+
+	/**
+	 * Data of the Hansen matrix calculation
+	 * (built on the first call to hansen_matrix).
+	 */
+	class Hansen;
+	Hansen* hansen; // NULL if not built yet
+
+	/**
+	 * Build the pattern of the Jacobian.
+	 */
+	void build_sparsity();
+
+	/**
+	 * Pattern of the Jacobian (all components).
+	 */
+	SparseIntervalMatrix* sparsity; // NULL if not built yet
 };
 
 } // namespace ibex
@@ -52,6 +52,40 @@ bool HC4Revise::proj(const Domain& y, IntervalVector& x) {
 	}
 }
 
+bool HC4Revise::proj(const Interval& y, IntervalVector& x, int i) {
+
+	Interval& root=eval.eval_incremental(x,i).i();
+
+	if (root.is_empty()) {
+		x.set_empty();
+		return false;
+	}
+
+	if (root.is_subset(y)) return true;
+
+	// the forward domains of the ith component are about to be modified
+	eval.domains_modified(i);
+
+	root &= y;
+
+	if (root.is_empty()) {
+		x.set_empty();
+		return false;
+	}
+
+	try {
+		f.cf.backward<HC4Revise>(*this,*eval.bwd_agenda[i]);
+
+		d.read_arg_domains(x);
+
+		return false;
+
+	} catch(EmptyBoxException&) {
+		x.set_empty();
+		return false;
+	}
+}
+
 bool HC4Revise::backward(const Domain& y) {
 
 	Domain& root=*d.top;
@@ -66,6 +100,9 @@ bool HC4Revise::backward(const Domain& y) {
 	case Dim::MATRIX:       if (root.m().is_subset(y.m())) return true; break;
 	}
 
+	// the forward domains are about to be modified
+	eval.domains_modified();
+
 	root &= y;
 
 	if (root.is_empty())
@@ -42,6 +42,18 @@ public:
 	 */
 	bool proj(const Domain& y, IntervalVector& x);
 
+	/**
+	 * \brief Project f_i(x)=y onto x (forward/backward algorithm)
+	 *
+	 * Same as proj(const Domain&, IntervalVector&) but applied
+	 * to the ith component of f only. The forward phase is
+	 * incremental (see Eval::eval_incremental(const IntervalVector&,int)) so that
+	 * nodes shared by several components are not evaluated for each of them.
+	 *
+	 * (Specific for vector-valued functions).
+	 */
+	bool proj(const Interval& y, IntervalVector& x, int i);
+
 	/**
 	 * \brief Ratio for the contraction of a
 	 * matrix-vector / matrix-matrix multiplication.
@@ -89,48 +101,48 @@ public: // because called from CompiledFunction
 	inline void symbol_bwd (int)                 { /* nothing to do */ }
 	inline void cst_bwd    (int)                 { /* nothing to do */ }
 	       void apply_bwd  (int* x, int y);
-	inline void chi_bwd(int a, int b, int c, int y){ if (!(bwd_chi(d[y].i(),d[a].i(),d[b].i(),d[c].i()))) throw EmptyBoxException();  }
-	inline void add_bwd    (int x1, int x2, int y) { if (!(bwd_add(d[y].i(),d[x1].i(),d[x2].i()))) throw EmptyBoxException();  }
+	inline void chi_bwd(int a, int b, int c, int y){ if (!(bwd_chi(d.i(y),d.i(a),d.i(b),d.i(c)))) throw EmptyBoxException();  }
+	inline void add_bwd    (int x1, int x2, int y) { if (!(bwd_add(d.i(y),d.i(x1),d.i(x2)))) throw EmptyBoxException();  }
 	inline void add_V_bwd  (int x1, int x2, int y) { if (!(bwd_add(d[y].v(),d[x1].v(),d[x2].v()))) throw EmptyBoxException();  }
 	inline void add_M_bwd  (int x1, int x2, int y) { if (!(bwd_add(d[y].m(),d[x1].m(),d[x2].m()))) throw EmptyBoxException();  }
-	inline void mul_bwd    (int x1, int x2, int y) { if (!(bwd_mul(d[y].i(),d[x1].i(),d[x2].i()))) throw EmptyBoxException();  }
-	inline void mul_SV_bwd (int x1, int x2, int y) { if (!(bwd_mul(d[y].v(),d[x1].i(),d[x2].v()))) throw EmptyBoxException();  }
-	inline void mul_SM_bwd (int x1, int x2, int y) { if (!(bwd_mul(d[y].m(),d[x1].i(),d[x2].m()))) throw EmptyBoxException();  }
-	inline void mul_VV_bwd (int x1, int x2, int y) { if (!(bwd_mul(d[y].i(),d[x1].v(),d[x2].v()))) throw EmptyBoxException();  }
+	inline void mul_bwd    (int x1, int x2, int y) { if (!(bwd_mul(d.i(y),d.i(x1),d.i(x2)))) throw EmptyBoxException();  }
+	inline void mul_SV_bwd (int x1, int x2, int y) { if (!(bwd_mul(d[y].v(),d.i(x1),d[x2].v()))) throw EmptyBoxException();  }
+	inline void mul_SM_bwd (int x1, int x2, int y) { if (!(bwd_mul(d[y].m(),d.i(x1),d[x2].m()))) throw EmptyBoxException();  }
+	inline void mul_VV_bwd (int x1, int x2, int y) { if (!(bwd_mul(d.i(y),d[x1].v(),d[x2].v()))) throw EmptyBoxException();  }
 	inline void mul_MV_bwd (int x1, int x2, int y) { if (!(bwd_mul(d[y].v(),d[x1].m(),d[x2].v(), RATIO))) throw EmptyBoxException();  }
 	inline void mul_VM_bwd (int x1, int x2, int y) { if (!(bwd_mul(d[y].v(),d[x1].v(),d[x2].m(), RATIO))) throw EmptyBoxException();  }
 	inline void mul_MM_bwd (int x1, int x2, int y) { if (!(bwd_mul(d[y].m(),d[x1].m(),d[x2].m(), RATIO))) throw EmptyBoxException();  }
-	inline void sub_bwd    (int x1, int x2, int y) { if (!(bwd_sub(d[y].i(),d[x1].i(),d[x2].i()))) throw EmptyBoxException();  }
+	inline void sub_bwd    (int x1, int x2, int y) { if (!(bwd_sub(d.i(y),d.i(x1),d.i(x2)))) throw EmptyBoxException();  }
 	inline void sub_V_bwd  (int x1, int x2, int y) { if (!(bwd_sub(d[y].v(),d[x1].v(),d[x2].v()))) throw EmptyBoxException();  }
 	inline void sub_M_bwd  (int x1, int x2, int y) { if (!(bwd_sub(d[y].m(),d[x1].m(),d[x2].m()))) throw EmptyBoxException();  }
-	inline void div_bwd    (int x1, int x2, int y) { if (!(bwd_div(d[y].i(),d[x1].i(),d[x2].i()))) throw EmptyBoxException();  }
-	inline void max_bwd    (int x1, int x2, int y) { if (!(bwd_max(d[y].i(),d[x1].i(),d[x2].i()))) throw EmptyBoxException();  }
-	inline void min_bwd    (int x1, int x2, int y) { if (!(bwd_min(d[y].i(),d[x1].i(),d[x2].i()))) throw EmptyBoxException();  }
-	inline void atan2_bwd  (int x1, int x2, int y) { if (!(bwd_atan2(d[y].i(),d[x1].i(),d[x2].i()))) throw EmptyBoxException();  }
-	inline void minus_bwd  (int x, int y)          { if ((d[x].i() &=-d[y].i()).is_empty()) throw EmptyBoxException();  }
+	inline void div_bwd    (int x1, int x2, int y) { if (!(bwd_div(d.i(y),d.i(x1),d.i(x2)))) throw EmptyBoxException();  }
+	inline void max_bwd    (int x1, int x2, int y) { if (!(bwd_max(d.i(y),d.i(x1),d.i(x2)))) throw EmptyBoxException();  }
+	inline void min_bwd    (int x1, int x2, int y) { if (!(bwd_min(d.i(y),d.i(x1),d.i(x2)))) throw EmptyBoxException();  }
+	inline void atan2_bwd  (int x1, int x2, int y) { if (!(bwd_atan2(d.i(y),d.i(x1),d.i(x2)))) throw EmptyBoxException();  }
+	inline void minus_bwd  (int x, int y)          { if ((d.i(x) &=-d.i(y)).is_empty()) throw EmptyBoxException();  }
 	inline void minus_V_bwd(int x, int y)          { if ((d[x].v() &=-d[y].v()).is_empty()) throw EmptyBoxException();  }
 	inline void minus_M_bwd(int x, int y)          { if ((d[x].m() &=-d[y].m()).is_empty()) throw EmptyBoxException();  }
     inline void trans_V_bwd(int x, int y)          { if ((d[x].v() &= d[y].v()).is_empty()) throw EmptyBoxException();  }
     inline void trans_M_bwd(int x, int y)          { if ((d[x].m() &= d[y].m().transpose()).is_empty()) throw EmptyBoxException();  }
-	inline void sign_bwd   (int x, int y)          { if (!(bwd_sign(d[y].i(),d[x].i()))) throw EmptyBoxException();  }
-	inline void abs_bwd    (int x, int y)          { if (!(bwd_abs(d[y].i(),d[x].i()))) throw EmptyBoxException();  }
-	inline void power_bwd  (int x, int y, int p)   { if (!(bwd_pow(d[y].i(),p, d[x].i()))) throw EmptyBoxException();  }
-	inline void sqr_bwd    (int x, int y)          { if (!(bwd_sqr(d[y].i(),d[x].i()))) throw EmptyBoxException();  }
-	inline void sqrt_bwd   (int x, int y)          { if (!(bwd_sqrt(d[y].i(),d[x].i()))) throw EmptyBoxException();  }
-	inline void exp_bwd    (int x, int y)          { if (!(bwd_exp(d[y].i(),d[x].i()))) throw EmptyBoxException();  }
-	inline void log_bwd    (int x, int y)          { if (!(bwd_log(d[y].i(),d[x].i()))) throw EmptyBoxException();  }
-	inline void cos_bwd    (int x, int y)          { if (!(bwd_cos(d[y].i(),d[x].i()))) throw EmptyBoxException();  }
-	inline void sin_bwd    (int x, int y)          { if (!(bwd_sin(d[y].i(),d[x].i()))) throw EmptyBoxException();  }
-	inline void tan_bwd    (int x, int y)          { if (!(bwd_tan(d[y].i(),d[x].i()))) throw EmptyBoxException();  }
-	inline void cosh_bwd   (int x, int y)          { if (!(bwd_cosh(d[y].i(),d[x].i()))) throw EmptyBoxException();  }
-	inline void sinh_bwd   (int x, int y)          { if (!(bwd_sinh(d[y].i(),d[x].i()))) throw EmptyBoxException();  }
-	inline void tanh_bwd   (int x, int y)          { if (!(bwd_tanh(d[y].i(),d[x].i()))) throw EmptyBoxException();  }
-	inline void acos_bwd   (int x, int y)          { if (!(bwd_acos(d[y].i(),d[x].i()))) throw EmptyBoxException();  }
-	inline void asin_bwd   (int x, int y)          { if (!(bwd_asin(d[y].i(),d[x].i()))) throw EmptyBoxException();  }
-	inline void atan_bwd   (int x, int y)          { if (!(bwd_atan(d[y].i(),d[x].i()))) throw EmptyBoxException();  }
-	inline void acosh_bwd  (int x, int y)          { if (!(bwd_acosh(d[y].i(),d[x].i()))) throw EmptyBoxException();  }
-	inline void asinh_bwd  (int x, int y)          { if (!(bwd_asinh(d[y].i(),d[x].i()))) throw EmptyBoxException();  }
-	inline void atanh_bwd  (int x, int y)          { if (!(bwd_atanh(d[y].i(),d[x].i()))) throw EmptyBoxException();  }
+	inline void sign_bwd   (int x, int y)          { if (!(bwd_sign(d.i(y),d.i(x)))) throw EmptyBoxException();  }
+	inline void abs_bwd    (int x, int y)          { if (!(bwd_abs(d.i(y),d.i(x)))) throw EmptyBoxException();  }
+	inline void power_bwd  (int x, int y, int p)   { if (!(bwd_pow(d.i(y),p, d.i(x)))) throw EmptyBoxException();  }
+	inline void sqr_bwd    (int x, int y)          { if (!(bwd_sqr(d.i(y),d.i(x)))) throw EmptyBoxException();  }
+	inline void sqrt_bwd   (int x, int y)          { if (!(bwd_sqrt(d.i(y),d.i(x)))) throw EmptyBoxException();  }
+	inline void exp_bwd    (int x, int y)          { if (!(bwd_exp(d.i(y),d.i(x)))) throw EmptyBoxException();  }
+	inline void log_bwd    (int x, int y)          { if (!(bwd_log(d.i(y),d.i(x)))) throw EmptyBoxException();  }
+	inline void cos_bwd    (int x, int y)          { if (!(bwd_cos(d.i(y),d.i(x)))) throw EmptyBoxException();  }
+	inline void sin_bwd    (int x, int y)          { if (!(bwd_sin(d.i(y),d.i(x)))) throw EmptyBoxException();  }
+	inline void tan_bwd    (int x, int y)          { if (!(bwd_tan(d.i(y),d.i(x)))) throw EmptyBoxException();  }
+	inline void cosh_bwd   (int x, int y)          { if (!(bwd_cosh(d.i(y),d.i(x)))) throw EmptyBoxException();  }
+	inline void sinh_bwd   (int x, int y)          { if (!(bwd_sinh(d.i(y),d.i(x)))) throw EmptyBoxException();  }
+	inline void tanh_bwd   (int x, int y)          { if (!(bwd_tanh(d.i(y),d.i(x)))) throw EmptyBoxException();  }
+	inline void acos_bwd   (int x, int y)          { if (!(bwd_acos(d.i(y),d.i(x)))) throw EmptyBoxException();  }
+	inline void asin_bwd   (int x, int y)          { if (!(bwd_asin(d.i(y),d.i(x)))) throw EmptyBoxException();  }
+	inline void atan_bwd   (int x, int y)          { if (!(bwd_atan(d.i(y),d.i(x)))) throw EmptyBoxException();  }
+	inline void acosh_bwd  (int x, int y)          { if (!(bwd_acosh(d.i(y),d.i(x)))) throw EmptyBoxException();  }
+	inline void asinh_bwd  (int x, int y)          { if (!(bwd_asinh(d.i(y),d.i(x)))) throw EmptyBoxException();  }
+	inline void atanh_bwd  (int x, int y)          { if (!(bwd_atanh(d.i(y),d.i(x)))) throw EmptyBoxException();  }
 };
 
 } // namespace ibex
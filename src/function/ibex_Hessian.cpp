@@ -0,0 +1,818 @@
+/* ============================================================================
+ * I B E X - ibex_Hessian.cpp
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_Function.h"
+#include "ibex_Hessian.h"
+
+#include <algorithm>
+
+using namespace std;
+
+namespace ibex {
+
+/*
+ * Let H_j be the jth column of the Hessian. The tangent of a node along
+ * e_j is not zero only if the node depends on x_j ("dep"). The adjoint
+ * tangent of a node is not zero only if
+ * - the node is an argument of a nonlinear operator depending on x_j
+ *   (second-order term), or
+ * - the node is an argument of a node whose adjoint tangent is not zero
+ *   (first-order term).
+ * These nodes ("bwd") are the descendants of the arguments of the
+ * nonlinear operators depending on x_j (for a product, the arguments
+ * whose cofactor depends on x_j). The nonzero entries of H_j are the
+ * variables in "bwd".
+ * The tangents read by the backward phase are those of the arguments
+ * of the nodes in "bwd". The forward phase ("fwd") is restricted to
+ * these nodes and their descendants depending on x_j (the nodes above,
+ * typically a long sum, are skipped).
+ */
+class Hessian::Pattern {
+public:
+	Pattern(Hessian& h);
+
+	/* Add the argument c of the node p (and the corresponding
+	 * variables, if c is a symbol) */
+	void add_child(int p, int c, int j);
+
+	/* Add all the arguments of the node p */
+	void add_children(int p, int j);
+
+	Hessian& h;
+	vector<vector<int> > children; // children of each node
+	vector<int> first_var;         // first variable of each symbol (-1 for other nodes)
+	vector<int> symbol;            // symbol of each variable
+	vector<vector<int> > fwd;      // nodes of the forward phase of each column
+	vector<vector<int> > bwd;      // nodes of the backward phase of each column
+	vector<vector<int> > rows;     // nonzero rows of each column
+	vector<vector<int> > pos;      // position in H of the nonzero rows of each column
+	vector<char> in_dep;           // nodes depending on the current variable
+	vector<char> in_bwd;           // nodes in the current "bwd"
+	vector<char> in_stack;         // nodes whose arguments are (or will be) all added
+	vector<char> in_fwd;           // nodes in the current "fwd"
+	vector<char> in_rows;          // variables in the current "rows"
+	vector<int> stack;             // for the depth-first traversal of the DAG
+	SparseIntervalMatrix* H;       // the pattern of the Hessian
+	Agenda fwd_agenda;
+	Agenda bwd_agenda;
+};
+
+namespace {
+
+// true if the second derivatives of the node are zero
+bool is_linear(const ExprNode& e) {
+	if (dynamic_cast<const ExprAdd*>(&e) || dynamic_cast<const ExprSub*>(&e) ||
+		dynamic_cast<const ExprMinus*>(&e) || dynamic_cast<const ExprTrans*>(&e) ||
+		dynamic_cast<const ExprIndex*>(&e) || dynamic_cast<const ExprVector*>(&e))
+		return true;
+	const ExprMul* mul=dynamic_cast<const ExprMul*>(&e);
+	return mul && (dynamic_cast<const ExprConstant*>(&mul->left) || dynamic_cast<const ExprConstant*>(&mul->right));
+}
+
+}
+
+Hessian::Pattern::Pattern(Hessian& h) : h(h), first_var(h.f.nodes.size(),-1), symbol(h.f.nb_var()), fwd(h.f.nb_var()), bwd(h.f.nb_var()),
+		rows(h.f.nb_var()), pos(h.f.nb_var()), in_dep(h.f.nodes.size(),0), in_bwd(h.f.nodes.size(),0), in_stack(h.f.nodes.size(),0), in_fwd(h.f.nodes.size(),0), in_rows(h.f.nb_var(),0), H(NULL),
+		fwd_agenda(h.f.nodes.size()), bwd_agenda(h.f.nodes.size()) {
+
+	Function& f=h.f;
+	int n=f.nb_var();
+
+	vector<vector<int> > parents;
+	f.cf.parents(parents);
+	children.resize(f.nodes.size());
+	for (size_t i=0; i<parents.size(); i++)
+		for (vector<int>::const_iterator it=parents[i].begin(); it!=parents[i].end(); it++)
+			children[*it].push_back((int) i);
+
+	int j=0;
+	for (int s=0; s<f.nb_arg(); s++) {
+		int r=f.nodes.rank(f.arg(s));
+		first_var[r]=j;
+		for (int k=0; k<f.arg(s).dim.size(); k++, j++)
+			symbol[j]=r;
+	}
+
+	vector<int> dep;
+	vector<vector<int> > H_rows(n);
+
+	for (j=0; j<n; j++) {
+		h._eval.dependent_nodes(j,dep);
+
+		in_dep[symbol[j]]=1;
+		for (vector<int>::const_iterator it=dep.begin(); it!=dep.end(); it++)
+			in_dep[*it]=1;
+
+		for (vector<int>::const_iterator it=dep.begin(); it!=dep.end(); it++) {
+			const ExprNode& e=f.node(*it);
+			if (is_linear(e)) continue;
+			if (!in_bwd[*it]) {
+				in_bwd[*it]=1;
+				bwd[j].push_back(*it);
+			}
+			const ExprMul* mul=dynamic_cast<const ExprMul*>(&e);
+			if (mul) {
+				// bilinear: the second-order term of an argument
+				// is zero if the other one does not depend on x_j
+				int left=f.nodes.rank(mul->left);
+				int right=f.nodes.rank(mul->right);
+				if (in_dep[right]) add_child(*it,left,j);
+				if (in_dep[left]) add_child(*it,right,j);
+			} else
+				add_children(*it,j);
+		}
+
+		while (!stack.empty()) {
+			int i=stack.back();
+			stack.pop_back();
+			add_children(i,j);
+		}
+
+		if (!rows[j].empty()) {
+			for (vector<int>::const_iterator it=bwd[j].begin(); it!=bwd[j].end(); it++) {
+				if (in_dep[*it]) stack.push_back(*it);
+				for (vector<int>::const_iterator c=children[*it].begin(); c!=children[*it].end(); c++)
+					if (in_dep[*c]) stack.push_back(*c);
+			}
+			while (!stack.empty()) {
+				int i=stack.back();
+				stack.pop_back();
+				if (in_fwd[i]) continue;
+				in_fwd[i]=1;
+				for (vector<int>::const_iterator c=children[i].begin(); c!=children[i].end(); c++)
+					if (in_dep[*c] && !in_fwd[*c]) stack.push_back(*c);
+			}
+			for (vector<int>::const_iterator it=dep.begin(); it!=dep.end(); it++)
+				if (in_fwd[*it]) {
+					fwd[j].push_back(*it); // already in the forward order
+					in_fwd[*it]=0;
+				}
+			in_fwd[symbol[j]]=0;
+			sort(bwd[j].begin(), bwd[j].end());
+			sort(rows[j].begin(), rows[j].end());
+			for (vector<int>::const_iterator it=rows[j].begin(); it!=rows[j].end(); it++) {
+				H_rows[*it].push_back(j);
+				in_rows[*it]=0;
+			}
+		}
+
+		for (vector<int>::const_iterator it=bwd[j].begin(); it!=bwd[j].end(); it++)
+			in_bwd[*it]=in_stack[*it]=0;
+
+		in_dep[symbol[j]]=0;
+		for (vector<int>::const_iterator it=dep.begin(); it!=dep.end(); it++)
+			in_dep[*it]=0;
+
+		if (rows[j].empty()) bwd[j].clear();
+
+		dep.clear();
+	}
+
+	H=new SparseIntervalMatrix(n,H_rows);
+
+	for (j=0; j<n; j++)
+		for (vector<int>::const_iterator it=rows[j].begin(); it!=rows[j].end(); it++)
+			pos[j].push_back(H->find(*it,j));
+}
+
+void Hessian::Pattern::add_child(int p, int c, int j) {
+
+	if (first_var[c]!=-1) {
+		// p is applied to a symbol: the adjoint tangents
+		// of the selected components are not zero
+		const ExprSymbol& x=(const ExprSymbol&) h.f.node(c);
+		const ExprIndex* idx=dynamic_cast<const ExprIndex*>(&h.f.node(p));
+		int nb_cols=x.dim.nb_cols();
+		for (int k=0; k<x.dim.size(); k++) {
+			int row=k/nb_cols;
+			int col=k%nb_cols;
+			if (idx && (row<idx->index.first_row() || row>idx->index.last_row() ||
+						col<idx->index.first_col() || col>idx->index.last_col()))
+				continue;
+			int v=first_var[c]+k;
+			if (!in_rows[v]) {
+				in_rows[v]=1;
+				rows[j].push_back(v);
+			}
+		}
+	}
+
+	if (!in_bwd[c]) {
+		in_bwd[c]=1;
+		bwd[j].push_back(c);
+	}
+
+	// the adjoint tangent of c is not zero: the first-order
+	// terms of all its arguments are not zero either
+	if (!in_stack[c]) {
+		in_stack[c]=1;
+		stack.push_back(c);
+	}
+}
+
+void Hessian::Pattern::add_children(int p, int j) {
+	for (vector<int>::const_iterator it=children[p].begin(); it!=children[p].end(); it++)
+		add_child(p,*it,j);
+}
+
+Hessian::Hessian(Gradient& grad) : f(grad.f), _eval(grad._eval), grad(grad), d(grad.d), g(grad.g), t(f), gt(f),
+		var_t(f.nb_var()), var_gt(f.nb_var()), pattern(NULL), dirty(true) {
+
+	int j=0; // variable index
+
+	for (int s=0; s<f.nb_arg(); s++) {
+		Domain& ts=t.args[s];
+		Domain& gts=gt.args[s];
+		const Dim& dim=f.arg(s).dim;
+
+		for (int c=0; c<dim.size(); c++, j++) {
+			switch (dim.type()) {
+			case Dim::SCALAR:
+				var_t[j]=&ts.i();
+				var_gt[j]=&gts.i();
+				break;
+			case Dim::ROW_VECTOR:
+			case Dim::COL_VECTOR:
+				var_t[j]=&ts.v()[c];
+				var_gt[j]=&gts.v()[c];
+				break;
+			default:
+				var_t[j]=&ts.m()[c/dim.nb_cols()][c%dim.nb_cols()];
+				var_gt[j]=&gts.m()[c/dim.nb_cols()][c%dim.nb_cols()];
+			}
+		}
+	}
+}
+
+Hessian::~Hessian() {
+	if (pattern) {
+		delete pattern->H;
+		delete pattern;
+	}
+}
+
+void Hessian::reset() {
+	for (int i=0; i<f.nodes.size(); i++) {
+		t[i].clear();
+		gt[i].clear();
+	}
+	dirty=false;
+}
+
+bool Hessian::first_order(const IntervalVector& box, const IntervalVector* lambda) {
+
+	if (f.expr().dim.is_matrix())
+		ibex_error("Cannot called \"hessian\" on a matrix-valued function");
+
+	if (lambda) {
+		if (!f.expr().dim.is_vector())
+			ibex_error("Cannot called \"hessian\" with multipliers on a real-valued function");
+		assert(lambda->size()==f.image_dim());
+	} else if (!f.expr().dim.is_scalar())
+		ibex_error("Cannot called \"hessian\" on a vector-valued function (multipliers required)");
+
+	if (_eval.eval(box).is_empty())
+		// outside definition domain
+		return false;
+
+	f.forward<Gradient>(grad);
+
+	if (lambda)
+		g.top->v()=*lambda;
+	else
+		g.top->i()=1.0;
+
+	f.backward<Gradient>(grad);
+
+	return true;
+}
+
+void Hessian::build_pattern() {
+	pattern=new Pattern(*this);
+}
+
+void Hessian::hessian(const IntervalVector& box, const IntervalVector* lambda, SparseIntervalMatrix& H) {
+
+	int n=f.nb_var();
+
+	assert(box.size()==n);
+
+	if (!pattern) build_pattern();
+
+	H=*pattern->H;
+
+	if (!first_order(box,lambda)) {
+		H.set_empty();
+		return;
+	}
+
+	if (dirty) reset();
+	dirty=true;
+
+	Agenda& fwd=pattern->fwd_agenda;
+	Agenda& bwd=pattern->bwd_agenda;
+
+	for (int j=0; j<n; j++) {
+
+		const vector<int>& rows=pattern->rows[j];
+
+		if (rows.empty()) continue;
+
+		fwd.flush();
+		for (vector<int>::const_iterator it=pattern->fwd[j].begin(); it!=pattern->fwd[j].end(); it++)
+			fwd.push(*it);
+
+		bwd.flush();
+		for (vector<int>::const_iterator it=pattern->bwd[j].begin(); it!=pattern->bwd[j].end(); it++)
+			bwd.push(*it);
+
+		*var_t[j]=1.0;
+
+		f.cf.forward<Hessian>(*this, fwd);
+
+		f.cf.backward<Hessian>(*this, bwd);
+
+		for (size_t k=0; k<rows.size(); k++) {
+			H.val(pattern->pos[j][k])=*var_gt[rows[k]];
+		}
+
+		// only the nodes of this column have to be reset
+		*var_t[j]=0;
+		for (vector<int>::const_iterator it=pattern->fwd[j].begin(); it!=pattern->fwd[j].end(); it++)
+			t[*it].clear();
+		for (vector<int>::const_iterator it=pattern->bwd[j].begin(); it!=pattern->bwd[j].end(); it++)
+			gt[*it].clear();
+	}
+
+	dirty=false;
+
+	// H_ij and H_ji are two enclosures of the same value
+	for (int i=0; i<n; i++) {
+		for (int k=H.row_begin(i); k<H.row_end(i); k++) {
+			int j=H.col(k);
+			if (j<=i) continue;
+			int k2=H.find(j,i);
+			if (k2==-1) continue;
+			Interval x=H.val(k) & H.val(k2);
+			if (!x.is_empty()) H.val(k)=H.val(k2)=x;
+		}
+	}
+
+	for (int k=0; k<H.nnz(); k++)
+		if (H.val(k).is_empty()) {
+			H.set_empty();
+			return;
+		}
+}
+
+void Hessian::hessian(const IntervalVector& box, IntervalMatrix& H) {
+	SparseIntervalMatrix S(1,1);
+	hessian(box, NULL, S);
+	if (S.is_empty()) H.set_empty();
+	else H=S.dense();
+}
+
+void Hessian::hessian(const IntervalVector& box, const IntervalVector& lambda, IntervalMatrix& H) {
+	SparseIntervalMatrix S(1,1);
+	hessian(box, &lambda, S);
+	if (S.is_empty()) H.set_empty();
+	else H=S.dense();
+}
+
+void Hessian::hessian_vector(const IntervalVector& box, const IntervalVector* lambda, const IntervalVector& v, IntervalVector& Hv) {
+
+	assert(box.size()==f.nb_var());
+	assert(v.size()==f.nb_var());
+
+	if (!first_order(box,lambda)) {
+		Hv.set_empty();
+		return;
+	}
+
+	if (dirty) reset();
+	dirty=true;
+
+	t.write_arg_domains(v);
+
+	f.forward<Hessian>(*this);
+
+	f.backward<Hessian>(*this);
+
+	gt.read_arg_domains(Hv);
+
+	reset();
+}
+
+bool Hessian::is_convex(const IntervalVector& box) {
+	SparseIntervalMatrix H(1,1);
+	hessian(box, NULL, H);
+
+	if (H.is_empty()) return false;
+
+	for (int i=0; i<H.nb_rows(); i++) {
+		Interval diag=Interval::ZERO;
+		Interval r=Interval::ZERO;
+		for (int k=H.row_begin(i); k<H.row_end(i); k++) {
+			if (H.col(k)==i) diag=H.val(k);
+			else r+=H.val(k).mag();
+		}
+		if ((diag-r).lb()<0) return false;
+	}
+	return true;
+}
+
+Interval Hessian::taylor_eval(const IntervalVector& box, const IntervalVector& x0) {
+
+	int n=f.nb_var();
+
+	assert(x0.is_subset(box));
+
+	Interval fx0=_eval.eval(x0).i();
+	if (fx0.is_empty()) return Interval::EMPTY_SET;
+
+	IntervalVector gx0(n);
+	grad.gradient(x0,gx0);
+	if (gx0.is_empty()) return Interval::EMPTY_SET;
+
+	SparseIntervalMatrix H(1,1);
+	hessian(box, NULL, H);
+	if (H.is_empty()) return Interval::EMPTY_SET;
+
+	IntervalVector dx=box-x0;
+
+	Interval q=Interval::ZERO;
+	for (int i=0; i<n; i++) {
+		for (int k=H.row_begin(i); k<H.row_end(i); k++) {
+			int j=H.col(k);
+			if (j==i)
+				q+=H.val(k)*sqr(dx[i]);
+			else
+				q+=H.val(k)*dx[i]*dx[j];
+		}
+	}
+
+	return fx0 + gx0*dx + 0.5*q;
+}
+
+void Hessian::idx_cp_fwd(int x, int y) {
+	assert(dynamic_cast<const ExprIndex*> (&f.node(y)));
+
+	const ExprIndex& e = (const ExprIndex&) f.node(y);
+
+	t[y] = t[x][e.index];
+}
+
+void Hessian::idx_cp_bwd(int x, int y) {
+	assert(dynamic_cast<const ExprIndex*> (&f.node(y)));
+
+	const ExprIndex& e = (const ExprIndex&) f.node(y);
+	Domain gx=gt[x][e.index];
+	gx = gx + gt[y];
+	gt[x].put(e.index.first_row(), e.index.first_col(), gx);
+}
+
+void Hessian::vector_fwd(int* x, int y) {
+	assert(dynamic_cast<const ExprVector*>(&(f.node(y))));
+
+	const ExprVector& v = (const ExprVector&) f.node(y);
+
+	assert(v.type()!=Dim::SCALAR);
+
+	int j=0;
+
+	if (v.dim.is_vector()) {
+		for (int i=0; i<v.length(); i++) {
+			if (v.arg(i).dim.is_vector()) {
+				t[y].v().put(j,t[x[i]].v());
+				j+=v.arg(i).dim.vec_size();
+			} else {
+				t[y].v()[j]=t.i(x[i]);
+				j++;
+			}
+		}
+	}
+	else {
+		if (v.row_vector()) {
+			for (int i=0; i<v.length(); i++) {
+				if (v.arg(i).dim.is_matrix()) {
+					t[y].m().put(0,j,t[x[i]].m());
+					j+=v.arg(i).dim.nb_cols();
+				} else if (v.arg(i).dim.is_vector()) {
+					t[y].m().set_col(j,t[x[i]].v());
+					j++;
+				}
+			}
+		} else {
+			for (int i=0; i<v.length(); i++) {
+				if (v.arg(i).dim.is_matrix()) {
+					t[y].m().put(j,0,t[x[i]].m());
+					j+=v.arg(i).dim.nb_rows();
+				} else if (v.arg(i).dim.is_vector()) {
+					t[y].m().set_row(j,t[x[i]].v());
+					j++;
+				}
+			}
+		}
+	}
+}
+
+void Hessian::vector_bwd(int* x, int y) {
+	assert(dynamic_cast<const ExprVector*>(&(f.node(y))));
+
+	const ExprVector& v = (const ExprVector&) f.node(y);
+
+	assert(v.type()!=Dim::SCALAR);
+
+	int j=0;
+
+	if (v.dim.is_vector()) {
+		for (int i=0; i<v.length(); i++) {
+			if (v.arg(i).dim.is_vector()) {
+				gt[x[i]].v()+=gt[y].v().subvector(j,j+v.arg(i).dim.vec_size()-1);
+				j+=v.arg(i).dim.vec_size();
+			} else {
+				gt.i(x[i])+=gt[y].v()[j];
+				j++;
+			}
+		}
+	}
+	else {
+		if (v.row_vector()) {
+			for (int i=0; i<v.length(); i++) {
+				if (v.arg(i).dim.is_matrix()) {
+					gt[x[i]].m()+=gt[y].m().submatrix(0,v.dim.nb_rows()-1,j,j+v.arg(i).dim.nb_cols()-1);
+					j+=v.arg(i).dim.nb_cols();
+				} else if (v.arg(i).dim.is_vector()) {
+					gt[x[i]].v()+=gt[y].m().col(j);
+					j++;
+				}
+			}
+		} else {
+			for (int i=0; i<v.length(); i++) {
+				if (v.arg(i).dim.is_matrix()) {
+					gt[x[i]].m()+=gt[y].m().submatrix(j,j+v.arg(i).dim.nb_rows()-1,0,v.dim.nb_cols()-1);
+					j+=v.arg(i).dim.nb_rows();
+				} else if (v.arg(i).dim.is_vector()) {
+					gt[x[i]].v()+=gt[y].m().row(j);
+					j++;
+				}
+			}
+		}
+	}
+}
+
+void Hessian::apply_fwd(int*, int) {
+	not_implemented("Hessian of function applications");
+}
+
+void Hessian::apply_bwd(int*, int) {
+	not_implemented("Hessian of function applications");
+}
+
+namespace {
+
+/*
+ * Derivatives of chi(a,b,c) (same as in Gradient) and
+ * enclosure of the second derivatives (zero, or unbounded
+ * if a may be zero).
+ */
+void chi_diff(const Interval& a, const Interval& b, const Interval& c, Interval& ga, Interval& gb, Interval& gc, Interval& h) {
+	if (a.ub()<0) {
+		ga=Interval::ZERO;
+		gb=Interval::ONE;
+		gc=Interval::ZERO;
+		h=Interval::ZERO;
+	}
+	else if (a.lb()>0) {
+		ga=Interval::ZERO;
+		gb=Interval::ZERO;
+		gc=Interval::ONE;
+		h=Interval::ZERO;
+	} else {
+		if (b.is_degenerated() && c.is_degenerated()) {
+			double _b=b.ub();
+			double _c=c.ub();
+			if (_b<_c) ga=Interval::POS_REALS;
+			else if (_b>_c) ga=Interval::NEG_REALS;
+			else ga=Interval::ZERO;
+		} else {
+			ga=Interval::ALL_REALS;
+		}
+		gb=Interval(0,1);
+		gc=Interval(0,1);
+		h=Interval::ALL_REALS;
+	}
+}
+
+/*
+ * Derivatives of max(x1,x2) (swap x1 and x2 for min)
+ * and enclosure of the second derivatives.
+ */
+void max_diff(const Interval& x1, const Interval& x2, Interval& g1, Interval& g2, Interval& h) {
+	if (x1.lb() > x2.ub()) {
+		g1=Interval::ONE;
+		g2=Interval::ZERO;
+		h=Interval::ZERO;
+	}
+	else if (x2.lb() > x1.ub()) {
+		g1=Interval::ZERO;
+		g2=Interval::ONE;
+		h=Interval::ZERO;
+	} else {
+		g1=Interval(0,1);
+		g2=Interval(0,1);
+		h=Interval::ALL_REALS;
+	}
+}
+
+}
+
+void Hessian::chi_fwd(int a, int b, int c, int y) {
+	Interval ga,gb,gc,h;
+	chi_diff(d.i(a),d.i(b),d.i(c),ga,gb,gc,h);
+	t.i(y)=ga*t.i(a)+gb*t.i(b)+gc*t.i(c);
+}
+
+void Hessian::chi_bwd(int a, int b, int c, int y) {
+	Interval ga,gb,gc,h;
+	chi_diff(d.i(a),d.i(b),d.i(c),ga,gb,gc,h);
+	Interval s=g.i(y)*(h*t.i(a)+h*t.i(b)+h*t.i(c));
+	gt.i(a) += gt.i(y)*ga + s;
+	gt.i(b) += gt.i(y)*gb + s;
+	gt.i(c) += gt.i(y)*gc + s;
+}
+
+void Hessian::max_fwd(int x1, int x2, int y) {
+	Interval g1,g2,h;
+	max_diff(d.i(x1),d.i(x2),g1,g2,h);
+	t.i(y)=g1*t.i(x1)+g2*t.i(x2);
+}
+
+void Hessian::max_bwd(int x1, int x2, int y) {
+	Interval g1,g2,h;
+	max_diff(d.i(x1),d.i(x2),g1,g2,h);
+	Interval s=g.i(y)*(h*t.i(x1)+h*t.i(x2));
+	gt.i(x1) += gt.i(y)*g1 + s;
+	gt.i(x2) += gt.i(y)*g2 + s;
+}
+
+void Hessian::min_fwd(int x1, int x2, int y) {
+	Interval g1,g2,h;
+	max_diff(d.i(x2),d.i(x1),g2,g1,h);
+	t.i(y)=g1*t.i(x1)+g2*t.i(x2);
+}
+
+void Hessian::min_bwd(int x1, int x2, int y) {
+	Interval g1,g2,h;
+	max_diff(d.i(x2),d.i(x1),g2,g1,h);
+	Interval s=g.i(y)*(h*t.i(x1)+h*t.i(x2));
+	gt.i(x1) += gt.i(y)*g1 + s;
+	gt.i(x2) += gt.i(y)*g2 + s;
+}
+
+void Hessian::div_bwd(int x1, int x2, int y) {
+	// d/dx1 = 1/x2, d/dx2 = -x1/x2^2
+	const Interval& q=d.i(y);
+	Interval inv=1.0/d.i(x2);
+	Interval inv2=sqr(inv);
+	gt.i(x1) += gt.i(y)*inv - g.i(y)*t.i(x2)*inv2;
+	gt.i(x2) += -gt.i(y)*q*inv + g.i(y)*(2.0*q*t.i(x2)-t.i(x1))*inv2;
+}
+
+void Hessian::atan2_bwd(int x1, int x2, int y) {
+	// d/dx1 = x2/r, d/dx2 = -x1/r with r=x1^2+x2^2
+	const Interval& a=d.i(x1);
+	const Interval& b=d.i(x2);
+	Interval r=sqr(a)+sqr(b);
+	Interval r2=sqr(r);
+	Interval h11=-2.0*a*b/r2;
+	Interval h12=(sqr(a)-sqr(b))/r2;
+	gt.i(x1) += gt.i(y)*b/r + g.i(y)*(h11*t.i(x1) + h12*t.i(x2));
+	gt.i(x2) += -gt.i(y)*a/r + g.i(y)*(h12*t.i(x1) - h11*t.i(x2));
+}
+
+void Hessian::sign_fwd(int x, int y) {
+	if (d.i(x).contains(0)) t.i(y)=Interval::POS_REALS*t.i(x);
+	else t.i(y)=Interval::ZERO;
+}
+
+void Hessian::sign_bwd(int x, int y) {
+	if (d.i(x).contains(0)) unary_bwd(x, y, Interval::POS_REALS, Interval::ALL_REALS);
+	// otherwise: nothing to do (all derivatives are zero)
+}
+
+void Hessian::abs_fwd(int x, int y) {
+	if (d.i(x).lb()>0) t.i(y)=t.i(x);
+	else if (d.i(x).ub()<0) t.i(y)=-t.i(x);
+	else t.i(y)=Interval(-1,1)*t.i(x);
+}
+
+void Hessian::abs_bwd(int x, int y) {
+	if (d.i(x).lb()>0) gt.i(x) += gt.i(y);
+	else if (d.i(x).ub()<0) gt.i(x) -= gt.i(y);
+	else unary_bwd(x, y, Interval(-1,1), Interval::ALL_REALS);
+}
+
+void Hessian::power_fwd(int x, int y, int p) {
+	if (p==0) t.i(y)=Interval::ZERO;
+	else t.i(y)=p*pow(d.i(x),p-1)*t.i(x);
+}
+
+void Hessian::power_bwd(int x, int y, int p) {
+	switch (p) {
+	case 0:  break;
+	case 1:  gt.i(x) += gt.i(y); break;
+	default: unary_bwd(x, y, p*pow(d.i(x),p-1), (p*(p-1))*pow(d.i(x),p-2));
+	}
+}
+
+void Hessian::tan_bwd(int x, int y) {
+	Interval d1=1.0+sqr(d.i(y));
+	unary_bwd(x, y, d1, 2.0*d.i(y)*d1);
+}
+
+void Hessian::tanh_bwd(int x, int y) {
+	Interval d1=1.0-sqr(d.i(y));
+	unary_bwd(x, y, d1, -2.0*d.i(y)*d1);
+}
+
+void Hessian::acos_bwd(int x, int y) {
+	Interval r=1.0-sqr(d.i(x));
+	Interval s=sqrt(r);
+	unary_bwd(x, y, -1.0/s, -d.i(x)/(r*s));
+}
+
+void Hessian::asin_bwd(int x, int y) {
+	Interval r=1.0-sqr(d.i(x));
+	Interval s=sqrt(r);
+	unary_bwd(x, y, 1.0/s, d.i(x)/(r*s));
+}
+
+void Hessian::atan_bwd(int x, int y) {
+	Interval r=1.0+sqr(d.i(x));
+	unary_bwd(x, y, 1.0/r, -2.0*d.i(x)/sqr(r));
+}
+
+void Hessian::acosh_bwd(int x, int y) {
+	Interval r=sqr(d.i(x))-1.0;
+	Interval s=sqrt(r);
+	unary_bwd(x, y, 1.0/s, -d.i(x)/(r*s));
+}
+
+void Hessian::asinh_bwd(int x, int y) {
+	Interval r=1.0+sqr(d.i(x));
+	Interval s=sqrt(r);
+	unary_bwd(x, y, 1.0/s, -d.i(x)/(r*s));
+}
+
+void Hessian::atanh_bwd(int x, int y) {
+	Interval r=1.0-sqr(d.i(x));
+	unary_bwd(x, y, 1.0/r, 2.0*d.i(x)/sqr(r));
+}
+
+/*
+ * For a bilinear operator y=B(x1,x2), the gradient is
+ * g1=B1(g_y,x2) and g2=B2(x1,g_y) (see Gradient) and the
+ * adjoint tangents are B1(gt_y,x2)+B1(g_y,t2) and
+ * B2(x1,gt_y)+B2(t1,g_y).
+ */
+void Hessian::mul_SV_bwd(int x1, int x2, int y) {
+	gt.i(x1) += gt[y].v()*d[x2].v() + g[y].v()*t[x2].v();
+	gt[x2].v() += d.i(x1)*gt[y].v() + t.i(x1)*g[y].v();
+}
+
+void Hessian::mul_SM_bwd(int x1, int x2, int y) {
+	for (int i=0; i<d[y].m().nb_rows(); i++)
+		gt.i(x1) += gt[y].m()[i]*d[x2].m()[i] + g[y].m()[i]*t[x2].m()[i];
+	gt[x2].m() += d.i(x1)*gt[y].m() + t.i(x1)*g[y].m();
+}
+
+void Hessian::mul_VV_bwd(int x1, int x2, int y) {
+	gt[x1].v() += gt.i(y)*d[x2].v() + g.i(y)*t[x2].v();
+	gt[x2].v() += gt.i(y)*d[x1].v() + g.i(y)*t[x1].v();
+}
+
+void Hessian::mul_MV_bwd(int x1, int x2, int y) {
+	gt[x1].m() += outer_product(gt[y].v(),d[x2].v()) + outer_product(g[y].v(),t[x2].v());
+	gt[x2].v() += d[x1].m().transpose()*gt[y].v() + t[x1].m().transpose()*g[y].v();
+}
+
+void Hessian::mul_VM_bwd(int x1, int x2, int y) {
+	gt[x1].v() += d[x2].m()*gt[y].v() + t[x2].m()*g[y].v();
+	gt[x2].m() += outer_product(d[x1].v(),gt[y].v()) + outer_product(t[x1].v(),g[y].v());
+}
+
+void Hessian::mul_MM_bwd(int x1, int x2, int y) {
+	gt[x1].m() += gt[y].m()*d[x2].m().transpose() + g[y].m()*t[x2].m().transpose();
+	gt[x2].m() += d[x1].m().transpose()*gt[y].m() + t[x1].m().transpose()*g[y].m();
+}
+
+} // namespace ibex
@@ -0,0 +1,299 @@
+/* ============================================================================
+ * I B E X - Hessian of a function
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __IBEX_HESSIAN_H__
+#define __IBEX_HESSIAN_H__
+
+#include "ibex_Gradient.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup symbolic
+ * \brief Calculates the Hessian matrix of a function.
+ *
+ * Forward-over-reverse automatic differentiation on the compiled DAG:
+ * the forward phase calculates the directional derivative ("tangent")
+ * of every node along a direction v and the backward phase calculates
+ * the tangent of the adjoints (the gradient of the Gradient class).
+ * At the end, the tangents of the adjoints of the variables form the
+ * product H*v.
+ *
+ * The Hessian matrix is calculated column by column (v=e_j). The
+ * forward phase of the jth column is restricted to the nodes depending
+ * on x_j and the backward phase to the nodes whose adjoint tangent is
+ * not (structurally) zero. Only the entries of the structural pattern
+ * of the Hessian are calculated.
+ *
+ * No symbolic differentiation is performed.
+ *
+ * For a vector-valued function f, the Hessian is the one of the
+ * weighted sum lambda^T f (e.g., the Hessian of a Lagrangian).
+ * Matrix-valued functions and function applications (ExprApply) are
+ * not supported.
+ *
+ * At points where an operator is not differentiable (abs, sign, max,
+ * min, chi), the second derivative is unbounded.
+ */
+class Hessian : public FwdAlgorithm, public BwdAlgorithm {
+
+public:
+	/**
+	 * \brief Build the Hessian algorithm.
+	 *
+	 * Like the gradient for the evaluator, the Hessian
+	 * is built from an existing Gradient object whose data
+	 * (and evaluator) are shared.
+	 */
+	Hessian(Gradient& grad);
+
+	/**
+	 * \brief Delete this.
+	 */
+	~Hessian();
+
+	/**
+	 * \brief Calculate the Hessian matrix of f (real-valued) on the box \a box.
+	 *
+	 * H is replaced by a matrix whose pattern is the structural pattern of the
+	 * Hessian. The pattern is calculated on the first call.
+	 * H is empty if f is not defined on \a box.
+	 */
+	void hessian(const IntervalVector& box, SparseIntervalMatrix& H);
+
+	/**
+	 * \brief Calculate the Hessian matrix of lambda^T f (f vector-valued) on the box \a box.
+	 */
+	void hessian(const IntervalVector& box, const IntervalVector& lambda, SparseIntervalMatrix& H);
+
+	/**
+	 * \brief Calculate the Hessian matrix of f (real-valued) on the box \a box (dense form).
+	 */
+	void hessian(const IntervalVector& box, IntervalMatrix& H);
+
+	/**
+	 * \brief Calculate the Hessian matrix of lambda^T f (dense form).
+	 */
+	void hessian(const IntervalVector& box, const IntervalVector& lambda, IntervalMatrix& H);
+
+	/**
+	 * \brief Calculate the Hessian-vector product H*v of f (real-valued) on the box \a box.
+	 *
+	 * Performs one forward and one backward phase on the whole DAG.
+	 */
+	void hessian_vector(const IntervalVector& box, const IntervalVector& v, IntervalVector& Hv);
+
+	/**
+	 * \brief Calculate the Hessian-vector product H*v of lambda^T f.
+	 */
+	void hessian_vector(const IntervalVector& box, const IntervalVector& lambda, const IntervalVector& v, IntervalVector& Hv);
+
+	/**
+	 * \brief True if f (real-valued) is proven convex on the box \a box.
+	 *
+	 * Sufficient condition: the interval Hessian matrix is diagonally
+	 * dominant with nonnegative diagonal (Gershgorin).
+	 */
+	bool is_convex(const IntervalVector& box);
+
+	/**
+	 * \brief Second-order Taylor enclosure of f (real-valued) on the box \a box.
+	 *
+	 * Return f(x0) + g(x0)^T(box-x0) + 1/2 (box-x0)^T H(box) (box-x0)
+	 * where g is the gradient and H the Hessian matrix of f.
+	 * \a x0 must be included in \a box.
+	 */
+	Interval taylor_eval(const IntervalVector& box, const IntervalVector& x0);
+
+	/* ====================================== Forward =================================== */
+
+	inline void idx_fwd(int, int)       { /* nothing to do */ }
+	       void idx_cp_fwd(int x, int y);
+	       void vector_fwd(int* x, int y);
+	inline void cst_fwd(int)            { /* nothing to do */ }
+	inline void symbol_fwd(int)         { /* nothing to do */ }
+	       void apply_fwd(int* x, int y);
+	       void chi_fwd(int a, int b, int c, int y);
+	inline void add_fwd(int x1, int x2, int y)   { t.i(y)=t.i(x1)+t.i(x2); }
+	inline void mul_fwd(int x1, int x2, int y)   { t.i(y)=t.i(x1)*d.i(x2)+d.i(x1)*t.i(x2); }
+	inline void sub_fwd(int x1, int x2, int y)   { t.i(y)=t.i(x1)-t.i(x2); }
+	inline void div_fwd(int x1, int x2, int y)   { t.i(y)=(t.i(x1)-d.i(y)*t.i(x2))/d.i(x2); }
+	       void max_fwd(int x1, int x2, int y);
+	       void min_fwd(int x1, int x2, int y);
+	inline void atan2_fwd(int x1, int x2, int y) { t.i(y)=(d.i(x2)*t.i(x1)-d.i(x1)*t.i(x2))/(sqr(d.i(x1))+sqr(d.i(x2))); }
+	inline void minus_fwd(int x, int y)          { t.i(y)=-t.i(x); }
+	inline void minus_V_fwd(int x, int y)        { t[y].v()=-t[x].v(); }
+	inline void minus_M_fwd(int x, int y)        { t[y].m()=-t[x].m(); }
+	inline void trans_V_fwd(int, int)            { /* nothing to do because t[y].v() is a reference to t[x].v() */ }
+	inline void trans_M_fwd(int x, int y)        { t[y].m()=t[x].m().transpose(); }
+	       void sign_fwd(int x, int y);
+	       void abs_fwd(int x, int y);
+	       void power_fwd(int x, int y, int p);
+	inline void sqr_fwd(int x, int y)            { t.i(y)=2.0*d.i(x)*t.i(x); }
+	inline void sqrt_fwd(int x, int y)           { t.i(y)=0.5/d.i(y)*t.i(x); }
+	inline void exp_fwd(int x, int y)            { t.i(y)=d.i(y)*t.i(x); }
+	inline void log_fwd(int x, int y)            { t.i(y)=t.i(x)/d.i(x); }
+	inline void cos_fwd(int x, int y)            { t.i(y)=-sin(d.i(x))*t.i(x); }
+	inline void sin_fwd(int x, int y)            { t.i(y)=cos(d.i(x))*t.i(x); }
+	inline void tan_fwd(int x, int y)            { t.i(y)=(1.0+sqr(d.i(y)))*t.i(x); }
+	inline void cosh_fwd(int x, int y)           { t.i(y)=sinh(d.i(x))*t.i(x); }
+	inline void sinh_fwd(int x, int y)           { t.i(y)=cosh(d.i(x))*t.i(x); }
+	inline void tanh_fwd(int x, int y)           { t.i(y)=(1.0-sqr(d.i(y)))*t.i(x); }
+	inline void acos_fwd(int x, int y)           { t.i(y)=-1.0/sqrt(1.0-sqr(d.i(x)))*t.i(x); }
+	inline void asin_fwd(int x, int y)           { t.i(y)=1.0/sqrt(1.0-sqr(d.i(x)))*t.i(x); }
+	inline void atan_fwd(int x, int y)           { t.i(y)=t.i(x)/(1.0+sqr(d.i(x))); }
+	inline void acosh_fwd(int x, int y)          { t.i(y)=t.i(x)/sqrt(sqr(d.i(x))-1.0); }
+	inline void asinh_fwd(int x, int y)          { t.i(y)=t.i(x)/sqrt(1.0+sqr(d.i(x))); }
+	inline void atanh_fwd(int x, int y)          { t.i(y)=t.i(x)/(1.0-sqr(d.i(x))); }
+	inline void add_V_fwd(int x1, int x2, int y) { t[y].v()=t[x1].v()+t[x2].v(); }
+	inline void add_M_fwd(int x1, int x2, int y) { t[y].m()=t[x1].m()+t[x2].m(); }
+	inline void mul_SV_fwd(int x1, int x2, int y){ t[y].v()=t.i(x1)*d[x2].v()+d.i(x1)*t[x2].v(); }
+	inline void mul_SM_fwd(int x1, int x2, int y){ t[y].m()=t.i(x1)*d[x2].m()+d.i(x1)*t[x2].m(); }
+	inline void mul_VV_fwd(int x1, int x2, int y){ t.i(y)=t[x1].v()*d[x2].v()+d[x1].v()*t[x2].v(); }
+	inline void mul_MV_fwd(int x1, int x2, int y){ t[y].v()=t[x1].m()*d[x2].v()+d[x1].m()*t[x2].v(); }
+	inline void mul_VM_fwd(int x1, int x2, int y){ t[y].v()=t[x1].v()*d[x2].m()+d[x1].v()*t[x2].m(); }
+	inline void mul_MM_fwd(int x1, int x2, int y){ t[y].m()=t[x1].m()*d[x2].m()+d[x1].m()*t[x2].m(); }
+	inline void sub_V_fwd(int x1, int x2, int y) { t[y].v()=t[x1].v()-t[x2].v(); }
+	inline void sub_M_fwd(int x1, int x2, int y) { t[y].m()=t[x1].m()-t[x2].m(); }
+
+	/* ====================================== Backward =================================== */
+
+	inline void idx_bwd    (int, int) { /* nothing to do */ }
+	       void idx_cp_bwd (int x, int y);
+	       void vector_bwd (int* x, int y);
+	inline void symbol_bwd (int) { /* nothing to do */ }
+	inline void cst_bwd    (int) { /* nothing to do */ }
+	       void apply_bwd  (int* x, int y);
+	       void chi_bwd    (int a, int b, int c, int y);
+	inline void add_bwd    (int x1, int x2, int y) { gt.i(x1) += gt.i(y); gt.i(x2) += gt.i(y); }
+	inline void mul_bwd    (int x1, int x2, int y) { gt.i(x1) += gt.i(y)*d.i(x2) + g.i(y)*t.i(x2); gt.i(x2) += gt.i(y)*d.i(x1) + g.i(y)*t.i(x1); }
+	inline void sub_bwd    (int x1, int x2, int y) { gt.i(x1) += gt.i(y); gt.i(x2) -= gt.i(y); }
+	       void div_bwd    (int x1, int x2, int y);
+	       void max_bwd    (int x1, int x2, int y);
+	       void min_bwd    (int x1, int x2, int y);
+	       void atan2_bwd  (int x1, int x2, int y);
+	inline void minus_bwd  (int x, int y) { gt.i(x) -= gt.i(y); }
+	inline void minus_V_bwd(int x, int y) { gt[x].v() -= gt[y].v(); }
+	inline void minus_M_bwd(int x, int y) { gt[x].m() -= gt[y].m(); }
+	inline void trans_V_bwd(int, int)     { /* nothing to do because gt[x].v() is a reference to gt[y].v() */ }
+	inline void trans_M_bwd(int x, int y) { gt[x].m() += gt[y].m().transpose(); }
+	       void sign_bwd   (int x, int y);
+	       void abs_bwd    (int x, int y);
+	       void power_bwd  (int x, int y, int p);
+	inline void sqr_bwd    (int x, int y) { unary_bwd(x, y, 2.0*d.i(x), Interval(2.0)); }
+	inline void sqrt_bwd   (int x, int y) { unary_bwd(x, y, 0.5/d.i(y), -0.25/(d.i(y)*d.i(x))); }
+	inline void exp_bwd    (int x, int y) { unary_bwd(x, y, d.i(y), d.i(y)); }
+	inline void log_bwd    (int x, int y) { unary_bwd(x, y, 1.0/d.i(x), -1.0/sqr(d.i(x))); }
+	inline void cos_bwd    (int x, int y) { unary_bwd(x, y, -sin(d.i(x)), -d.i(y)); }
+	inline void sin_bwd    (int x, int y) { unary_bwd(x, y, cos(d.i(x)), -d.i(y)); }
+	       void tan_bwd    (int x, int y);
+	inline void cosh_bwd   (int x, int y) { unary_bwd(x, y, sinh(d.i(x)), d.i(y)); }
+	inline void sinh_bwd   (int x, int y) { unary_bwd(x, y, cosh(d.i(x)), d.i(y)); }
+	       void tanh_bwd   (int x, int y);
+	       void acos_bwd   (int x, int y);
+	       void asin_bwd   (int x, int y);
+	       void atan_bwd   (int x, int y);
+	       void acosh_bwd  (int x, int y);
+	       void asinh_bwd  (int x, int y);
+	       void atanh_bwd  (int x, int y);
+
+	inline void add_V_bwd (int x1, int x2, int y) { gt[x1].v() += gt[y].v(); gt[x2].v() += gt[y].v(); }
+	inline void add_M_bwd (int x1, int x2, int y) { gt[x1].m() += gt[y].m(); gt[x2].m() += gt[y].m(); }
+	       void mul_SV_bwd(int x1, int x2, int y);
+	       void mul_SM_bwd(int x1, int x2, int y);
+	       void mul_VV_bwd(int x1, int x2, int y);
+	       void mul_MV_bwd(int x1, int x2, int y);
+	       void mul_VM_bwd(int x1, int x2, int y);
+	       void mul_MM_bwd(int x1, int x2, int y);
+	inline void sub_V_bwd (int x1, int x2, int y) { gt[x1].v() += gt[y].v(); gt[x2].v() -= gt[y].v(); }
+	inline void sub_M_bwd (int x1, int x2, int y) { gt[x1].m() += gt[y].m(); gt[x2].m() -= gt[y].m(); }
+
+	Function& f;
+	Eval& _eval;
+	Gradient& grad;
+	ExprDomain& d;   // domains (shared with the evaluator)
+	ExprDomain& g;   // adjoints (shared with the gradient)
+	ExprDomain  t;   // tangents
+	ExprDomain  gt;  // tangents of the adjoints
+	// Tangent of each variable (in t)
+	std::vector<Interval*> var_t;
+	// Tangent of the adjoint of each variable (in gt)
+	std::vector<Interval*> var_gt;
+
+protected:
+	/**
+	 * Calculate the domains and the adjoints (weighted by
+	 * lambda if f is vector-valued). Return false if f is
+	 * not defined on the box.
+	 */
+	bool first_order(const IntervalVector& box, const IntervalVector* lambda);
+
+	/**
+	 * Hessian matrix (lambda=NULL if f is real-valued).
+	 */
+	void hessian(const IntervalVector& box, const IntervalVector* lambda, SparseIntervalMatrix& H);
+
+	/**
+	 * Hessian-vector product (lambda=NULL if f is real-valued).
+	 */
+	void hessian_vector(const IntervalVector& box, const IntervalVector* lambda, const IntervalVector& v, IntervalVector& Hv);
+
+	/**
+	 * Adjoint tangent of an unary operator with
+	 * first derivative d1 and second derivative d2.
+	 */
+	void unary_bwd(int x, int y, const Interval& d1, const Interval& d2);
+
+	/**
+	 * Set all the tangents to zero.
+	 */
+	void reset();
+
+	/**
+	 * Build the structural pattern of the Hessian and, for
+	 * each column, the nodes of the forward/backward phases.
+	 */
+	void build_pattern();
+
+	class Pattern;
+	Pattern* pattern; // NULL if not built yet
+
+	// true if the tangents may be not zero (between two calls)
+	bool dirty;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline void Hessian::unary_bwd(int x, int y, const Interval& d1, const Interval& d2) {
+	gt.i(x) += gt.i(y)*d1 + g.i(y)*d2*t.i(x);
+}
+
+inline void Hessian::hessian(const IntervalVector& box, SparseIntervalMatrix& H) {
+	hessian(box, NULL, H);
+}
+
+inline void Hessian::hessian(const IntervalVector& box, const IntervalVector& lambda, SparseIntervalMatrix& H) {
+	hessian(box, &lambda, H);
+}
+
+inline void Hessian::hessian_vector(const IntervalVector& box, const IntervalVector& v, IntervalVector& Hv) {
+	hessian_vector(box, NULL, v, Hv);
+}
+
+inline void Hessian::hessian_vector(const IntervalVector& box, const IntervalVector& lambda, const IntervalVector& v, IntervalVector& Hv) {
+	hessian_vector(box, &lambda, v, Hv);
+}
+
+} // namespace ibex
+
+#endif // __IBEX_HESSIAN_H__
@@ -29,7 +29,7 @@ void InHC4Revise::iproj(const Domain& y, IntervalVector& x, const IntervalVector
 		assert(!p.top->is_empty());
 	}
 	else {
-		for (int i=0; i<f.expr().size; i++)
+		for (int i=0; i<f.expr().size(); i++)
 			p[i].set_empty();
 	}
 
@@ -41,6 +41,8 @@ void InHC4Revise::iproj(const Domain& y, IntervalVector& x, const IntervalVector
 		return;
 	}
 
+	eval.domains_modified();
+
 	*d.top = y;
 
 	try {
@@ -58,7 +60,7 @@ void InHC4Revise::iproj(const Domain& y, Array<Domain>& x, const Array<Domain>&
 	if (!argP[0].is_empty()) { // if the first domain is empty, so they all are
 		p_eval.eval(argP);
 	} else {
-		for (int i=0; i<f.expr().size; i++)
+		for (int i=0; i<f.expr().size(); i++)
 			p[i].set_empty();
 	}
 
@@ -66,6 +68,8 @@ void InHC4Revise::iproj(const Domain& y, Array<Domain>& x, const Array<Domain>&
 
 	assert(argP[0].is_empty() || !d.top->is_empty());
 
+	eval.domains_modified();
+
 	*d.top = y;
 
 	// may throw EmptyBoxException&) {
@@ -10,14 +10,29 @@
 
 #include "ibex_Linear.h"
 #include "ibex_LinearException.h"
+#include "ibex_MidRadArith.h"
 
 #include <math.h>
 #include <float.h>
 #include <stack>
+#include <vector>
 
 #define TOO_LARGE 1e30
 #define TOO_SMALL 1e-10
 
+#ifdef _IBEX_WITH_BLAS_
+// Below this dimension, the native loops are used (copying
+// the matrices for BLAS/LAPACK is not worth it).
+#define BLAS_MIN_DIM 16
+
+extern "C" {
+// Fortran LAPACK (column-major storage)
+void dgetrf_(const int* m, const int* n, double* a, const int* lda, int* ipiv, int* info);
+void dgetrs_(const char* trans, const int* n, const int* nrhs, const double* a, const int* lda,
+		const int* ipiv, double* b, const int* ldb, int* info);
+}
+#endif
+
 using namespace std;
 
 namespace ibex {
@@ -179,9 +194,247 @@ void LU_solve(const M& LU, const int* p, const V& b, V& x) {
     }
 }
 
+double _real_mid(const Interval& x) { return x.mid(); }
+double _real_lb(const Interval& x)  { return x.lb(); }
+double _real_ub(const Interval& x)  { return x.ub(); }
+
+/*
+ * LU decomposition with partial pivoting of a sparse real matrix.
+ *
+ * The real matrix is obtained by applying "real" to the entries of a sparse
+ * interval matrix. The elimination is right-looking: the rows are kept in
+ * sparse form (with fill-in) and the multipliers are stored column by column.
+ *
+ * \throw SingularMatrixException
+ */
+class SparseLU {
+public:
+	SparseLU(const SparseIntervalMatrix& A, double (*real)(const Interval&));
+
+	/*
+	 * Replace v by U^{-1}L^{-1}Pv (with interval arithmetic).
+	 */
+	void solve(IntervalVector& v) const;
+
+	typedef vector<pair<int,double> > SparseRow;
+
+	int n;
+	vector<int> perm;      // pivot row of each step
+	vector<SparseRow> L;   // multipliers of each step (row, value)
+	vector<SparseRow> U;   // off-diagonal entries of U, by row (column, value)
+	vector<double> diag;   // diagonal of U
+};
+
+SparseLU::SparseLU(const SparseIntervalMatrix& A, double (*real)(const Interval&)) :
+		n(A.nb_rows()), perm(n), L(n), U(n), diag(n) {
+
+	assert(n==A.nb_cols());
+
+	vector<SparseRow> R(n);     // rows not eliminated yet, by increasing column
+	vector<vector<int> > in(n); // rows with an entry in each column (possibly eliminated)
+	vector<char> pivoted(n,0);
+
+	for (int i=0; i<n; i++) {
+		for (int k=A.row_begin(i); k<A.row_end(i); k++) {
+			double a=real(A.val(k));
+			if (!(_mig(a)<TOO_LARGE)) throw SingularMatrixException(); // also catches NaN
+			if (a==0) continue;
+			R[i].push_back(make_pair(A.col(k),a));
+			in[A.col(k)].push_back(i);
+		}
+	}
+
+	SparseRow tmp;
+
+	for (int k=0; k<n; k++) {
+		// all the remaining entries are in columns >=k, so that
+		// the entry in column k is the first one.
+
+		// partial pivot search
+		int p=-1;
+		for (vector<int>::const_iterator it=in[k].begin(); it!=in[k].end(); it++) {
+			if (pivoted[*it] || R[*it].empty() || R[*it][0].first!=k) continue;
+			if (p==-1 || _mig(R[*it][0].second)>_mig(R[p][0].second)) p=*it;
+		}
+
+		if (p==-1) throw SingularMatrixException();
+
+		double pivot=R[p][0].second;
+
+		if (_mig(pivot)<=TOO_SMALL || _mig(1/pivot)>=TOO_LARGE) throw SingularMatrixException();
+
+		perm[k]=p;
+		pivoted[p]=1;
+		diag[k]=pivot;
+		U[k].assign(R[p].begin()+1, R[p].end());
+
+		for (vector<int>::const_iterator it=in[k].begin(); it!=in[k].end(); it++) {
+			int r=*it;
+			if (pivoted[r] || R[r].empty() || R[r][0].first!=k) continue; // (duplicates are skipped here)
+
+			double l=R[r][0].second/pivot;
+			L[k].push_back(make_pair(r,l));
+
+			// R[r] <- R[r] - l*R[p] (without column k)
+			tmp.clear();
+			SparseRow::const_iterator it1=R[r].begin()+1;
+			SparseRow::const_iterator it2=U[k].begin();
+			while (it1!=R[r].end() || it2!=U[k].end()) {
+				if (it2==U[k].end() || (it1!=R[r].end() && it1->first<it2->first)) {
+					tmp.push_back(*it1++);
+				} else if (it1==R[r].end() || it2->first<it1->first) {
+					tmp.push_back(make_pair(it2->first,-l*it2->second));
+					in[it2->first].push_back(r); // fill-in
+					it2++;
+				} else {
+					double a=it1->second-l*it2->second;
+					if (a!=0) tmp.push_back(make_pair(it1->first,a));
+					it1++; it2++;
+				}
+			}
+			R[r].swap(tmp);
+		}
+		SparseRow().swap(R[p]);
+	}
+}
+
+void SparseLU::solve(IntervalVector& v) const {
+	assert(v.size()==n);
+
+	// solve Ly=Pv (in place, with the original row numbers)
+	for (int k=0; k<n; k++) {
+		const Interval& vp=v[perm[k]];
+		if (vp==Interval::ZERO) continue;
+		for (SparseRow::const_iterator it=L[k].begin(); it!=L[k].end(); it++)
+			v[it->first]-=it->second*vp;
+	}
+
+	IntervalVector y(n);
+	for (int k=0; k<n; k++)
+		y[k]=v[perm[k]];
+
+	// solve Ux=y
+	for (int k=n-1; k>=0; k--) {
+		for (SparseRow::const_iterator it=U[k].begin(); it!=U[k].end(); it++)
+			if (y[it->first]!=Interval::ZERO) y[k]-=it->second*y[it->first];
+		y[k]/=diag[k];
+	}
+
+	v=y;
+}
+
+#ifdef _IBEX_WITH_BLAS_
+/*
+ * LU decomposition with partial pivoting of the (m x n) matrix A by LAPACK.
+ *
+ * On return, a contains L and U (column-major storage) and ipiv the
+ * row interchanges (1-based, as in LAPACK). Throws SingularMatrixException
+ * in the same cases as LU(A,LU,p).
+ */
+void lapack_LU(const Matrix& A, vector<double>& a, vector<int>& ipiv) {
+	int m = (A.nb_rows());
+	int n = (A.nb_cols());
+	int min_m_n=m<n? m : n;
+
+	a.resize(m*n);
+	ipiv.resize(min_m_n);
+
+	// check the matrix has no "infinite" values
+	for (int i=0; i<m; i++) {
+		for (int j=0; j<n; j++) {
+			if (_mig(A[i][j])>=TOO_LARGE) throw SingularMatrixException();
+			a[i+j*m]=A[i][j];
+		}
+	}
+
+	int info;
+	dgetrf_(&m,&n,&a[0],&m,&ipiv[0],&info);
+	assert(info>=0);
+
+	// same tests as in LU(A,LU,p), once the decomposition is done
+	for (int i=0; i<min_m_n; i++) {
+		double pivot=a[i+i*m];
+		if (_zero(pivot)) {
+			if (i<min_m_n-1) throw SingularMatrixException();
+			else // in this case, the matrix is not full-rank only if all the remaining columns are zero
+				for (int k=i+1; k<n; k++) {
+					if (!_zero(a[i+k*m])) return; // ok, full rank
+				}
+			throw SingularMatrixException();
+		}
+		if (_mig(1/pivot)>=TOO_LARGE) throw SingularMatrixException();
+	}
+}
+
+void lapack_LU(const Matrix& A, Matrix& LU, int* p) {
+	int m = (A.nb_rows());
+	int n = (A.nb_cols());
+	assert(m == (LU.nb_rows()) && n == (LU.nb_cols()));
+
+	vector<double> a;
+	vector<int> ipiv;
+	lapack_LU(A,a,ipiv);
+
+	// the ith row of the decomposition is stored in LU[p[i]]
+	for (int i=0; i<m; i++) p[i]=i;
+	for (int i=0; i<(int) ipiv.size(); i++) {
+		int tmp = p[i];
+		p[i] = p[ipiv[i]-1];
+		p[ipiv[i]-1] = tmp;
+	}
+
+	for (int i=0; i<m; i++)
+		for (int j=0; j<n; j++)
+			LU[p[i]][j]=a[i+j*m];
+}
+
+void lapack_inverse(const Matrix& A, Matrix& invA) {
+	int n = (A.nb_rows());
+
+	vector<double> a;
+	vector<int> ipiv;
+	lapack_LU(A,a,ipiv);
+
+	// same test as in LU_solve
+	for (int i=0; i<n; i++)
+		if (_mig(a[i+i*n]) <= TOO_SMALL)
+			throw SingularMatrixException();
+
+	vector<double> x(n*n,0.0);
+	for (int i=0; i<n; i++) x[i+i*n]=1;
+
+	const char N='N';
+	int info;
+	dgetrs_(&N,&n,&n,&a[0],&n,&ipiv[0],&x[0],&n,&info);
+	assert(info==0);
+
+	for (int i=0; i<n; i++)
+		for (int j=0; j<n; j++)
+			invA[i][j]=x[i+j*n];
+}
+#endif
+
+/*
+ * C*A, with a midpoint-radius product for large
+ * matrices if BLAS is available.
+ */
+IntervalMatrix precond_mul(const Matrix& C, const IntervalMatrix& A) {
+#ifdef _IBEX_WITH_BLAS_
+	if (A.nb_rows()>=BLAS_MIN_DIM)
+		return midrad_mul(C,A);
+#endif
+	return C*A;
+}
+
 } // end anonymous namespace
 
 void real_LU(const Matrix& A, Matrix& _LU, int* p) {
+#ifdef _IBEX_WITH_BLAS_
+	if (A.nb_rows()>=BLAS_MIN_DIM && A.nb_cols()>=BLAS_MIN_DIM) {
+		lapack_LU(A,_LU,p);
+		return;
+	}
+#endif
 	LU<double,Matrix>(A,_LU,p);
 }
 
@@ -208,6 +461,13 @@ void interval_LU_solve(const IntervalMatrix& LU, const int *p, const IntervalVec
 void real_inverse(const Matrix& A, Matrix& invA) {
 	int n = (A.nb_rows());
 
+#ifdef _IBEX_WITH_BLAS_
+	if (n>=BLAS_MIN_DIM) {
+		lapack_inverse(A, invA);
+		return;
+	}
+#endif
+
 	Matrix LU(n,n);
 	int* p= new int[n];
 
@@ -238,7 +498,7 @@ void neumaier_inverse(const IntervalMatrix& A, IntervalMatrix& invA) {
     Vector u(n, 1);
     Matrix C(n, n);
     real_inverse(A.mid(), C); // throw SingularMatrixException
-    double beta = infinite_norm(C * A - Matrix::eye(n));
+    double beta = infinite_norm(precond_mul(C, A) - Matrix::eye(n));
     if (beta >= 1)
         throw SingularMatrixException();
     Vector w(n);
@@ -308,7 +568,7 @@ void precond(IntervalMatrix& A) {
 		}
 	}
 
-	A = C*A;
+	A = precond_mul(C,A);
 }
 
 void precond(IntervalMatrix& A, IntervalVector& b) {
@@ -328,10 +588,60 @@ void precond(IntervalMatrix& A, IntervalVector& b) {
 	//   cout << "A=" << (A.nb_cols()) << "x" << (A.nb_rows()) << "  " << "b=" << (b.size()) << "  " << "C="
 	//        << (C.nb_cols()) << "x" << (C.nb_rows()) << endl;
 	//cout << "C=" << C << endl;
-	A = C*A;
+	A = precond_mul(C,A);
 	b = C*b;
 }
 
+void precond(SparseIntervalMatrix& A, IntervalVector& b) {
+	int n=(A.nb_rows());
+	assert(n == A.nb_cols()); //throw NotSquareMatrixException();  // not well-constraint problem
+	assert(n == b.size());
+
+	SparseLU* lu;
+	try { lu=new SparseLU(A,_real_mid); }
+	catch (SingularMatrixException&) {
+		try { lu=new SparseLU(A,_real_lb); }
+		catch (SingularMatrixException&) {
+			lu=new SparseLU(A,_real_ub);
+		}
+	}
+
+	// entries of A by column (row, position)
+	vector<vector<pair<int,int> > > col(n);
+	for (int i=0; i<n; i++)
+		for (int k=A.row_begin(i); k<A.row_end(i); k++)
+			col[A.col(k)].push_back(make_pair(i,k));
+
+	// entries of the result, by row (the columns are
+	// processed by increasing number)
+	vector<vector<int> > rows(n);
+	vector<vector<Interval> > values(n);
+
+	IntervalVector v(n,Interval::ZERO);
+
+	for (int j=0; j<n; j++) {
+		for (vector<pair<int,int> >::const_iterator it=col[j].begin(); it!=col[j].end(); it++)
+			v[it->first]=A.val(it->second);
+
+		lu->solve(v);
+
+		for (int i=0; i<n; i++)
+			if (v[i]!=Interval::ZERO) {
+				rows[i].push_back(j);
+				values[i].push_back(v[i]);
+				v[i]=Interval::ZERO;
+			}
+	}
+
+	lu->solve(b);
+	delete lu;
+
+	A=SparseIntervalMatrix(n,rows);
+	for (int i=0; i<n; i++)
+		for (int k=A.row_begin(i); k<A.row_end(i); k++)
+			A.val(k)=values[i][k-A.row_begin(i)];
+}
+
 void gauss_seidel(const IntervalMatrix& A, const IntervalVector& b, IntervalVector& x, double ratio) {
 	int n=(A.nb_rows());
 	assert(n == (A.nb_cols())); // throw NotSquareMatrixException();
@@ -359,6 +669,36 @@ void gauss_seidel(const IntervalMatrix& A, const IntervalVector& b, IntervalVect
 	} while (red >= ratio);
 }
 
+void gauss_seidel(const SparseIntervalMatrix& A, const IntervalVector& b, IntervalVector& x, double ratio) {
+	int n=(A.nb_rows());
+	assert(n == (A.nb_cols())); // throw NotSquareMatrixException();
+	assert(n == (x.size()) && n == (b.size()));
+
+	double red;
+	Interval old, proj, tmp;
+
+	do {
+		red = 0;
+		for (int i=0; i<n; i++) {
+			old = x[i];
+			proj = b[i];
+			tmp = Interval::ZERO; // if the diagonal entry is not stored
+
+			for (int k=A.row_begin(i); k<A.row_end(i); k++) {
+				if (A.col(k)!=i) proj -= A.val(k)*x[A.col(k)];
+				else tmp=A.val(k);
+			}
+
+			bwd_mul(proj,tmp,x[i]);
+
+			if (x[i].is_empty()) { x.set_empty(); return; }
+
+			double gain=old.rel_distance(x[i]);
+			if (gain>red) red=gain;
+		}
+	} while (red >= ratio);
+}
+
 bool inflating_gauss_seidel(const IntervalMatrix& A, const IntervalVector& b, IntervalVector& x, double min_dist, double mu_max) {
 	int n=(A.nb_rows());
 	assert(n == (A.nb_cols()));
@@ -12,6 +12,7 @@
 #define __IBEX_LINEAR_H__
 
 #include "ibex_IntervalMatrix.h"
+#include "ibex_SparseIntervalMatrix.h"
 #include "ibex_LinearException.h"
 
 /** \file */
@@ -170,6 +171,23 @@ void precond(IntervalMatrix& A, IntervalVector& b);
  */
 void precond(IntervalMatrix& A);
 
+/**
+ * \brief Preconditions a sparse system \f$[A]x=[b]\f$.
+ *
+ * <br> Same as #precond(IntervalMatrix&, IntervalVector&) except that
+ * the real matrix C (\c Mid([A]), \c Inf([A]) or \c Sup([A])) is not
+ * inverted: a sparse LU decomposition of C is calculated and [A] (column
+ * by column) and [b] are replaced by the result of the forward/backward
+ * substitutions with L and U, performed with interval arithmetic.
+ * The entries of \f$C^{-1}[A]\f$ that are exactly zero are not stored.
+ *
+ * \note The pattern of the result may be (much) larger than the pattern of [A].
+ *
+ * \throw SingularMatrixException if no real matrix extracted from [A] could be decomposed successfully.
+ *                                In this case, A and b are not modified.
+ */
+void precond(SparseIntervalMatrix& A, IntervalVector& b);
+
 /**
  * \brief Gauss-Seidel algorithm.
  *
@@ -188,6 +206,13 @@ void precond(IntervalMatrix& A);
  */
 void gauss_seidel(const IntervalMatrix& A, const IntervalVector& b, IntervalVector& x, double ratio=0.01);
 
+/**
+ * \brief Gauss-Seidel algorithm (sparse matrix).
+ *
+ * \see #gauss_seidel(const IntervalMatrix&, const IntervalVector&, IntervalVector&, double).
+ */
+void gauss_seidel(const SparseIntervalMatrix& A, const IntervalVector& b, IntervalVector& x, double ratio=0.01);
+
 /**
  * \brief Gauss-Seidel algorithm (inflating variant).<br>
  *
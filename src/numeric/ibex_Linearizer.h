@@ -43,6 +43,19 @@ public:
 	 */
 	virtual int linearize(const IntervalVector& box, LPSolver& lp_solver)=0;
 
+	/**
+	 * \brief Whether the constraints are updated in place.
+	 *
+	 * An incremental linearizer keeps the constraints it has added in
+	 * the LP solver and, at the next call with the same LP solver, only
+	 * replaces those that have changed. The caller should therefore not
+	 * remove them between two calls (it is safe to do so, but then all the
+	 * constraints are added again).
+	 *
+	 * Return false by default.
+	 */
+	virtual bool is_incremental() const;
+
 	/**
 	 * \brief Delete this.
 	 */
@@ -67,6 +80,10 @@ inline int Linearizer::nb_var() const {
 	return n;
 }
 
+inline bool Linearizer::is_incremental() const {
+	return false;
+}
+
 } /* namespace ibex */
 
 #endif /* __IBEX_LINEARIZER_H__ */
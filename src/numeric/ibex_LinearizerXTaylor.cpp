@@ -35,7 +35,8 @@ LinearizerXTaylor::LinearizerXTaylor(const System& _sys, approx_mode _mode, corn
 			Linearizer(_sys.nb_var), sys(_sys),
 			m(sys.f_ctrs.image_dim()), goal_ctr(-1 /*tmp*/),
 			mode(_mode), slope(_slope),
-			inf(new bool[n]), lp_solver(NULL) {
+			inf(new bool[n]), lp_solver(NULL), incremental(false), nb_slots(-1),
+			nb_rows(0), last_lp(NULL), first_row(-1), last_box(n) {
 
 	if (dynamic_cast<const ExtendedSystem*>(&sys)) {
 		((int&) goal_ctr)=((const ExtendedSystem&) sys).goal_ctr();
@@ -59,10 +60,31 @@ LinearizerXTaylor::~LinearizerXTaylor() {
 	delete[] inf;
 }
 
+void LinearizerXTaylor::set_incremental(bool _incremental) {
+	incremental = _incremental;
+	first_row = -1;
+}
+
+bool LinearizerXTaylor::is_incremental() const {
+	return incremental && mode==RELAX;
+}
+
 int LinearizerXTaylor::linearize(const IntervalVector& box, LPSolver& _lp_solver)  {
 	lp_solver = &_lp_solver;
 
-	if (mode==RELAX)
+	if (is_incremental()) {
+		try {
+			int nb_nontrivial=linear_relax_incremental(box);
+			// more than half of the rows are trivial
+			if (nb_nontrivial!=-1 && (int) free_rows.size()>nb_nontrivial)
+				compact_rows();
+			return nb_nontrivial;
+		} catch(LPException&) {
+			first_row = -1; // the rows are in an unknown state
+			throw;
+		}
+	}
+	else if (mode==RELAX)
 		return linear_relax(box);
 	else
 		return linear_restrict(box);
@@ -79,10 +101,10 @@ int LinearizerXTaylor::linear_relax(const IntervalVector& box)  {
 
 	int ma=active.size();
 
-	IntervalMatrix Df(ma,n); // derivatives over the box
+	SparseIntervalMatrix Df(ma,n); // derivatives over the box
 
 	if (slope == TAYLOR) { // compute derivatives once for all
-		Df=sys.f_ctrs.jacobian(box,active);
+		sys.f_ctrs.jacobian(box,Df,active);
 		//Df=sys.active_ctrs_jacobian(box);  // --> better with SystemBox
 
 		if (Df.is_empty()) return -1;
@@ -105,8 +127,10 @@ int LinearizerXTaylor::linear_relax(const IntervalVector& box)  {
 
 			// ========= update derivatives (Hansen mode) ========
 			if (slope == HANSEN) {
-				sys.f_ctrs.hansen_matrix(box,corner,Df,active);
-				if (Df.is_empty()) continue; // skip this corner
+				IntervalMatrix H(ma,n);
+				sys.f_ctrs.hansen_matrix(box,corner,H,active);
+				if (H.is_empty()) continue; // skip this corner
+				Df=SparseIntervalMatrix(H);
 			}
 
 			int c; // constraint number
@@ -124,12 +148,12 @@ int LinearizerXTaylor::linear_relax(const IntervalVector& box)  {
 
 				try {
 					if (sys.ops[c]==LEQ || sys.ops[c]==LT || sys.ops[c]==EQ)
-						count += linearize_leq_corner(box,corner,Df[i],g_corner[i]);
+						count += linearize_leq_corner(box,corner,Df,i,false,g_corner[i]);
 
 					// note: in case of equality g(x)=0, we also add a linear relaxation for
 					// g(x)>=0, except if this is the "goal constraint" y=f(x).
 					if (sys.ops[c]==GEQ || sys.ops[c]==GT || sys.ops[c]==EQ) // && c!=goal_ctr))
-						count += linearize_leq_corner(box,corner,-Df[i],-g_corner[i]);
+						count += linearize_leq_corner(box,corner,Df,i,true,-g_corner[i]);
 
 				} catch (LPException&) {
 					continue;  // just skip this constraint
@@ -157,7 +181,8 @@ int LinearizerXTaylor::linear_restrict(const IntervalVector& box) {
 		// the corner used -> typed IntervalVector just to have guaranteed computations
 		IntervalVector corner = get_corner_point(box);
 
-		IntervalMatrix J=sys.f_ctrs.jacobian(box,active);
+		SparseIntervalMatrix J(active.size(),n);
+		sys.f_ctrs.jacobian(box,J,active);
 		//IntervalMatrix J=sys.active_ctrs_jacobian(box);  // --> better with SystemBox
 
 		if (J.is_empty()) return -1; // note: no way to inform that the box is actually infeasible
@@ -180,9 +205,9 @@ int LinearizerXTaylor::linear_restrict(const IntervalVector& box) {
 					// in principle we could deal with linear constraints
 					return -1;
 				else if (c==goal_ctr || sys.ops[c]==LEQ || sys.ops[c]==LT)
-					count += linearize_leq_corner(box,corner,J[i],g_corner[i]);
+					count += linearize_leq_corner(box,corner,J,i,false,g_corner[i]);
 				else
-					count += linearize_leq_corner(box,corner,-J[i],-g_corner[i]);
+					count += linearize_leq_corner(box,corner,J,i,true,-g_corner[i]);
 			} catch (LPException&) {
 				return -1;
 			} catch (Unsatisfiability&) {
@@ -196,6 +221,199 @@ int LinearizerXTaylor::linear_restrict(const IntervalVector& box) {
 
 }
 
+void LinearizerXTaylor::init_incremental() {
+
+	const Gradient& g=sys.f_ctrs.deriv_calculator();
+	const bool* is_linear=g.is_linear;
+
+	leq_slot.assign(corners.size()*m,-1);
+	geq_slot.assign(corners.size()*m,-1);
+	nb_slots=0;
+
+	for (unsigned int k=0; k<corners.size(); k++) {
+		for (int c=0; c<m; c++) {
+			// only one corner for a linear constraint
+			if (k>0 && is_linear[c]) continue;
+
+			if (sys.ops[c]==LEQ || sys.ops[c]==LT || sys.ops[c]==EQ)
+				leq_slot[k*m+c]=nb_slots++;
+
+			if (sys.ops[c]==GEQ || sys.ops[c]==GT || sys.ops[c]==EQ)
+				geq_slot[k*m+c]=nb_slots++;
+		}
+	}
+
+	var_ctrs.assign(n,vector<int>());
+
+	// a variable with a zero coefficient in the linear part does not
+	// appear in the constraint (nonlinear occurrences give an unbounded
+	// coefficient). This avoids generating the components of f_ctrs.
+	for (int c=0; c<m; c++) {
+		for (int j=0; j<n; j++)
+			if (g.coeff_matrix[c][j]!=Interval::ZERO)
+				var_ctrs[j].push_back(c);
+	}
+}
+
+int LinearizerXTaylor::linear_relax_incremental(const IntervalVector& box) {
+
+	if (nb_slots==-1) init_incremental();
+
+	// constraints whose rows have to be recalculated
+	BitSet changed=BitSet::empty(m);
+
+	if (lp_solver!=last_lp || first_row==-1 || lp_solver->get_nb_rows()!=first_row+nb_rows) {
+		// the rows are not in the LP solver: they are all added again
+		last_lp=lp_solver;
+		first_row=lp_solver->get_nb_rows();
+		row.assign(nb_slots,-1);
+		free_rows.clear();
+		nb_rows=0;
+		if (m>0) changed.fill(0,m-1);
+	} else {
+		for (int j=0; j<n; j++) {
+			if (box[j]!=last_box[j])
+				for (vector<int>::const_iterator it=var_ctrs[j].begin(); it!=var_ctrs[j].end(); it++)
+					changed.add(*it);
+		}
+	}
+
+	last_box=box;
+
+	if (changed.empty()) return nb_rows-(int) free_rows.size();
+
+	// ========= get active constraints ===========
+	BitSet active=sys.active_ctrs(box);
+
+	// the changed constraints that are active
+	BitSet todo=BitSet::empty(m);
+
+	int c; // constraint number
+
+	for (int i=0; i<changed.size(); i++) {
+		c=(i==0? changed.min() : changed.next(c));
+
+		if (active[c])
+			todo.add(c);
+		else
+			// no more row for this constraint
+			for (unsigned int k=0; k<corners.size(); k++) {
+				set_trivial(leq_slot[k*m+c]);
+				set_trivial(geq_slot[k*m+c]);
+			}
+	}
+
+	if (todo.empty()) return nb_rows-(int) free_rows.size();
+
+	int mt=todo.size();
+
+	SparseIntervalMatrix Df(mt,n); // derivatives over the box
+
+	if (slope == TAYLOR) { // compute derivatives once for all
+		sys.f_ctrs.jacobian(box,Df,todo);
+
+		if (Df.is_empty()) {
+			first_row=-1;
+			return -1;
+		}
+	}
+
+	for(unsigned int k=0; k<corners.size(); k++) {
+
+		// ============ get the corner point =================
+		get_corner(corners[k]);
+
+		IntervalVector corner(n);
+		IntervalVector g_corner(mt);
+
+		// whether the corner is skipped
+		bool skip=false;
+
+		try {
+			corner=get_corner_point(box);
+
+			// the evaluation of the constraints in the corner x_corner
+			g_corner=sys.f_ctrs.eval_vector(corner,todo);
+
+			skip=g_corner.is_empty();
+
+			// ========= update derivatives (Hansen mode) ========
+			if (!skip && slope == HANSEN) {
+				IntervalMatrix H(mt,n);
+				sys.f_ctrs.hansen_matrix(box,corner,H,todo);
+				skip=H.is_empty();
+				if (!skip) Df=SparseIntervalMatrix(H);
+			}
+		} catch(NoCornerPoint&) {
+			skip=true;
+		}
+
+		for (int i=0; i<mt; i++) {
+			c=(i==0? todo.min() : todo.next(c));
+
+			int leq=leq_slot[k*m+c];
+			int geq=geq_slot[k*m+c];
+
+			if (skip) {
+				set_trivial(leq);
+				set_trivial(geq);
+				continue;
+			}
+
+			try {
+				if (leq!=-1)
+					linearize_leq_corner(box,corner,Df,i,false,g_corner[i],leq);
+
+				if (geq!=-1)
+					linearize_leq_corner(box,corner,Df,i,true,-g_corner[i],geq);
+
+			} catch (LPException&) {
+				// just skip this constraint
+				set_trivial(leq);
+				set_trivial(geq);
+			} catch (Unsatisfiability&) {
+				first_row=-1;
+				return -1;
+			}
+		}
+	}
+
+	return nb_rows-(int) free_rows.size();
+}
+
+void LinearizerXTaylor::set_trivial(int slot) {
+	if (slot==-1 || row[slot]==-1) return;
+
+	lp_solver->set_constraint(first_row+row[slot], Vector::zeros(n), LEQ, 1.0); // note: may throw LPException
+	free_rows.push_back(row[slot]);
+	row[slot]=-1;
+}
+
+void LinearizerXTaylor::compact_rows() {
+	int nb_nontrivial=nb_rows-(int) free_rows.size();
+
+	Matrix A(nb_nontrivial>0? lp_solver->get_nb_rows() : 1, n);
+	IntervalVector lhs_rhs(nb_nontrivial>0? lp_solver->get_nb_rows() : 1);
+
+	if (nb_nontrivial>0) {
+		lp_solver->get_rows(A);
+		lp_solver->get_lhs_rhs(lhs_rhs);
+	}
+
+	// note: all these calls may throw LPException
+	lp_solver->clean_ctrs(first_row);
+	free_rows.clear();
+	nb_rows=0;
+
+	// the rows are added again in the order of the slots
+	for (int s=0; s<nb_slots; s++) {
+		if (row[s]==-1) continue;
+		int i=first_row+row[s];
+		row[s]=nb_rows++;
+		lp_solver->add_constraint(A[i], LEQ, lhs_rhs[i].ub());
+	}
+}
+
 void LinearizerXTaylor::get_corner(corner_id id) {
 
 	for (int j=0; j<n; j++) {
@@ -246,12 +464,14 @@ IntervalVector LinearizerXTaylor::get_corner_point(const IntervalVector& box) {
 	return pt;
 }
 
-int LinearizerXTaylor::linearize_leq_corner(const IntervalVector& box, IntervalVector& corner, const IntervalVector& dg_box, const Interval& g_corner) {
-	Vector a(n); // vector of coefficients
+int LinearizerXTaylor::linearize_leq_corner(const IntervalVector& box, IntervalVector& corner, const SparseIntervalMatrix& Dg, int i, bool neg, const Interval& g_corner, int slot) {
+	Vector a(n); // vector of coefficients (zero outside the pattern of Dg)
 
-	if (dg_box.max_diam() > lp_solver->default_limit_diam_box.ub()) {
-		// we also also avoid this way to deal with infinite bounds (see below)
-		throw LPException();
+	for (int k=Dg.row_begin(i); k<Dg.row_end(i); k++) {
+		if (Dg.val(k).diam() > lp_solver->default_limit_diam_box.ub()) {
+			// we also also avoid this way to deal with infinite bounds (see below)
+			throw LPException();
+		}
 	}
 
 	// ========= compute matrix of coefficients ===========
@@ -259,23 +479,28 @@ int LinearizerXTaylor::linearize_leq_corner(const IntervalVector& box, IntervalV
 	// constraint gradient, depending on the position of the
 	// corresponding component of the corner and the
 	// linearization mode.
-	for (int j=0; j<n; j++) {
+	Interval ac=Interval::ZERO; // a*corner
+
+	for (int k=Dg.row_begin(i); k<Dg.row_end(i); k++) {
+		int j=Dg.col(k);
+		Interval dg_box=neg? -Dg.val(k) : Dg.val(k);
 		if ((mode==RELAX && !inf[j]) || (mode==RESTRICT && inf[j]))
-			a[j]=dg_box[j].ub();
+			a[j]=dg_box.ub();
 		else
-			a[j]=dg_box[j].lb();
+			a[j]=dg_box.lb();
+		ac += a[j]*corner[j];
 	}
 	// =====================================================
 
-	Interval rhs = -g_corner + a*corner;
+	Interval rhs = -g_corner + ac;
 
 	double b = mode==RESTRICT? rhs.lb() - lp_solver->get_epsilon() : rhs.ub();
 
 	// may throw Unsatisfiability and LPException
-	return check_and_add_constraint(box,a,b);
+	return check_and_add_constraint(box,a,b,slot);
 }
 
-int LinearizerXTaylor::check_and_add_constraint(const IntervalVector& box, const Vector& a, double b) {
+int LinearizerXTaylor::check_and_add_constraint(const IntervalVector& box, const Vector& a, double b, int slot) {
 
 	Interval ax=a*box; // for fast (in)feasibility check
 
@@ -286,11 +511,27 @@ int LinearizerXTaylor::check_and_add_constraint(const IntervalVector& box, const
 		throw Unsatisfiability();
 	else if (ax.ub()<=b) {
 		// the (linear) constraint is satisfied for any point in the box
+		set_trivial(slot);
 		return 0;
-	} else {
+	} else if (slot==-1) {
 		//cout << "add constraint " << a << "*x<=" << b << endl;
 		lp_solver->add_constraint(a, LEQ, b); // note: may throw LPException
 		return 1;
+	} else {
+		if (row[slot]==-1) {
+			if (free_rows.empty()) {
+				// note: our rows are the last ones (see linear_relax_incremental)
+				lp_solver->add_constraint(a, LEQ, b); // note: may throw LPException
+				row[slot]=nb_rows++;
+				return 1;
+			}
+			// take a free row first so that it is reset
+			// by set_trivial if the LP solver fails
+			row[slot]=free_rows.back();
+			free_rows.pop_back();
+		}
+		lp_solver->set_constraint(first_row+row[slot], a, LEQ, b); // note: may throw LPException
+		return 1;
 	}
 }
 
@@ -87,6 +87,32 @@ public:
 	 */
 	virtual int linearize(const IntervalVector& box, LPSolver& lp_solver);
 
+	/**
+	 * \brief Set the incremental mode (RELAX mode only).
+	 *
+	 * In incremental mode, the rows added in the LP solver are kept
+	 * from one call to the other. At the next call with the same LP solver,
+	 * only the rows of the constraints that depend on a variable whose domain
+	 * has changed are recalculated and replaced in place. A row that is no
+	 * longer generated is set to the trivial constraint 0<=1 and reused for
+	 * the next generated one. When more than half of the rows are trivial,
+	 * the rows of the linearizer (which must be the last rows of the LP
+	 * solver) are compacted. If the rows have been removed in the meantime
+	 * (e.g., by LPSolver::clean_ctrs()), they are all added again.
+	 *
+	 * In this mode, linearize(...) returns the total number of non-trivial
+	 * rows and throws LPException if the LP solver fails to update a row
+	 * (the rows should then be removed).
+	 *
+	 * By default, the linearizer is not incremental.
+	 */
+	void set_incremental(bool incremental);
+
+	/**
+	 * \brief Whether the incremental mode is set.
+	 */
+	virtual bool is_incremental() const;
+
 private:
 
 	/**
@@ -104,6 +130,28 @@ private:
 	 */
 	int linear_restrict(const IntervalVector& box);
 
+	/**
+	 * \brief Linearization (RELAX mode, incremental)
+	 */
+	int linear_relax_incremental(const IntervalVector& box);
+
+	/**
+	 * \brief Initialize the rows and the dependencies (incremental mode).
+	 */
+	void init_incremental();
+
+	/**
+	 * \brief Set the row of a slot to the trivial constraint (incremental mode).
+	 *
+	 * The row becomes free. Does nothing if \a slot is -1.
+	 */
+	void set_trivial(int slot);
+
+	/**
+	 * \brief Remove the free rows (incremental mode).
+	 */
+	void compact_rows();
+
 	/**
 	 * \brief Set the corner information "inf" (see below).
 	 *
@@ -119,15 +167,18 @@ private:
 	/**
 	 * \brief Linearize a constraint g(x)<=0 inside a box, from a given corner.
 	 *
-	 * \param dg_box:   dg([box])
+	 * \param Dg:       the ith row of Dg is dg([box]) (or -dg([box]) if \a neg is true)
 	 * \param g_corner: g(corner)
+	 * \param slot:     the slot of the row in incremental mode (-1: the row is added)
 	 */
-	int linearize_leq_corner(const IntervalVector& box, IntervalVector& corner, const IntervalVector& dg_box, const Interval& g_corner);
+	int linearize_leq_corner(const IntervalVector& box, IntervalVector& corner, const SparseIntervalMatrix& Dg, int i, bool neg, const Interval& g_corner, int slot=-1);
 
 	/**
 	 * \brief Add the constraint ax<=b in the LP solver.
+	 *
+	 * If \a slot is not -1, replace the row of the slot instead.
 	 */
-	int check_and_add_constraint(const IntervalVector& box, const Vector& a, double b);
+	int check_and_add_constraint(const IntervalVector& box, const Vector& a, double b, int slot=-1);
 
 	/**
 	 * \brief The system
@@ -172,6 +223,59 @@ private:
 	 */
 	LPSolver* lp_solver;
 
+	/**
+	 * Incremental mode.
+	 */
+	bool incremental;
+
+	/*
+	 * Slots of the rows in incremental mode: leq_slot[k*m+c] (resp. geq_slot)
+	 * is the slot of the linearization of the constraint c at the kth corner
+	 * on the "<=" (resp. ">=") side, or -1 if there is none.
+	 */
+	std::vector<int> leq_slot, geq_slot;
+
+	/**
+	 * Number of slots (-1 if not initialized).
+	 */
+	int nb_slots;
+
+	/**
+	 * Row of each slot, relatively to first_row (-1 if the
+	 * linearization is trivial: the slot has no row).
+	 */
+	std::vector<int> row;
+
+	/**
+	 * Free rows (set to 0<=1), relatively to first_row.
+	 */
+	std::vector<int> free_rows;
+
+	/**
+	 * Number of rows (including the free ones).
+	 */
+	int nb_rows;
+
+	/**
+	 * Constraints depending on each variable.
+	 */
+	std::vector<std::vector<int> > var_ctrs;
+
+	/**
+	 * LP solver of the last call (incremental mode).
+	 */
+	LPSolver* last_lp;
+
+	/**
+	 * First row of the linearizer in last_lp (-1 if the rows have to be added again).
+	 */
+	int first_row;
+
+	/**
+	 * Box of the last call (incremental mode).
+	 */
+	IntervalVector last_box;
+
 };
 
 } // end namespace ibex
@@ -36,6 +36,8 @@ public:
     virtual void separate(IntervalVector& x_in, IntervalVector& x_out);
 
 protected:
+	friend class ParallelGroups;
+
 	/**
 	 * \brief The sub-separator
 	 */
@@ -13,13 +13,28 @@
 
 namespace ibex {
 
-SepQInter::SepQInter(const Array<Sep>& list, int q) :
+SepQInter::SepQInter(const Array<Sep>& list, int q, int nb_threads) :
 	Sep(list[0].nb_var),
 	list(list),
 	boxes_in(list.size(), list[0].nb_var),
-	boxes_out(list.size(), list[0].nb_var)
+	boxes_out(list.size(), list[0].nb_var),
+	groups(list),
+	pool(nb_threads>1 && groups.size()>1? new ThreadPool(nb_threads) : NULL)
 	{ this->set_q(q); }
 
+SepQInter::SepQInter(const SepQInter& s) :
+	Sep(s.nb_var),
+	list(s.list),
+	boxes_in(s.boxes_in),
+	boxes_out(s.boxes_out),
+	q(s.q),
+	groups(s.groups),
+	pool(s.pool? new ThreadPool(s.pool->nb_threads) : NULL)
+	{ }
+
+SepQInter::~SepQInter() {
+	if (pool) delete pool;
+}
 
 void SepQInter::separate(IntervalVector& xin, IntervalVector& xout) {
 	Array<IntervalVector> refs_in(list.size());
@@ -30,12 +45,19 @@ void SepQInter::separate(IntervalVector& xin, IntervalVector& xout) {
 		boxes_in[i]=xin;
 		boxes_out[i]=xout;
 
-		list[i].separate(boxes_in[i], boxes_out[i]);
-
 		refs_in.set_ref(i,boxes_in[i]);
 		refs_out.set_ref(i,boxes_out[i]);
 	}
 
+	if (pool)
+		pool->run(groups.size(), [this](int g) {
+			for (std::vector<int>::const_iterator i=groups[g].begin(); i!=groups[g].end(); i++)
+				list[*i].separate(boxes_in[*i], boxes_out[*i]);
+		});
+	else
+		for (int i=0; i<list.size(); i++)
+			list[i].separate(boxes_in[i], boxes_out[i]);
+
 	xin &= qinter(refs_in,q+1);
   xout &= qinter(refs_out, list.size() - q);
 
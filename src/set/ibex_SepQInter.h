@@ -14,6 +14,8 @@
 #include "ibex_Sep.h"
 #include "ibex_Array.h"
 #include "ibex_IntervalMatrix.h"
+#include "ibex_ThreadPool.h"
+#include "ibex_ParallelGroups.h"
 
 namespace ibex {
 /**
@@ -35,8 +37,20 @@ public:
 	 * \param list : list of separators
 	 * 				The list itself is not kept by reference.
 	 * \param q : the nunmber of constrains that can be relaxed
+	 * \param nb_threads : number of threads used to apply the separators
+	 *              (see #CtcQInter::CtcQInter(const Array<Ctc>&, int, int))
 	 */
-    SepQInter(const Array<Sep>& list, int q = 0);
+    SepQInter(const Array<Sep>& list, int q = 0, int nb_threads = 1);
+
+	/**
+	 * \brief Duplicate a q-intersection (with its own threads).
+	 */
+    SepQInter(const SepQInter& s);
+
+	/**
+	 * \brief Delete *this.
+	 */
+    virtual ~SepQInter();
 
 
   /**
@@ -75,6 +89,15 @@ protected:
 	 */
 	int q;
 
+	/**
+	 * \brief The separators that can be applied in parallel
+	 */
+	ParallelGroups groups;
+
+	/**
+	 * \brief The threads (NULL for a sequential separation)
+	 */
+	ThreadPool* pool;
 };
 
 /* ============================================================================
@@ -11,12 +11,37 @@
 #include "ibex_Paver.h"
 #include "ibex_Timer.h"
 
+#include <sstream>
+
 using namespace std;
 
 namespace ibex {
 
+namespace {
+
+/*
+ * Index of the last trace of each contractor in the subpaving,
+ * recorded for the cell or one of its ancestors (compact mode).
+ * The "before" box of a new trace is encoded against this one.
+ */
+class LastTraces : public Backtrackable {
+public:
+	LastTraces() { }
+
+	LastTraces(const std::vector<int>& last) : last(last) { }
+
+	std::pair<Backtrackable*,Backtrackable*> down() {
+		return std::pair<Backtrackable*,Backtrackable*>(new LastTraces(last),new LastTraces(last));
+	}
+
+	std::vector<int> last;
+};
+
+}
+
 Paver::Paver(const Array<Ctc>& c, Bsc& b, CellBuffer& buffer) :
-		capacity(-1), timeout(3600), ctc_loop(true), trace(false), ctc(c), bsc(b), buffer(buffer) {
+		capacity(-1), timeout(3600), ctc_loop(true), trace(false),
+		compact_paving(false), paving_file(NULL), ctc(c), bsc(b), buffer(buffer) {
 
 	assert(ctc.size()>0);
 }
@@ -32,8 +57,15 @@ void Paver::contract(Cell& cell, SubPaving* paving) {
 	// In a future version, we may use an AC3 loop instead.
 	int fix_count=0;
 
-	// used to compare boxes before and after contraction
-	IntervalVector tmpbox(cell.box.size());
+	// box before the current contraction, used to compare boxes before
+	// and after contraction. Only the coordinates modified by a contractor
+	// are updated afterwards (the box is not copied for each contractor).
+	IntervalVector tmpbox(cell.box);
+
+	int nb_var=tmpbox.size();
+
+	// last trace of each contractor (compact mode)
+	vector<int>* last = paving[0].is_compact() ? &cell.get<LastTraces>().last : NULL;
 
 	while (fix_count<n && i<ctc.size()) {
 
@@ -44,20 +76,24 @@ void Paver::contract(Cell& cell, SubPaving* paving) {
 		// 	    cout << "box[" << j << "]=" << box[j] << endl;
 		// 	  }
 		if (trace)  cout << "    ctc " << i;
-		tmpbox=cell.box;
 
 		ctc[i].contract(cell.box);
 
 		if (cell.box.is_empty()) {
 			if (trace) cout << " -> empty set" << endl;
-			paving[i].add(tmpbox);
+			paving[i].add(tmpbox, last? (*last)[i] : -1);
 			return;
 		}
 
 		if (tmpbox.rel_distance(cell.box)>0) {
 			fix_count=0;
 
-			paving[i].add(tmpbox,cell.box);
+			if (last) {
+				int parent=(*last)[i];
+				(*last)[i]=paving[i].size();
+				paving[i].add(tmpbox,cell.box,parent);
+			} else
+				paving[i].add(tmpbox,cell.box);
 
 			if (trace) cout << " -> contracts" << endl;
 
@@ -66,6 +102,9 @@ void Paver::contract(Cell& cell, SubPaving* paving) {
 			if (trace) cout << " -> nothing" << endl;
 		}
 
+		for (int j=0; j<nb_var; j++)
+			if (tmpbox[j]!=cell.box[j]) tmpbox[j]=cell.box[j];
+
 		i = ctc_loop? (i+1)%ctc.size() : i+1;
 
 	}
@@ -87,6 +126,17 @@ SubPaving* Paver::pave(const IntervalVector& init_box) {
 	timer.start();
 	SubPaving* paving=new SubPaving[ctc.size()];
 
+	if (compact_paving || paving_file) {
+		for (int i=0; i<ctc.size(); i++) {
+			paving[i].set_compact(init_box.size());
+			if (paving_file) {
+				stringstream s;
+				s << paving_file << "." << i;
+				paving[i].stream(s.str().c_str());
+			}
+		}
+	}
+
 	buffer.flush();
 
 	Cell* root=new Cell(init_box);
@@ -98,6 +148,11 @@ SubPaving* Paver::pave(const IntervalVector& init_box) {
 	// add data required by the bisector
 	bsc.add_backtrackable(*root);
 
+	if (compact_paving || paving_file) {
+		root->add<LastTraces>();
+		root->get<LastTraces>().last.assign(ctc.size(),-1);
+	}
+
 	buffer.push(root);
 
 	while (!buffer.empty()) {
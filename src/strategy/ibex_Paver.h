@@ -91,6 +91,26 @@ public:
 	 */
 	bool trace;
 
+	/**
+	 * \brief Compact paving flag.
+	 *
+	 * If set, the subpavings returned by #pave() store their traces in compact
+	 * form, i.e., only the coordinates that have changed are recorded
+	 * (see #ibex::SubPaving::set_compact()). Default value is \c false.
+	 */
+	bool compact_paving;
+
+	/**
+	 * \brief Paving file prefix.
+	 *
+	 * If not NULL, the traces of the ith contractor are streamed into
+	 * the file "<paving_file>.<i>" instead of being kept in memory
+	 * (implies #compact_paving). The files can be loaded back with
+	 * #ibex::SubPaving::SubPaving(const char*) once the subpavings
+	 * have been deleted. Default value is \c NULL.
+	 */
+	const char* paving_file;
+
 	/** Contractors. */
 	Array<Ctc> ctc;
 
@@ -0,0 +1,213 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SubPaving.cpp
+// Author      : Gilles Chabert
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "ibex_SubPaving.h"
+
+using namespace std;
+
+namespace ibex {
+
+const int SubPaving::DEFAULT_KEYFRAME = 64;
+
+std::ostream& operator<<(std::ostream& os, const SubPavingException& e) {
+	return os << "SubPaving: " << e.message();
+}
+
+SubPaving::SubPaving() : keyframe(DEFAULT_KEYFRAME), n(-1), nb_traces(0), os(NULL) {
+
+}
+
+SubPaving::SubPaving(const char* filename) : keyframe(DEFAULT_KEYFRAME), n(-1), nb_traces(0), os(NULL) {
+
+	ifstream is;
+	is.open(filename, ios::in | ios::binary);
+	if (is.fail())
+		throw SubPavingException("cannot open file");
+
+	int _n, _keyframe;
+	is.read((char*) &_n, sizeof(int));
+	is.read((char*) &_keyframe, sizeof(int));
+	if (is.fail() || _n<=0 || _keyframe<=0)
+		throw SubPavingException("file format does not match the required file format");
+	set_compact(_n,_keyframe);
+
+	int parent, nb, idx;
+	double lb, ub;
+
+	while (is.read((char*) &parent, sizeof(int))) {
+		is.read((char*) &nb, sizeof(int));
+		if (is.fail() || parent<-1 || parent>=nb_traces || nb<0 || nb>n || (parent==-1 && nb!=n))
+			throw SubPavingException("file format does not match the required file format");
+		Record r;
+		r.start = delta_idx.size();
+		r.parent = parent;
+		r.nb_before = nb;
+		for (int k=0; k<2; k++) {
+			for (int j=0; j<nb; j++) {
+				is.read((char*) &idx, sizeof(int));
+				is.read((char*) &lb, sizeof(double));
+				is.read((char*) &ub, sizeof(double));
+				if (idx<0 || idx>=n)
+					throw SubPavingException("file format does not match the required file format");
+				delta_idx.push_back(idx);
+				delta_val.push_back(Interval(lb,ub));
+			}
+			if (k==0) {
+				is.read((char*) &nb, sizeof(int));
+				if (nb<-1 || nb>n)
+					throw SubPavingException("file format does not match the required file format");
+				r.nb_after = nb; // -1 (empty box) means no coordinate to read
+			}
+		}
+		if (is.fail())
+			throw SubPavingException("unexpected end of file");
+		records.push_back(r);
+		nb_traces++;
+	}
+	is.close();
+}
+
+SubPaving::~SubPaving() {
+	if (os) {
+		os->close();
+		delete os;
+	}
+}
+
+void SubPaving::set_compact(int n, int keyframe) {
+	assert(size()==0);
+	assert(n>0 && keyframe>0);
+	this->n = n;
+	this->keyframe = keyframe;
+}
+
+void SubPaving::stream(const char* filename) {
+	assert(is_compact() && size()==0);
+	os = new ofstream();
+	os->open(filename, ios::out | ios::trunc | ios::binary);
+	os->write((char*) &n, sizeof(int));
+	os->write((char*) &keyframe, sizeof(int));
+	if (os->fail()) {
+		delete os;
+		os = NULL;
+		throw SubPavingException("cannot open file for writing");
+	}
+}
+
+int SubPaving::push_delta(const IntervalVector& x, const IntervalVector& ref, bool full) {
+	int nb=0;
+	for (int j=0; j<n; j++) {
+		if (full || x[j].lb()!=ref[j].lb() || x[j].ub()!=ref[j].ub()) {
+			delta_idx.push_back(j);
+			delta_val.push_back(x[j]);
+			nb++;
+		}
+	}
+	return nb;
+}
+
+void SubPaving::add_compact(const IntervalVector& before, const IntervalVector* after, int parent) {
+	assert(before.size()==n);
+	assert(parent>=-1 && parent<nb_traces);
+
+	Record r;
+	r.start = delta_idx.size();
+
+	// look for the parent in the path
+	int k=path.size()-1;
+	while (k>=0 && path[k].trace>parent) k--;
+
+	// If the parent is not in the path (e.g., the first trace of a
+	// contractor in a branch), the last trace added is taken instead.
+	if (k<0 || path[k].trace!=parent) k=path.size()-1;
+
+	int depth;
+	if (k>=0 && path[k].depth<keyframe) {
+		r.parent = path[k].trace;
+		r.nb_before = push_delta(before, path[k].box, false);
+		depth = path[k].depth+1;
+	} else {
+		r.parent = -1;
+		r.nb_before = push_delta(before, before, true);
+		depth = 0;
+	}
+	r.nb_after  = after? push_delta(*after, before, false) : -1;
+
+	// The path only contains the ancestors of the last trace. Traces
+	// that are not ancestors of the new one can be forgotten.
+	while (!path.empty() && path.back().trace>parent)
+		path.pop_back();
+
+	PathNode node = { nb_traces, depth, after? *after : before };
+	path.push_back(node);
+	nb_traces++;
+
+	if (os) {
+		// flush the deltas into the file
+		os->write((char*) &r.parent, sizeof(int));
+		int nb=r.nb_before;
+		size_t i=r.start;
+		for (int k=0; k<2; k++) {
+			os->write((char*) &nb, sizeof(int));
+			for (int j=0; j<nb; j++, i++) {
+				double lb=delta_val[i].lb();
+				double ub=delta_val[i].ub();
+				os->write((char*) &delta_idx[i], sizeof(int));
+				os->write((char*) &lb, sizeof(double));
+				os->write((char*) &ub, sizeof(double));
+			}
+			nb=r.nb_after;
+		}
+		delta_idx.clear();
+		delta_val.clear();
+		if (os->fail())
+			throw SubPavingException("cannot write trace");
+	} else {
+		records.push_back(r);
+	}
+}
+
+void SubPaving::apply_delta(IntervalVector& x, size_t start, int nb) const {
+	for (int j=0; j<nb; j++)
+		x[delta_idx[start+j]] = delta_val[start+j];
+}
+
+pair<IntervalVector,IntervalVector> SubPaving::trace(int i) const {
+	assert(i>=0 && i<size());
+
+	if (!is_compact()) return traces[i];
+
+	assert(!os);
+
+	IntervalVector before(n);
+
+	// replay the deltas from the last full box
+	vector<int> chain;
+	for (int k=i; k!=-1; k=records[k].parent)
+		chain.push_back(k);
+	for (int k=chain.size()-1; k>=0; k--) {
+		const Record& r=records[chain[k]];
+		apply_delta(before, r.start, r.nb_before);
+		// the reference of the next trace is the "after" box
+		if (k>0 && r.nb_after!=-1)
+			apply_delta(before, r.start+r.nb_before, r.nb_after);
+	}
+
+	const Record& r=records[i];
+
+	if (r.nb_after==-1)
+		return pair<IntervalVector,IntervalVector>(before, IntervalVector::empty(n));
+
+	IntervalVector after(before);
+	apply_delta(after, r.start+r.nb_before, r.nb_after);
+	return pair<IntervalVector,IntervalVector>(before,after);
+}
+
+} // end namespace ibex
@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : May 12, 2012
-// Last Update : May 12, 2012
+// Last Update : Oct 18, 2026
 //============================================================================
 
 #ifndef __IBEX_SUBPAVING_H__
@@ -13,50 +13,259 @@
 
 #include <utility>
 #include <vector>
+#include <fstream>
 
 #include "ibex_IntervalVector.h"
+#include "ibex_Exception.h"
 
 namespace ibex {
 
+/** \ingroup strategy
+ *
+ * \brief Thrown when a subpaving file cannot be read or written.
+ */
+class SubPavingException : public Exception {
+public:
+
+	SubPavingException(std::string message1) : msg(message1) { }
+
+	/**
+	 * \brief Get the message of this exception
+	 */
+	const std::string& message() const { return msg; }
+
+private:
+	std::string msg;
+};
+
+std::ostream& operator<<(std::ostream& os, const SubPavingException& e);
+
 /** \ingroup strategy
  *
  * \brief Subpaving
+ *
+ * By default, each trace is stored as a pair of full boxes
+ * (see #traces). In compact mode (see #set_compact()), a trace
+ * only records the coordinates that differ from the box it is derived from:
+ * <ul>
+ * <li> the "before" box is encoded against the "after" box of its parent trace,
+ *      i.e., the trace of the same contractor on the closest ancestor cell
+ *      (see #add(const IntervalVector&, const IntervalVector&, int)).
+ *      Both boxes only differ by the bisections and the contractions performed in-between.
+ * <li> the "after" box is encoded against the "before" box.
+ * </ul>
+ * If the parent trace is not an ancestor of the last trace added (this does not
+ * happen with a depth-first search) or if there is no parent trace (e.g., the first
+ * trace of a contractor in a branch), the "before" box is encoded against the
+ * "after" box of the last trace added.
+ *
+ * A full box is stored when the chain of deltas from the last full box gets
+ * longer than #keyframe, so that any trace can be reconstructed on demand
+ * (see #trace()) by replaying at most #keyframe deltas.
+ *
+ * In compact mode, traces can also be streamed into a file (see #stream())
+ * instead of being kept in memory. The file can be loaded back
+ * with #SubPaving(const char*).
  */
 class SubPaving {
 public:
+
+	/**
+	 * \brief Default maximal number of deltas between a trace and the last full box.
+	 */
+	static const int DEFAULT_KEYFRAME;
+
+	/**
+	 * \brief Create an empty subpaving (with full traces).
+	 */
+	SubPaving();
+
+	/**
+	 * \brief Load a subpaving streamed into a file.
+	 *
+	 * The subpaving is in compact mode.
+	 *
+	 * \throw SubPavingException if the file cannot be read or is corrupted.
+	 * \see #stream(const char*).
+	 */
+	SubPaving(const char* filename);
+
+	/**
+	 * \brief Delete *this (and close the stream, if any).
+	 */
+	~SubPaving();
+
+	/**
+	 * \brief Switch to compact mode.
+	 *
+	 * \param n        - size of the boxes
+	 * \param keyframe - maximal number of deltas between a trace and the last full box.
+	 * \pre The subpaving must be empty.
+	 */
+	void set_compact(int n, int keyframe=DEFAULT_KEYFRAME);
+
+	/**
+	 * \brief Stream the traces into a file (binary format).
+	 *
+	 * Traces are written in compact form into the file as soon as they
+	 * are added and are no longer kept in memory.
+	 *
+	 * \pre *this must be in compact mode and empty.
+	 * \throw SubPavingException if the file cannot be opened. The same
+	 *        exception is thrown by #add() if a trace cannot be written.
+	 */
+	void stream(const char* filename);
+
 	/**
 	 * \brief Add the trace of a contraction into *this.
+	 *
+	 * In compact mode, the parent of the trace is the last trace added.
 	 */
 	void add(const IntervalVector& before, const IntervalVector& after);
 
+	/**
+	 * \brief Add the trace of a contraction into *this.
+	 *
+	 * \param parent - index of the parent trace (the "before" box is encoded against
+	 *                 the "after" box of this trace in compact mode), or -1 if none
+	 *                 (the last trace added is then taken as reference).
+	 *                 Ignored in default mode.
+	 */
+	void add(const IntervalVector& before, const IntervalVector& after, int parent);
+
 	/**
 	 * \brief Add a box to *this.
 	 */
 	void add(const IntervalVector& box);
 
+	/**
+	 * \brief Add a box to *this.
+	 *
+	 * \param parent - see #add(const IntervalVector&, const IntervalVector&, int).
+	 */
+	void add(const IntervalVector& box, int parent);
+
 	/**
 	 * \brief Return the size (number of elements, either boxes or traces)
 	 */
 	int size() const;
 
+	/**
+	 * \brief True if the traces are stored in compact form.
+	 */
+	bool is_compact() const;
+
+	/**
+	 * \brief Return the ith trace (full boxes).
+	 *
+	 * In compact mode, the boxes are reconstructed.
+	 *
+	 * \pre the traces must not be streamed.
+	 */
+	std::pair<IntervalVector,IntervalVector> trace(int i) const;
+
 	/**
 	 * \brief All the traces
+	 *
+	 * Only used in default mode. In compact mode, see #trace(int).
 	 */
 	std::vector<std::pair<IntervalVector,IntervalVector> > traces;
+
+	/**
+	 * \brief Maximal number of deltas between a trace and the last full box (compact mode).
+	 */
+	int keyframe;
+
+private:
+	SubPaving(const SubPaving&); // forbidden
+	SubPaving& operator=(const SubPaving&); // forbidden
+
+	/*
+	 * Compact record of a trace. The coordinates of the
+	 * "before" delta (resp. "after" delta) are the "nb_before"
+	 * (resp. "nb_after") entries of delta_idx/delta_val
+	 * starting from "start" (resp. start+nb_before).
+	 */
+	struct Record {
+		size_t start;
+		int parent;        // -1 means "full box"
+		int nb_before;
+		int nb_after;      // -1 means "empty box"
+	};
+
+	/*
+	 * Encode the delta between x and ref in the buffers
+	 * (or write it in the stream). Return the number of
+	 * coordinates stored.
+	 */
+	int push_delta(const IntervalVector& x, const IntervalVector& ref, bool full);
+
+	void add_compact(const IntervalVector& before, const IntervalVector* after, int parent);
+
+	/* apply the nb deltas of delta_idx/delta_val starting from "start" to x */
+	void apply_delta(IntervalVector& x, size_t start, int nb) const;
+
+	/* size of boxes (compact mode); -1 in default mode */
+	int n;
+
+	/* number of traces (compact mode) */
+	int nb_traces;
+
+	std::vector<Record> records;
+	std::vector<int> delta_idx;
+	std::vector<Interval> delta_val;
+
+	/*
+	 * "after" boxes (or "before" boxes, for empty boxes) of the last trace
+	 * added and its ancestors (compact mode), with the length of their
+	 * chain of deltas.
+	 */
+	struct PathNode {
+		int trace;
+		int depth;
+		IntervalVector box;
+	};
+	std::vector<PathNode> path;
+
+	std::ofstream* os;
 };
 
 /*============================================ inline implementation ============================================ */
 
 inline void SubPaving::add(const IntervalVector& before, const IntervalVector& after) {
-	traces.push_back(std::pair<IntervalVector,IntervalVector>(before,after));
+	if (n==-1)
+		traces.push_back(std::pair<IntervalVector,IntervalVector>(before,after));
+	else
+		add_compact(before,&after,nb_traces-1);
+}
+
+inline void SubPaving::add(const IntervalVector& before, const IntervalVector& after, int parent) {
+	if (n==-1)
+		traces.push_back(std::pair<IntervalVector,IntervalVector>(before,after));
+	else
+		add_compact(before,&after,parent);
 }
 
 inline void SubPaving::add(const IntervalVector& box) {
-	traces.push_back(std::pair<IntervalVector,IntervalVector>(box,IntervalVector::empty(box.size())));
+	if (n==-1)
+		traces.push_back(std::pair<IntervalVector,IntervalVector>(box,IntervalVector::empty(box.size())));
+	else
+		add_compact(box,NULL,nb_traces-1);
+}
+
+inline void SubPaving::add(const IntervalVector& box, int parent) {
+	if (n==-1)
+		traces.push_back(std::pair<IntervalVector,IntervalVector>(box,IntervalVector::empty(box.size())));
+	else
+		add_compact(box,NULL,parent);
 }
 
 inline int SubPaving::size() const {
-	return traces.size();
+	return n==-1? traces.size() : nb_traces;
+}
+
+inline bool SubPaving::is_compact() const {
+	return n!=-1;
 }
 
 } // end namespace ibex
@@ -22,6 +22,25 @@
 #include <stdio.h>
 #include <set>
 #include <atomic>
+#include <mutex>
+
+#ifdef __GNUC__
+#include <ciso646> // just to initialize _LIBCPP_VERSION
+#ifdef _LIBCPP_VERSION
+#include <unordered_map>
+#define IBEX_INTERVAL_TABLE std::unordered_map<std::pair<unsigned long long,unsigned long long>,InternedInterval,IntervalBitsHash>
+#else
+#include <tr1/unordered_map>
+#define IBEX_INTERVAL_TABLE std::tr1::unordered_map<std::pair<unsigned long long,unsigned long long>,InternedInterval,IntervalBitsHash>
+#endif
+#else
+#include <unordered_map>
+#if (_MSC_VER >= 1600)
+#define IBEX_INTERVAL_TABLE std::unordered_map<std::pair<unsigned long long,unsigned long long>,InternedInterval,IntervalBitsHash>
+#else
+#define IBEX_INTERVAL_TABLE std::tr1::unordered_map<std::pair<unsigned long long,unsigned long long>,InternedInterval,IntervalBitsHash>
+#endif // (_MSC_VER >= 1600)
+#endif
 
 using namespace std;
 
@@ -31,6 +50,131 @@ namespace {
 
 atomic_long id_count(0);
 
+/*
+ * Memory pool of expression nodes.
+ *
+ * Nodes are carved out of large blocks, by multiples of
+ * 8 bytes (the alignment of all the node classes), and a
+ * released node is recycled for a node of the same size.
+ * The blocks are never given back to the system: a node
+ * can be deleted at any time (including during static
+ * destruction) and the pool itself is never destroyed.
+ */
+class NodePool {
+public:
+	NodePool() : cur(NULL), left(0) {
+		for (int c=0; c<NB_CLASSES; c++) free_list[c]=NULL;
+	}
+
+	void* allocate(size_t size) {
+		size_t c=(size+GRAIN-1)/GRAIN;
+		if (c>=NB_CLASSES) return ::operator new(size);
+
+		lock_guard<mutex> lock(mtx);
+
+		void* p=free_list[c];
+		if (p) {
+			free_list[c]=*((void**) p);
+			return p;
+		}
+
+		size=c*GRAIN;
+		if (left<size) { // the end of the current block is lost
+			cur=(char*) ::operator new(BLOCK_SIZE);
+			left=BLOCK_SIZE;
+		}
+		p=cur;
+		cur+=size;
+		left-=size;
+		return p;
+	}
+
+	void release(void* p, size_t size) {
+		size_t c=(size+GRAIN-1)/GRAIN;
+		if (c>=NB_CLASSES) { ::operator delete(p); return; }
+
+		lock_guard<mutex> lock(mtx);
+		*((void**) p)=free_list[c];
+		free_list[c]=p;
+	}
+
+private:
+	static const size_t GRAIN=8;
+	static const int NB_CLASSES=33; // up to 256 bytes
+	static const size_t BLOCK_SIZE=1<<16;
+
+	void* free_list[NB_CLASSES];
+	char* cur;
+	size_t left;
+	mutex mtx;
+};
+
+NodePool& node_pool() {
+	static NodePool* pool=new NodePool(); // never deleted (see above)
+	return *pool;
+}
+
+/*
+ * Table of interned scalar constants.
+ *
+ * Intervals are identified by the bits of their bounds.
+ * Each entry counts the constants that refer to it.
+ */
+struct InternedInterval {
+	Interval itv;
+	long count;
+};
+
+struct IntervalBitsHash {
+	size_t operator()(const pair<unsigned long long,unsigned long long>& k) const {
+		return (size_t) (k.first*0x9e3779b97f4a7c15ULL ^ k.second);
+	}
+};
+
+pair<unsigned long long,unsigned long long> interval_bits(const Interval& x) {
+	pair<unsigned long long,unsigned long long> k;
+	double lb=x.lb();
+	double ub=x.ub();
+	memcpy(&k.first, &lb, sizeof(double));
+	memcpy(&k.second, &ub, sizeof(double));
+	return k;
+}
+
+class IntervalTable {
+public:
+	Interval& intern(const Interval& x) {
+		lock_guard<mutex> lock(mtx);
+		pair<unsigned long long,unsigned long long> k=interval_bits(x);
+		IBEX_INTERVAL_TABLE::iterator it=table.find(k);
+		if (it==table.end()) {
+			InternedInterval e;
+			e.itv=x;
+			e.count=0;
+			it=table.insert(make_pair(k,e)).first;
+		}
+		it->second.count++;
+		return it->second.itv;
+	}
+
+	// return false if x is not interned
+	bool release(const Interval& x) {
+		lock_guard<mutex> lock(mtx);
+		IBEX_INTERVAL_TABLE::iterator it=table.find(interval_bits(x));
+		if (it==table.end() || &it->second.itv!=&x) return false;
+		if (--it->second.count==0) table.erase(it);
+		return true;
+	}
+
+private:
+	IBEX_INTERVAL_TABLE table;
+	mutex mtx;
+};
+
+IntervalTable& interned_intervals() {
+	static IntervalTable* table=new IntervalTable(); // never deleted (same reason as the node pool)
+	return *table;
+}
+
 int max_height(const ExprNode& n1, const ExprNode& n2) {
 	if (n1.height>n2.height) return n1.height;
 	else return n2.height;
@@ -72,8 +216,29 @@ Array<const Dim> dims(const Array<const ExprNode>& comp) {
 } // end anonymous namespace
 
 ExprNode::ExprNode(int height, int size, const Dim& dim) :
-  height(height), size(size), id(id_count++), dim(dim), f(NULL) {
+  height(height), _size(size), id(id_count++), dim(dim), f(NULL) {
+
+}
+
+int ExprNode::size() const {
+	if (_size==-1) _size=ExprSize(*this).size;
+	return _size;
+}
 
+void* ExprNode::operator new(size_t size) {
+#ifdef __SANITIZE_ADDRESS__
+	return ::operator new(size); // keep invalid accesses to nodes detectable
+#else
+	return node_pool().allocate(size);
+#endif
+}
+
+void ExprNode::operator delete(void* p, size_t size) {
+#ifdef __SANITIZE_ADDRESS__
+	::operator delete(p);
+#else
+	node_pool().release(p, size);
+#endif
 }
 
 bool ExprNode::operator==(const ExprNode& e) const {
@@ -98,7 +263,7 @@ void cleanup(const Array<const ExprNode>& expr, bool delete_symbols) {
 }
 
 ExprIndex::ExprIndex(const ExprNode& subexpr, const DoubleIndex& index)
-: ExprNode(subexpr.height+1, subexpr.size+1, subexpr.dim.index_dim(index)), expr(subexpr), index(index) {
+: ExprNode(subexpr.height+1, -1, subexpr.dim.index_dim(index)), expr(subexpr), index(index) {
 	((ExprNode&) (subexpr)).fathers.add(*this);
 }
 
@@ -173,7 +338,7 @@ pair<const ExprSymbol*, bool**> ExprIndex::symbol_mask() const {
 }
 
 ExprNAryOp::ExprNAryOp(const Array<const ExprNode>& _args, const Dim& dim) :
-		ExprNode(max_height(_args)+1, nary_size(_args), dim),
+		ExprNode(max_height(_args)+1, -1, dim),
 		args(_args), nb_args(_args.size()) {
 
 	for (int i=0; i<nb_args; i++) {
@@ -298,9 +463,13 @@ Variable::operator const ExprNode&() const {
 
 ExprConstant::ExprConstant(const Interval& x)
   : ExprLeaf(Dim()),
-    value(Dim()) {
+    value(interned_intervals().intern(x)) {
+
+}
 
-	value.i() = x;
+ExprConstant::~ExprConstant() {
+	if (dim.is_scalar() && value.is_reference)
+		interned_intervals().release(value.i()); // does nothing if built by reference
 }
 
 Interval::operator const ExprConstant&() const {
@@ -346,9 +515,7 @@ const ExprConstant& ExprConstant::copy() const {
 }
 
 ExprBinaryOp::ExprBinaryOp(const ExprNode& left, const ExprNode& right, const Dim& dim) :
-		ExprNode(	max_height(left,right)+1,
-					bin_size(left,right),
-					dim ),
+		ExprNode(max_height(left,right)+1, -1, dim),
 		left(left), right(right) {
 
 	((ExprNode&) left).fathers.add(*this);
@@ -396,7 +563,7 @@ ExprPower::ExprPower(const ExprNode& expr, int expon) : ExprUnaryOp(expr,expr.di
 }
 
 ExprUnaryOp::ExprUnaryOp(const ExprNode& subexpr, const Dim& dim) :
-				ExprNode(subexpr.height+1, subexpr.size+1, dim), expr(subexpr) {
+				ExprNode(subexpr.height+1, -1, dim), expr(subexpr) {
 	((ExprNode&) expr).fathers.add(*this);
 }
 
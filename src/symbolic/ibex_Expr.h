@@ -50,7 +50,9 @@ class ExprNode {
 
 public:
 	/** Builds a node of a given height, size and dimension.
-	 * \see #height, #size, #dim. */
+	 *
+	 * The size can be -1 (not calculated yet, see #size()).
+	 * \see #height, #size(), #dim. */
 	ExprNode(int height, int size, const Dim& dim);
 
 	/** Accept an #ibex::ExprVisitor visitor. */
@@ -65,6 +67,26 @@ public:
 	 */
 	virtual ~ExprNode();
 
+	/**
+	 * \brief Allocate a node.
+	 *
+	 * Nodes are small objects created in large numbers: they are
+	 * allocated in blocks and recycled by size (no per-node
+	 * allocation header).
+	 *
+	 * This only saves the header of the system allocator (around
+	 * 10% of the memory of a typical DAG): the fields of the nodes
+	 * are unchanged. Besides, the memory of deleted nodes is kept
+	 * for new nodes but never given back to the system, and all the
+	 * threads share the same pool (allocations are serialized).
+	 */
+	static void* operator new(size_t size);
+
+	/**
+	 * \brief Release the memory of a node.
+	 */
+	static void operator delete(void* p, size_t size);
+
 	/** Streams out this expression. */
 	friend std::ostream& operator<<(std::ostream&, const ExprNode&);
 
@@ -84,9 +106,18 @@ public:
 	 *  A leaf is at height 0. */
 	const int height;
 
+private:
+	/** Size of the DAG, -1 if not calculated yet (see #size()). */
+	mutable int _size;
+
+public:
 	/** Number of subnodes (including itself) in the DAG (not in the TREE:
-	 * two subnodes referencing the same object count for 1).*/
-	const int size;
+	 * two subnodes referencing the same object count for 1).
+	 *
+	 * The size requires a traversal of the DAG: it is only calculated
+	 * at the first call (and then stored) instead of at the creation
+	 * of each node. */
+	int size() const;
 
 	/** Unique number identifying this expression node
 	 *
@@ -646,9 +677,15 @@ public:
 	 */
 	const ExprConstant& copy() const;
 
+	/** Delete this. */
+	~ExprConstant();
+
 private:
 	friend class Visitor;
 
+	/* The value of a scalar constant (not built by reference)
+	 * is interned: all the scalar constants with the same value
+	 * share the same interval. */
 	ExprConstant(const Interval& value);
 
 	ExprConstant(const IntervalVector& value, bool in_row);
@@ -1494,7 +1531,10 @@ inline const ExprConstant& ExprConstant::new_matrix(const IntervalMatrix& value)
 }
 
 inline const ExprConstant& ExprConstant::new_(const Domain& value, bool reference) {
-	return *new ExprConstant(value,reference);
+	if (!reference && value.dim.is_scalar())
+		return new_scalar(value.i());
+	else
+		return *new ExprConstant(value,reference);
 }
 
 inline const Interval& ExprConstant::get_value() const {
@@ -24,62 +24,26 @@ const ExprNode& Expr2DAG::transform(const Array<const ExprSymbol>& old_x, const
 		peer.insert(old_x[i], &new_x[i]);
 	}
 
-	int i=nodes.size()-1;
-	int h=0; // height in the DAG
-
-	// then we copy the constants
-	while (i>=0 && nodes[i].height==h) {
-		const ExprConstant* c=dynamic_cast<const ExprConstant*>(&nodes[i]);
-		if (c) peer.insert(nodes[i], (const ExprNode*) &c->copy());
-		i--;
-	}
-
-	if (i==-1)
-		return *peer[nodes[0]];
-
-	// we proceed by "level", where a level corresponds
-	// to a height "h" in the expression.
-	// - i is the index of to the first node in the level
-	// - i2 is the index of the current node in the level
-
-	while (i>0) {
-		int h=nodes[i].height;
-
-		// we first temporarily build all the peer nodes
-		// from the new nodes of the sub-level
-		int i2=i;
-		//cout << "---- level h=" << h << "----" << endl;
-		//cout << "---- copy ----" << endl;
-		while (nodes[i2].height==h) {
-			//cout << "i2=" << i2 << " : " << nodes[i2] << endl;
-			assert(!peer.found(nodes[i2]));
-			visit(nodes[i2]);
-			i2--;
+	// We proceed bottom-up (arguments first). The peer node of each
+	// node is looked for in the hash-consing table before being built.
+	// Since the arguments of the peer node are already unique, the
+	// search only compares the operators and the argument addresses.
+	for (int i=nodes.size()-1; i>=0; i--) {
+		if (peer.found(nodes[i])) continue; // symbol
+
+		const ExprNode* e2=table.find(nodes[i], &peer);
+		if (e2)
+			peer.insert(nodes[i], e2);
+		else {
+			const ExprConstant* c=dynamic_cast<const ExprConstant*>(&nodes[i]);
+			if (c)
+				peer.insert(nodes[i], (const ExprNode*) &c->copy());
+			else
+				visit(nodes[i]);
+			table.insert(*peer[nodes[i]]);
 		}
-		//cout << "---- merge ----" << endl;
-		// then we look for equivalent nodes (at the same level)
-		i2=i;
-		while (nodes[i2].height==h) {
-			//cout << "i2=" << i2 << " : " << nodes[i2];
-			// find the same node among the nodes already visited
-			for (int i3=i; i3>i2; i3--) {
-				// then replace the peer node.
-				if (*peer[nodes[i3]]==*peer[nodes[i2]]) {
-					//cout << "... merge!";
-					peer[nodes[i2]]=peer[nodes[i3]];
-					break;
-				}
-			}
-			//cout << endl;
-			i2--;
-		}
-		//cout << "-------------" << endl;
-
-		i=i2; // jump to the next level
 	}
 
-	assert(i==0);
-	visit(nodes[0]);
 	return *peer[nodes[0]];
 }
 
@@ -103,7 +67,7 @@ void Expr2DAG::visit_unary(const T& e) {
 }
 
 void Expr2DAG::visit(const ExprNode& e) { e.acceptVisitor(*this); }
-void Expr2DAG::visit(const ExprIndex& i) { /* TODO: nothing here?? */ }
+void Expr2DAG::visit(const ExprIndex& i) { peer.insert(i,&ExprIndex::new_(*peer[i.expr],i.index)); }
 
 void Expr2DAG::visit(const ExprNAryOp& e)   { e.acceptVisitor(*this); } // (useless so far)
 void Expr2DAG::visit(const ExprLeaf& e)     { e.acceptVisitor(*this); } // (useless so far)
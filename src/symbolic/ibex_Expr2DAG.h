@@ -12,6 +12,7 @@
 
 #include "ibex_ExprVisitor.h"
 #include "ibex_NodeMap.h"
+#include "ibex_ExprHashCons.h"
 
 namespace ibex {
 
@@ -23,6 +24,8 @@ namespace ibex {
  *
  * The expression can be a tree or, partially, a DAG.
  *
+ * Equivalent nodes are merged through hash-consing (see #ExprHashCons),
+ * so that the transformation is linear in the number of nodes.
  */
 class Expr2DAG : public virtual ExprVisitor {
 public:
@@ -74,6 +77,8 @@ protected:
 
 	NodeMap<const ExprNode*> peer;
 
+	ExprHashCons table;
+
 	Array<const ExprNode> comps(const ExprNAryOp& e);
 
 	template<class T>
@@ -27,7 +27,7 @@ void ExprCmp::visit(const ExprNode& e) {
 
 void ExprCmp::visit(const ExprIndex& e) {
 	const ExprIndex* e3=dynamic_cast<const ExprIndex*>(e2);
-	are_equal &= e3!=NULL && e.index!=e3->index && ExprCmp().compare(e.expr,e3->expr);
+	are_equal &= e3!=NULL && e.index==e3->index && ExprCmp().compare(e.expr,e3->expr);
 }
 
 void ExprCmp::visit(const ExprNAryOp& e)   { e.acceptVisitor(*this); } // (useless so far)
@@ -69,6 +69,23 @@ const ExprNode& ExprCopy::copy(const Array<const ExprSymbol>& old_x, const Array
 	return *clone[y];
 }
 
+void ExprCopy::copy(const Array<const ExprSymbol>& old_x, const Array<const ExprSymbol>& new_x, const Array<const ExprNode>& y, Array<const ExprNode>& y2) {
+
+	clone.clean();
+
+	assert(new_x.size()>=old_x.size());
+	assert(y2.size()==y.size());
+
+	for (int i=0; i<old_x.size(); i++) {
+		clone.insert(old_x[i],&new_x[i]);
+	}
+
+	for (int i=0; i<y.size(); i++) {
+		visit(y[i]);
+		y2.set_ref(i,*clone[y[i]]);
+	}
+}
+
 void ExprCopy::visit(const ExprNode& e) {
 	if (!clone.found(e)) {
 		e.acceptVisitor(*this);
@@ -71,6 +71,17 @@ public:
 	 */
 	const ExprNode& copy(const Array<const ExprSymbol>& old_x, const Array<const ExprSymbol>& new_x, const ExprNode& y);
 
+	/*
+	 * \brief Duplicate several expressions at once (with new symbols).
+	 *
+	 * The copy of y[i] is stored in y2[i]. A node shared by several
+	 * expressions of \a y is copied only once, so the copies share it as well.
+	 *
+	 * \pre \a y2 must have the same size as \a y.
+	 * \see copy(const Array<const ExprSymbol>& old_x, const Array<const ExprNode>& new_x, const ExprNode& y).
+	 */
+	void copy(const Array<const ExprSymbol>& old_x, const Array<const ExprSymbol>& new_x, const Array<const ExprNode>& y, Array<const ExprNode>& y2);
+
 protected:
 	void visit(const ExprNode& e);
 	void visit(const ExprIndex& i);
@@ -71,7 +71,7 @@ const ExprNode& ExprDiff::gradient(const Array<const ExprSymbol>& old_x, const A
 
 	ExprSubNodes nodes(y);
 	//cout << "y =" << y;
-	int n=y.size;
+	int n=y.size();
 	int nb_var=0;
 	for (int i=0; i<old_x.size(); i++) {
 		nb_var += old_x[i].dim.size();
@@ -0,0 +1,258 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ExprHashCons.cpp
+// Author      : Gilles Chabert
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex_ExprHashCons.h"
+#include "ibex_Expr.h"
+
+#include <cstring>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+inline unsigned long combine(unsigned long h, unsigned long v) {
+	return h ^ (v + 0x9e3779b9UL + (h<<6) + (h>>2));
+}
+
+unsigned long hash_double(double x) {
+	if (x==0) x=0; // -0 and +0 are equal
+	unsigned char bytes[sizeof(double)];
+	memcpy(bytes, &x, sizeof(double));
+	unsigned long h=0;
+	for (unsigned int i=0; i<sizeof(double); i++)
+		h=h*31+bytes[i];
+	return h;
+}
+
+unsigned long hash_itv(unsigned long h, const Interval& x) {
+	if (x.is_empty()) // all empty intervals are equal
+		return combine(h,1);
+	else
+		return combine(combine(h,hash_double(x.lb())),hash_double(x.ub()));
+}
+
+unsigned long hash_domain(const Domain& d) {
+	unsigned long h=combine(d.dim.nb_rows(),d.dim.nb_cols());
+	switch(d.dim.type()) {
+	case Dim::SCALAR:
+		return hash_itv(h,d.i());
+	case Dim::ROW_VECTOR:
+	case Dim::COL_VECTOR:
+		for (int i=0; i<d.v().size(); i++)
+			h=hash_itv(h,d.v()[i]);
+		return h;
+	default:
+		for (int i=0; i<d.m().nb_rows(); i++)
+			for (int j=0; j<d.m().nb_cols(); j++)
+				h=hash_itv(h,d.m()[i][j]);
+		return h;
+	}
+}
+
+/*
+ * Remove the last occurrence of "father" in the fathers of "child".
+ *
+ * (Note: Array::resize cannot be used directly for
+ * shrinking because it deletes the removed objects).
+ */
+void remove_father(const ExprNode& child, const ExprNode& father) {
+	Array<const ExprNode>& fathers=((ExprNode&) child).fathers;
+	int n=fathers.size();
+	int k=n-1;
+	while (k>=0 && &fathers[k]!=&father) k--;
+	assert(k>=0);
+
+	vector<const ExprNode*> others;
+	for (int i=0; i<n; i++)
+		if (i!=k) others.push_back(&fathers[i]);
+
+	fathers.clear();
+	fathers.resize(n-1);
+	for (int i=0; i<n-1; i++)
+		fathers.set_ref(i,*others[i]);
+}
+
+} // end anonymous namespace
+
+void ExprHashCons::Signature::clear(int _op) {
+	op=_op;
+	args.clear();
+	params.clear();
+	func=NULL;
+	cst=NULL;
+}
+
+bool ExprHashCons::Signature::operator==(const Signature& s) const {
+	return op==s.op && args==s.args && params==s.params && func==s.func &&
+			(cst==s.cst || (cst && s.cst && *cst==*s.cst));
+}
+
+unsigned long ExprHashCons::Signature::hash() const {
+	unsigned long h=op;
+	for (vector<const ExprNode*>::const_iterator it=args.begin(); it!=args.end(); it++)
+		h=combine(h,(unsigned long) (*it)->id);
+	for (vector<long>::const_iterator it=params.begin(); it!=params.end(); it++)
+		h=combine(h,(unsigned long) *it);
+	if (func) h=combine(h,(unsigned long) (size_t) func);
+	if (cst) h=combine(h,hash_domain(*cst));
+	return h;
+}
+
+ExprHashCons::ExprHashCons() : nb_nodes(0), sig(NULL), peer(NULL) {
+
+}
+
+void ExprHashCons::signature(const ExprNode& e, const NodeMap<const ExprNode*>* _peer, Signature& _sig) {
+	sig=&_sig;
+	peer=_peer;
+	visit(e);
+	sig=NULL;
+	peer=NULL;
+}
+
+unsigned long ExprHashCons::hash(const ExprNode& e, const NodeMap<const ExprNode*>* peer) {
+	signature(e,peer,sig1);
+	return sig1.hash();
+}
+
+const ExprNode* ExprHashCons::find(const ExprNode& e, const NodeMap<const ExprNode*>* peer) {
+	signature(e,peer,sig1);
+
+	IBEX_EXPR_BUCKETS::const_iterator b=buckets.find(sig1.hash());
+	if (b==buckets.end()) return NULL;
+
+	for (vector<const ExprNode*>::const_iterator it=b->second.begin(); it!=b->second.end(); it++) {
+		signature(**it,NULL,sig2);
+		if (sig2==sig1) return *it;
+	}
+	return NULL;
+}
+
+void ExprHashCons::insert(const ExprNode& e) {
+	buckets[hash(e)].push_back(&e);
+	nb_nodes++;
+}
+
+const ExprNode& ExprHashCons::get(const ExprNode& e) {
+	const ExprNode* e2=find(e);
+
+	if (!e2) {
+		insert(e);
+		return e;
+	} else if (e2==&e) {
+		return e;
+	} else {
+		assert(e.fathers.is_empty());
+		// detach e from its arguments before deleting it
+		// (sig1 contains the arguments of e)
+		for (vector<const ExprNode*>::const_iterator it=sig1.args.begin(); it!=sig1.args.end(); it++)
+			remove_father(**it,e);
+		delete &e;
+		return *e2;
+	}
+}
+
+void ExprHashCons::arg(const ExprNode& a) {
+	if (peer && peer->found(a))
+		sig->args.push_back((*peer)[a]);
+	else
+		sig->args.push_back(&a);
+}
+
+void ExprHashCons::nary(const ExprNAryOp& e, int op) {
+	sig->clear(op);
+	for (int i=0; i<e.nb_args; i++)
+		arg(e.arg(i));
+}
+
+void ExprHashCons::binary(const ExprBinaryOp& e, int op) {
+	sig->clear(op);
+	arg(e.left);
+	arg(e.right);
+}
+
+void ExprHashCons::unary(const ExprUnaryOp& e, int op) {
+	sig->clear(op);
+	arg(e.expr);
+}
+
+void ExprHashCons::visit(const ExprNode& e) { e.acceptVisitor(*this); }
+
+void ExprHashCons::visit(const ExprIndex& i) {
+	sig->clear(1);
+	arg(i.expr);
+	sig->params.push_back(i.index.first_row());
+	sig->params.push_back(i.index.last_row());
+	sig->params.push_back(i.index.first_col());
+	sig->params.push_back(i.index.last_col());
+}
+
+void ExprHashCons::visit(const ExprNAryOp& e)   { e.acceptVisitor(*this); } // (useless so far)
+void ExprHashCons::visit(const ExprLeaf& e)     { e.acceptVisitor(*this); } // (useless so far)
+void ExprHashCons::visit(const ExprBinaryOp& e) { e.acceptVisitor(*this); } // (useless so far)
+void ExprHashCons::visit(const ExprUnaryOp& e)  { e.acceptVisitor(*this); } // (useless so far)
+
+void ExprHashCons::visit(const ExprSymbol& x) {
+	sig->clear(2);
+	sig->params.push_back(x.id); // a symbol is only equivalent to itself
+}
+
+void ExprHashCons::visit(const ExprConstant& c) {
+	sig->clear(3);
+	sig->cst=&c.get();
+}
+
+void ExprHashCons::visit(const ExprVector& e) {
+	nary(e,4);
+	sig->params.push_back(e.orient);
+}
+
+void ExprHashCons::visit(const ExprApply& e) {
+	nary(e,5);
+	sig->func=&e.func;
+}
+
+void ExprHashCons::visit(const ExprChi& e)    { nary(e,6); }
+void ExprHashCons::visit(const ExprAdd& e)    { binary(e,7); }
+void ExprHashCons::visit(const ExprMul& e)    { binary(e,8); }
+void ExprHashCons::visit(const ExprSub& e)    { binary(e,9); }
+void ExprHashCons::visit(const ExprDiv& e)    { binary(e,10); }
+void ExprHashCons::visit(const ExprMax& e)    { binary(e,11); }
+void ExprHashCons::visit(const ExprMin& e)    { binary(e,12); }
+void ExprHashCons::visit(const ExprAtan2& e)  { binary(e,13); }
+void ExprHashCons::visit(const ExprMinus& e)  { unary(e,14); }
+void ExprHashCons::visit(const ExprTrans& e)  { unary(e,15); }
+void ExprHashCons::visit(const ExprSign& e)   { unary(e,16); }
+void ExprHashCons::visit(const ExprAbs& e)    { unary(e,17); }
+
+void ExprHashCons::visit(const ExprPower& e)  {
+	unary(e,18);
+	sig->params.push_back(e.expon);
+}
+
+void ExprHashCons::visit(const ExprSqr& e)    { unary(e,19); }
+void ExprHashCons::visit(const ExprSqrt& e)   { unary(e,20); }
+void ExprHashCons::visit(const ExprExp& e)    { unary(e,21); }
+void ExprHashCons::visit(const ExprLog& e)    { unary(e,22); }
+void ExprHashCons::visit(const ExprCos& e)    { unary(e,23); }
+void ExprHashCons::visit(const ExprSin& e)    { unary(e,24); }
+void ExprHashCons::visit(const ExprTan& e)    { unary(e,25); }
+void ExprHashCons::visit(const ExprCosh& e)   { unary(e,26); }
+void ExprHashCons::visit(const ExprSinh& e)   { unary(e,27); }
+void ExprHashCons::visit(const ExprTanh& e)   { unary(e,28); }
+void ExprHashCons::visit(const ExprAcos& e)   { unary(e,29); }
+void ExprHashCons::visit(const ExprAsin& e)   { unary(e,30); }
+void ExprHashCons::visit(const ExprAtan& e)   { unary(e,31); }
+void ExprHashCons::visit(const ExprAcosh& e)  { unary(e,32); }
+void ExprHashCons::visit(const ExprAsinh& e)  { unary(e,33); }
+void ExprHashCons::visit(const ExprAtanh& e)  { unary(e,34); }
+
+} // namespace ibex
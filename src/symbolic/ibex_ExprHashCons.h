@@ -0,0 +1,200 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ExprHashCons.h
+// Author      : Gilles Chabert
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_EXPR_HASH_CONS_H__
+#define __IBEX_EXPR_HASH_CONS_H__
+
+#include "ibex_ExprVisitor.h"
+#include "ibex_NodeMap.h"
+
+#include <vector>
+
+#ifdef __GNUC__
+#include <ciso646> // just to initialize _LIBCPP_VERSION
+#ifdef _LIBCPP_VERSION
+#include <unordered_map>
+#define IBEX_EXPR_BUCKETS std::unordered_map<unsigned long,std::vector<const ExprNode*> >
+#else
+#include <tr1/unordered_map>
+#define IBEX_EXPR_BUCKETS std::tr1::unordered_map<unsigned long,std::vector<const ExprNode*> >
+#endif
+#else
+#if (_MSC_VER >= 1600)
+#include <unordered_map>
+#define IBEX_EXPR_BUCKETS std::unordered_map<unsigned long,std::vector<const ExprNode*> >
+#else
+#include <unordered_map>
+#define IBEX_EXPR_BUCKETS std::tr1::unordered_map<unsigned long,std::vector<const ExprNode*> >
+#endif // (_MSC_VER >= 1600)
+#endif
+
+namespace ibex {
+
+/**
+ * \ingroup symbolic
+ *
+ * \brief Table of structurally distinct expression nodes (hash-consing)
+ *
+ * Two nodes are equivalent if they apply the same operator, with the same
+ * parameters (index, exponent, orientation, function), to the same argument
+ * <i>nodes</i>. Two constants are equivalent if they have the same value.
+ * Two distinct symbols are never equivalent.
+ *
+ * Arguments are compared by address, not recursively: the table is meant to
+ * be filled bottom-up (arguments first) so that the arguments of a node are
+ * already unique. The hash code and the comparison of a node are then
+ * computed in time proportional to its number of arguments, which makes
+ * the construction of a DAG linear in the number of nodes (see #Expr2DAG).
+ *
+ * The table does not own the nodes.
+ *
+ * Example (hash-consed construction):
+ * <pre>
+ *   ExprHashCons h;
+ *   const ExprNode& e1=h.get(h.get(x)+h.get(y));
+ *   const ExprNode& e2=h.get(h.get(x)+h.get(y)); // &e2==&e1
+ * </pre>
+ */
+class ExprHashCons : public virtual ExprVisitor {
+public:
+	/**
+	 * \brief Create an empty table.
+	 */
+	ExprHashCons();
+
+	/**
+	 * \brief Hash-consed construction.
+	 *
+	 * If the table contains a node equivalent to e, return it and delete e
+	 * (e must be a new node, without father). Otherwise, insert e and return e.
+	 *
+	 * \pre The arguments of e have been obtained through this table.
+	 */
+	const ExprNode& get(const ExprNode& e);
+
+	/**
+	 * \brief The node of the table equivalent to e (NULL if none).
+	 *
+	 * If \a peer is not NULL, every argument of e found in \a peer is replaced
+	 * by its image, i.e., the node searched for is the one that would be obtained
+	 * by rebuilding e on the peer arguments (e is not modified). This allows to
+	 * look for a node without creating it.
+	 */
+	const ExprNode* find(const ExprNode& e, const NodeMap<const ExprNode*>* peer=NULL);
+
+	/**
+	 * \brief Insert e in the table.
+	 *
+	 * \pre The table does not contain a node equivalent to e.
+	 */
+	void insert(const ExprNode& e);
+
+	/**
+	 * \brief Number of nodes in the table.
+	 */
+	int size() const;
+
+	/**
+	 * \brief Structural hash code of a node.
+	 *
+	 * Depends on the operator, the ids of the arguments (after substitution by \a peer),
+	 * the parameters of the operator and the value of constants.
+	 */
+	unsigned long hash(const ExprNode& e, const NodeMap<const ExprNode*>* peer=NULL);
+
+protected:
+
+	/*
+	 * Shallow description of a node
+	 */
+	struct Signature {
+		int op;                              // operator code
+		std::vector<const ExprNode*> args;   // arguments
+		std::vector<long> params;            // index, exponent, orientation, symbol id
+		const Function* func;                // applied function (ExprApply)
+		const Domain* cst;                   // value (ExprConstant)
+
+		void clear(int op);
+		bool operator==(const Signature& s) const;
+		unsigned long hash() const;
+	};
+
+	/* Calculate the signature of e (in "sig") */
+	void signature(const ExprNode& e, const NodeMap<const ExprNode*>* peer, Signature& sig);
+
+	void visit(const ExprNode& e);
+	void visit(const ExprIndex& i);
+	void visit(const ExprNAryOp& e);
+	void visit(const ExprLeaf& e);
+	void visit(const ExprBinaryOp& b);
+	void visit(const ExprUnaryOp& u);
+	void visit(const ExprSymbol& x);
+	void visit(const ExprConstant& c);
+	void visit(const ExprVector& e);
+	void visit(const ExprApply& e);
+	void visit(const ExprChi& e);
+	void visit(const ExprAdd& e);
+	void visit(const ExprMul& e);
+	void visit(const ExprSub& e);
+	void visit(const ExprDiv& e);
+	void visit(const ExprMax& e);
+	void visit(const ExprMin& e);
+	void visit(const ExprAtan2& e);
+	void visit(const ExprMinus& e);
+	void visit(const ExprTrans& e);
+	void visit(const ExprSign& e);
+	void visit(const ExprAbs& e);
+	void visit(const ExprPower& e);
+	void visit(const ExprSqr& e);
+	void visit(const ExprSqrt& e);
+	void visit(const ExprExp& e);
+	void visit(const ExprLog& e);
+	void visit(const ExprCos& e);
+	void visit(const ExprSin& e);
+	void visit(const ExprTan& e);
+	void visit(const ExprCosh& e);
+	void visit(const ExprSinh& e);
+	void visit(const ExprTanh& e);
+	void visit(const ExprAcos& e);
+	void visit(const ExprAsin& e);
+	void visit(const ExprAtan& e);
+	void visit(const ExprAcosh& e);
+	void visit(const ExprAsinh& e);
+	void visit(const ExprAtanh& e);
+
+	void nary(const ExprNAryOp& e, int op);
+	void binary(const ExprBinaryOp& e, int op);
+	void unary(const ExprUnaryOp& e, int op);
+	void arg(const ExprNode& a);
+
+	/* Nodes, by hash code */
+	IBEX_EXPR_BUCKETS buckets;
+
+	/* Number of nodes */
+	int nb_nodes;
+
+	/* Signature being calculated by the visitor */
+	Signature* sig;
+
+	/* Current substitution of arguments */
+	const NodeMap<const ExprNode*>* peer;
+
+	/* Signatures of the searched node and of a candidate */
+	Signature sig1, sig2;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline int ExprHashCons::size() const {
+	return nb_nodes;
+}
+
+} // namespace ibex
+
+#endif // __IBEX_EXPR_HASH_CONS_H__
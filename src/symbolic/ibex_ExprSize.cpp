@@ -32,6 +32,10 @@ ExprSize::ExprSize(const Array<const ExprNode>& args) : size(0) {
 	for (int i=0; i<args.size(); i++) visit(args[i]);
 }
 
+ExprSize::ExprSize(const ExprNode& e) : size(0) {
+	visit(e);
+}
+
 void ExprSize::visit(const ExprNode& e) {
 	if (!map.found(e)) {
 		map.insert(e,true);
@@ -37,6 +37,9 @@ public:
 	/** For n-ary expressions (ExprApply, ExprVector,...). */
 	ExprSize(const Array<const ExprNode>& args);
 
+	/** For the whole DAG of an expression. */
+	ExprSize(const ExprNode& e);
+
 	/** The size of the DAG */
 	int size;
 
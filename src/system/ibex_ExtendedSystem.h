@@ -66,10 +66,21 @@ public:
 	 */
 	//Function original_goal;
 
+protected:
+	friend class ModelFile;
+
+	/**
+	 * \brief Build an empty extended system (fields set by ModelFile).
+	 */
+	ExtendedSystem();
 };
 
 /*================================== inline implementations ========================================*/
 
+inline ExtendedSystem::ExtendedSystem() {
+
+}
+
 inline int ExtendedSystem::goal_var() const {
 	return nb_var-1;
 }
@@ -17,7 +17,7 @@ using namespace std;
 
 namespace ibex {
 
-FncKhunTucker::FncKhunTucker(const NormalizedSystem& sys, Function* df, Function** dg, const IntervalVector& current_box, const BitSet& active) :
+FncKhunTucker::FncKhunTucker(const NormalizedSystem& sys, const Function* df, const Function** dg, const IntervalVector& current_box, const BitSet& active) :
 								Fnc(1,1), nb_mult(0), // **tmp**
 								n(sys.nb_var), // **tmp**
 								sys(sys), df(df), dg(dg),
@@ -45,7 +45,7 @@ public:
 	 * \param box -    current box (not to be confused with the system "box", i.e., bounding constraints)
 	 * \param active - (potentially) active constraints on the box.
  	 */
-	FncKhunTucker(const NormalizedSystem& sys, Function* df, Function** dg, const IntervalVector& box, const BitSet& active);
+	FncKhunTucker(const NormalizedSystem& sys, const Function* df, const Function** dg, const IntervalVector& box, const BitSet& active);
 
 	/**
 	 *\see #ibex::Fnc
@@ -80,8 +80,8 @@ public:
 
 	int n; // number of original variables
 	const NormalizedSystem& sys;
-	Function* df;
-	Function** dg;
+	const Function* df;
+	const Function** dg;
 
 	// TODO: put these bitsets in a backtrackable structure?
 	BitSet eq;
@@ -0,0 +1,147 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ModelCache.cpp
+// Author      : Gilles Chabert
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "ibex_ModelCache.h"
+#include "ibex_ModelFile.h"
+#include "ibex_UnknownFileException.h"
+
+#include <fstream>
+#include <cstdio>
+#include <cstring>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+enum { SYSTEM, NORMALIZED_SYSTEM, EXTENDED_SYSTEM };
+
+const char* suffix[] = { "", "-n", "-e" };
+
+string hex(unsigned long long h) {
+	char s[17];
+	sprintf(s, "%016llx", h);
+	return s;
+}
+
+} // end anonymous namespace
+
+ModelCache::ModelCache(const char* dir, bool diff) : dir(dir? dir : ""), diff(diff) {
+
+}
+
+ModelCache::~ModelCache() {
+	for (map<string,System*>::iterator it=systems.begin(); it!=systems.end(); it++)
+		delete it->second;
+}
+
+string ModelCache::hash(const char* filename) {
+	ifstream is(filename, ios::binary);
+	if (!is) throw UnknownFileException(filename);
+
+	// 64-bit FNV-1a
+	unsigned long long h=14695981039346656037ULL;
+	char buf[4096];
+	do {
+		is.read(buf, sizeof(buf));
+		for (streamsize i=0; i<is.gcount(); i++) {
+			h ^= (unsigned char) buf[i];
+			h *= 1099511628211ULL;
+		}
+	} while (is);
+
+	return hex(h);
+}
+
+System& ModelCache::system(const char* filename) {
+	return get(filename, SYSTEM, 0);
+}
+
+NormalizedSystem& ModelCache::normalized_system(const char* filename, double eps_h) {
+	return (NormalizedSystem&) get(filename, NORMALIZED_SYSTEM, eps_h);
+}
+
+ExtendedSystem& ModelCache::extended_system(const char* filename, double eps_h) {
+	return (ExtendedSystem&) get(filename, EXTENDED_SYSTEM, eps_h);
+}
+
+System& ModelCache::get(const char* filename, int kind, double eps_h) {
+
+	string key=hash(filename);
+	if (kind!=SYSTEM) {
+		unsigned long long bits;
+		memcpy(&bits, &eps_h, sizeof(bits));
+		key += suffix[kind] + hex(bits);
+	}
+
+	map<string,System*>::iterator it=systems.find(key);
+	if (it!=systems.end()) return *it->second;
+
+	string path=dir + "/" + key + ".ibx";
+	System* sys=NULL;
+
+	if (!dir.empty()) {
+		try {
+			sys=ModelFile::load(path.c_str());
+			// the file may have been written by another program
+			bool ok;
+			switch (kind) {
+			case EXTENDED_SYSTEM:   ok=dynamic_cast<ExtendedSystem*>(sys)!=NULL; break;
+			case NORMALIZED_SYSTEM: ok=dynamic_cast<NormalizedSystem*>(sys)!=NULL && dynamic_cast<ExtendedSystem*>(sys)==NULL; break;
+			default:                ok=dynamic_cast<NormalizedSystem*>(sys)==NULL;
+			}
+			if (!ok) {
+				delete sys;
+				sys=NULL;
+			}
+		} catch(ModelFileException&) {
+			sys=NULL;
+		}
+	}
+
+	if (!sys) {
+		switch (kind) {
+		case EXTENDED_SYSTEM:   sys=new ExtendedSystem(system(filename), eps_h); break;
+		case NORMALIZED_SYSTEM: sys=new NormalizedSystem(system(filename), eps_h); break;
+		default:                sys=new System(filename);
+		}
+
+		if (!dir.empty()) {
+			// the linear part of the Jacobian of the goal and the
+			// constraints is stored with the system (see ModelFile)
+			if (sys->goal) sys->goal->deriv_calculator();
+			if (sys->nb_ctr>0) sys->f_ctrs.deriv_calculator();
+
+			// write in a temporary file first so that a
+			// concurrent reader never sees a partial file
+			string tmp=path + ".tmp";
+			ofstream os(tmp.c_str(), ios::binary);
+			if (os) {
+				bool ok=true;
+				try {
+					ModelFile::write(os, *sys, diff);
+				} catch(ModelFileException&) {
+					// not supported by the format (e.g., function
+					// applications): the system is only kept in memory
+					ok=false;
+				}
+				os.close();
+				if (!ok || !os || rename(tmp.c_str(), path.c_str())!=0)
+					remove(tmp.c_str());
+			}
+		}
+	}
+
+	systems.insert(make_pair(key, sys));
+	return *sys;
+}
+
+} // end namespace ibex
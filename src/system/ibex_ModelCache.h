@@ -0,0 +1,104 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ModelCache.h
+// Author      : Gilles Chabert
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_MODEL_CACHE_H__
+#define __IBEX_MODEL_CACHE_H__
+
+#include "ibex_ExtendedSystem.h"
+
+#include <map>
+#include <string>
+
+namespace ibex {
+
+/**
+ * \ingroup system
+ *
+ * \brief Cache of precompiled systems.
+ *
+ * Systems loaded from Minibex files, and their normalized and
+ * extended versions, are kept in memory and, if a directory is
+ * given, stored in this directory as model files (see ModelFile).
+ *
+ * Entries are keyed by a hash of the content of the Minibex file
+ * (plus the kind of system and the value of eps_h), not by its
+ * name: a modified file gets new entries, and a file loaded under
+ * another name is found in the cache.
+ *
+ * The linear part of the Jacobian (see Gradient) of the goal and of
+ * the constraints of every system is stored in the model files, so
+ * that it is not recalculated when a system is loaded.
+ *
+ * Model files that cannot be read (e.g., written by another version
+ * of the format) are silently rebuilt from the Minibex file.
+ * Systems that cannot be written (e.g., with function applications)
+ * are only kept in memory.
+ *
+ * The systems are owned by the cache.
+ */
+class ModelCache {
+public:
+
+	/**
+	 * \brief Create a cache.
+	 *
+	 * \param dir  - directory of the model files (must exist). If NULL,
+	 *               systems are only kept in memory.
+	 * \param diff - if true, the symbolic derivatives of all the
+	 *               functions are computed and stored with the systems.
+	 */
+	explicit ModelCache(const char* dir=NULL, bool diff=false);
+
+	/**
+	 * \brief Delete the cache and all the systems.
+	 */
+	~ModelCache();
+
+	/**
+	 * \brief The system of a Minibex file.
+	 *
+	 * \throw UnknownFileException - if the file cannot be read.
+	 * \throw SyntaxError          - if the file has to be parsed and
+	 *                               contains a syntax error.
+	 */
+	System& system(const char* filename);
+
+	/**
+	 * \brief The normalized system of a Minibex file.
+	 *
+	 * \see NormalizedSystem(const System&, double, bool).
+	 */
+	NormalizedSystem& normalized_system(const char* filename, double eps_h=NormalizedSystem::default_eps_h);
+
+	/**
+	 * \brief The extended system of a Minibex file.
+	 *
+	 * \see ExtendedSystem(const System&, double).
+	 */
+	ExtendedSystem& extended_system(const char* filename, double eps_h=NormalizedSystem::default_eps_h);
+
+	/**
+	 * \brief Hash of the content of a file (16 hexadecimal digits).
+	 *
+	 * \throw UnknownFileException - if the file cannot be read.
+	 */
+	static std::string hash(const char* filename);
+
+private:
+	System& get(const char* filename, int kind, double eps_h);
+
+	const std::string dir;
+	const bool diff;
+	std::map<std::string, System*> systems;
+};
+
+} // end namespace ibex
+
+#endif // __IBEX_MODEL_CACHE_H__
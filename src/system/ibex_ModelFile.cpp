@@ -0,0 +1,718 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ModelFile.cpp
+// Author      : Gilles Chabert
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "ibex_ModelFile.h"
+#include "ibex_ExtendedSystem.h"
+#include "ibex_ExprVisitor.h"
+#include "ibex_NodeMap.h"
+#include "ibex_ExprDiff.h"
+#include "ibex_Gradient.h"
+
+#include <fstream>
+#include <vector>
+#include <cstring>
+
+using namespace std;
+
+/*
+ * Layout of a model file (all integers are 32 bits, all numbers
+ * are in the byte order of the machine that wrote the file):
+ *
+ *   header   : magic "IBEXMDL" + '\0', version, byte-order mark
+ *   record   : 'F' function | 'S' system
+ *
+ *   function : name, number of arguments, arguments (name, dim),
+ *              nodes (opcode + operands, children before fathers),
+ *              END, index of the root node, 1 + linear part | 0,
+ *              1 + derivative | 0
+ *
+ *   linear part : for each component, number of nonzero coefficients
+ *              and (column, coefficient) for each of them (see
+ *              Gradient::coeff_matrix; the last column is the constant)
+ *
+ *   system   : kind (0=System, 1=NormalizedSystem, 2=ExtendedSystem),
+ *              nb_var, nb_ctr, box, auxiliary functions, 1 + goal | 0,
+ *              if nb_ctr>0: f_ctrs + operators, otherwise: arguments,
+ *              constraints (operator + function)
+ *
+ * Nodes are numbered in the order they appear, the arguments
+ * of the function first.
+ */
+
+namespace ibex {
+
+const unsigned int ModelFile::version = 2;
+
+namespace {
+
+const char magic[8] = { 'I', 'B', 'E', 'X', 'M', 'D', 'L', '\0' };
+
+const unsigned int byte_order_mark = 0x01020304;
+
+enum {
+	END, INDEX, CONSTANT, VECTOR, CHI,
+	ADD, MUL, SUB, DIV, MAX, MIN, ATAN2,
+	POWER, MINUS, TRANS, SIGN, ABS, SQR, SQRT, EXP, LOG,
+	COS, SIN, TAN, COSH, SINH, TANH, ACOS, ASIN, ATAN, ACOSH, ASINH, ATANH,
+	NB_OPCODES
+};
+
+enum { SYSTEM, NORMALIZED_SYSTEM, EXTENDED_SYSTEM };
+
+} // end anonymous namespace
+
+ostream& operator<<(ostream& os, const ModelFileException& e) {
+	os << "Model file error: " << e.message();
+	return os;
+}
+
+/*================================================================================*/
+
+class ModelFile::Writer : public ExprVisitor {
+public:
+	Writer(ostream& os, bool diff) : os(os), diff(diff), nb_nodes(0) { }
+
+	void header() {
+		os.write(magic, sizeof(magic));
+		write_uint(version);
+		write_uint(byte_order_mark);
+	}
+
+	// diff: whether the derivative of f has to be computed
+	void function(const Function& f, bool diff) {
+		id.clean();
+		nb_nodes=0;
+
+		write_string(f.name);
+		write_int(f.nb_arg());
+		for (int i=0; i<f.nb_arg(); i++) {
+			write_symbol(f.arg(i));
+			id.insert(f.arg(i), nb_nodes++);
+		}
+
+		node(f.expr());
+		write_byte(END);
+		write_int(id[f.expr()]);
+
+		const Gradient* g=computed_grad(f);
+		if (g && !f.expr().dim.is_matrix()) {
+			write_byte(1);
+			linear_part(g->coeff_matrix);
+		} else
+			write_byte(0);
+
+		const Function* df=computed_diff(f);
+		if (!df && diff) {
+			try {
+				df=&f.diff();
+			} catch(ExprDiffException&) {
+				// not differentiable symbolically (e.g., "chi"
+				// or matrix-valued function): not saved
+			}
+		}
+
+		if (df) {
+			write_byte(1);
+			function(*df, false);
+		} else
+			write_byte(0);
+	}
+
+	void function(const Function& f) {
+		function(f, diff);
+	}
+
+	void system(const System& sys) {
+		if (dynamic_cast<const ExtendedSystem*>(&sys))
+			write_byte(EXTENDED_SYSTEM);
+		else if (dynamic_cast<const NormalizedSystem*>(&sys))
+			write_byte(NORMALIZED_SYSTEM);
+		else
+			write_byte(SYSTEM);
+
+		write_int(sys.nb_var);
+		write_int(sys.nb_ctr);
+
+		for (int i=0; i<sys.nb_var; i++)
+			write_interval(sys.box[i]);
+
+		write_int(sys.func.size());
+		for (int i=0; i<sys.func.size(); i++)
+			function(sys.func[i]);
+
+		if (sys.goal) {
+			write_byte(1);
+			function(*sys.goal);
+		} else
+			write_byte(0);
+
+		if (sys.nb_ctr>0) {
+			// the arguments of the system are those of f_ctrs
+			function(sys.f_ctrs);
+			for (int i=0; i<sys.f_ctrs.image_dim(); i++)
+				write_byte(sys.ops[i]);
+		} else {
+			write_int(sys.args.size());
+			for (int i=0; i<sys.args.size(); i++)
+				write_symbol(sys.args[i]);
+		}
+
+		for (int i=0; i<sys.nb_ctr; i++) {
+			write_byte(sys.ctrs[i].op);
+			function(sys.ctrs[i].f);
+		}
+	}
+
+	void write_byte(unsigned char c) { os.put((char) c); }
+
+protected:
+	ostream& os;
+	bool diff;
+	NodeMap<int> id;
+	int nb_nodes;
+
+	void write_uint(unsigned int n) { os.write((const char*) &n, sizeof(n)); }
+
+	void write_int(int n) { os.write((const char*) &n, sizeof(n)); }
+
+	void write_double(double x) { os.write((const char*) &x, sizeof(x)); }
+
+	void write_string(const char* s) {
+		int n=strlen(s);
+		write_int(n);
+		os.write(s,n);
+	}
+
+	void write_dim(const Dim& d) {
+		write_int(d.nb_rows());
+		write_int(d.nb_cols());
+	}
+
+	void write_interval(const Interval& x) {
+		if (x.is_empty()) {
+			write_double(POS_INFINITY);
+			write_double(NEG_INFINITY);
+		} else {
+			write_double(x.lb());
+			write_double(x.ub());
+		}
+	}
+
+	void write_symbol(const ExprSymbol& x) {
+		write_string(x.name);
+		write_dim(x.dim);
+	}
+
+	// only nonzero coefficients are written (the matrix is sparse
+	// in general)
+	void linear_part(const IntervalMatrix& coeff) {
+		for (int i=0; i<coeff.nb_rows(); i++) {
+			int nb=0;
+			for (int j=0; j<coeff.nb_cols(); j++)
+				if (coeff[i][j]!=Interval::ZERO) nb++;
+			write_int(nb);
+			for (int j=0; j<coeff.nb_cols(); j++)
+				if (coeff[i][j]!=Interval::ZERO) {
+					write_int(j);
+					write_interval(coeff[i][j]);
+				}
+		}
+	}
+
+	// write the subnodes of e then e itself (if not yet written)
+	void node(const ExprNode& e) {
+		if (id.found(e)) return;
+
+		if (const ExprIndex* i=dynamic_cast<const ExprIndex*>(&e))
+			node(i->expr);
+		else if (const ExprUnaryOp* u=dynamic_cast<const ExprUnaryOp*>(&e))
+			node(u->expr);
+		else if (const ExprBinaryOp* b=dynamic_cast<const ExprBinaryOp*>(&e)) {
+			node(b->left);
+			node(b->right);
+		} else if (const ExprNAryOp* n=dynamic_cast<const ExprNAryOp*>(&e)) {
+			for (int j=0; j<n->nb_args; j++)
+				node(n->arg(j));
+		}
+
+		e.acceptVisitor(*this);
+		id.insert(e, nb_nodes++);
+	}
+
+	void nary(unsigned char op, const ExprNAryOp& e) {
+		write_byte(op);
+		write_int(e.nb_args);
+		for (int j=0; j<e.nb_args; j++)
+			write_int(id[e.arg(j)]);
+	}
+
+	void binary(unsigned char op, const ExprBinaryOp& e) {
+		write_byte(op);
+		write_int(id[e.left]);
+		write_int(id[e.right]);
+	}
+
+	void unary(unsigned char op, const ExprUnaryOp& e) {
+		write_byte(op);
+		write_int(id[e.expr]);
+	}
+
+	void visit(const ExprIndex& e) {
+		write_byte(INDEX);
+		write_int(id[e.expr]);
+		write_int(e.index.first_row());
+		write_int(e.index.last_row());
+		write_int(e.index.first_col());
+		write_int(e.index.last_col());
+	}
+
+	void visit(const ExprSymbol& e) {
+		throw ModelFileException("a symbol is not an argument of the function");
+	}
+
+	void visit(const ExprConstant& e) {
+		write_byte(CONSTANT);
+		write_dim(e.dim);
+		const Domain& d=e.get();
+		switch (e.dim.type()) {
+		case Dim::SCALAR:     write_interval(d.i()); break;
+		case Dim::ROW_VECTOR:
+		case Dim::COL_VECTOR: for (int i=0; i<d.v().size(); i++) write_interval(d.v()[i]); break;
+		case Dim::MATRIX:     for (int i=0; i<d.m().nb_rows(); i++)
+		                          for (int j=0; j<d.m().nb_cols(); j++) write_interval(d.m()[i][j]);
+		                      break;
+		}
+	}
+
+	void visit(const ExprVector& e) {
+		nary(VECTOR, e);
+		write_byte(e.orient==ExprVector::ROW ? 1 : 0);
+	}
+
+	void visit(const ExprApply& e) {
+		throw ModelFileException("function applications are not supported");
+	}
+
+	void visit(const ExprChi& e)   { nary(CHI, e); }
+	void visit(const ExprAdd& e)   { binary(ADD, e); }
+	void visit(const ExprMul& e)   { binary(MUL, e); }
+	void visit(const ExprSub& e)   { binary(SUB, e); }
+	void visit(const ExprDiv& e)   { binary(DIV, e); }
+	void visit(const ExprMax& e)   { binary(MAX, e); }
+	void visit(const ExprMin& e)   { binary(MIN, e); }
+	void visit(const ExprAtan2& e) { binary(ATAN2, e); }
+	void visit(const ExprPower& e) { unary(POWER, e); write_int(e.expon); }
+	void visit(const ExprMinus& e) { unary(MINUS, e); }
+	void visit(const ExprTrans& e) { unary(TRANS, e); }
+	void visit(const ExprSign& e)  { unary(SIGN, e); }
+	void visit(const ExprAbs& e)   { unary(ABS, e); }
+	void visit(const ExprSqr& e)   { unary(SQR, e); }
+	void visit(const ExprSqrt& e)  { unary(SQRT, e); }
+	void visit(const ExprExp& e)   { unary(EXP, e); }
+	void visit(const ExprLog& e)   { unary(LOG, e); }
+	void visit(const ExprCos& e)   { unary(COS, e); }
+	void visit(const ExprSin& e)   { unary(SIN, e); }
+	void visit(const ExprTan& e)   { unary(TAN, e); }
+	void visit(const ExprCosh& e)  { unary(COSH, e); }
+	void visit(const ExprSinh& e)  { unary(SINH, e); }
+	void visit(const ExprTanh& e)  { unary(TANH, e); }
+	void visit(const ExprAcos& e)  { unary(ACOS, e); }
+	void visit(const ExprAsin& e)  { unary(ASIN, e); }
+	void visit(const ExprAtan& e)  { unary(ATAN, e); }
+	void visit(const ExprAcosh& e) { unary(ACOSH, e); }
+	void visit(const ExprAsinh& e) { unary(ASINH, e); }
+	void visit(const ExprAtanh& e) { unary(ATANH, e); }
+};
+
+/*================================================================================*/
+
+class ModelFile::Reader {
+public:
+	Reader(istream& is) : is(is) { }
+
+	void header() {
+		char m[sizeof(magic)];
+		is.read(m, sizeof(magic));
+		if (!is || memcmp(m, magic, sizeof(magic))!=0)
+			throw ModelFileException("not a model file");
+		if (read_uint()!=version)
+			throw ModelFileException("unsupported version");
+		if (read_uint()!=byte_order_mark)
+			throw ModelFileException("wrong byte order");
+	}
+
+	Function* function() {
+		Function* f=new Function();
+		try {
+			function(*f);
+		} catch(ModelFileException&) {
+			delete f;
+			throw;
+		}
+		return f;
+	}
+
+	// initialize an uninitialized function
+	void function(Function& f) {
+		string name=read_string();
+		int nb_arg=read_size();
+
+		vector<const ExprNode*> nodes;
+		Array<const ExprSymbol> x(nb_arg);
+		const ExprNode* y;
+
+		try {
+			for (int i=0; i<nb_arg; i++) {
+				x.set_ref(i, read_symbol());
+				nodes.push_back(&x[i]);
+			}
+
+			unsigned char op;
+			while ((op=read_byte())!=END) {
+				nodes.push_back(&node(op, nodes));
+			}
+
+			y=&child(nodes);
+
+		} catch(DimException& e) {
+			cleanup(nodes);
+			throw ModelFileException("bad dimensions (" + e.message() + ")");
+		} catch(ModelFileException&) {
+			cleanup(nodes);
+			throw;
+		}
+
+		f.init(x, *y, name.c_str());
+
+		if (read_byte()) {
+			if (f.expr().dim.is_matrix())
+				throw ModelFileException("linear part of a matrix-valued function");
+			set_grad(f, linear_part(f.image_dim(), f.nb_var()+1));
+		}
+
+		if (read_byte())
+			set_diff(f, function());
+	}
+
+	System* system() {
+		int kind=read_byte();
+		if (kind>EXTENDED_SYSTEM)
+			throw ModelFileException("unknown kind of system");
+
+		int nb_var=read_size();
+		int nb_ctr=read_size();
+		if (nb_var==0)
+			throw ModelFileException("no variable");
+
+		// The fields are set in an order that keeps the
+		// system destructible if the file is corrupted.
+		System* sys=new_system(kind);
+		sys->goal=NULL;
+
+		try {
+			(int&) sys->nb_var = nb_var;
+
+			sys->box.resize(nb_var);
+			for (int i=0; i<nb_var; i++)
+				sys->box[i]=read_interval();
+
+			int nb_func=read_size();
+			for (int i=0; i<nb_func; i++)
+				sys->func.add(*function());
+
+			if (read_byte())
+				sys->goal=function();
+
+			if (nb_ctr>0) {
+				function(sys->f_ctrs);
+
+				// from now on, the symbols are owned by f_ctrs
+				(int&) sys->nb_ctr = nb_ctr;
+
+				sys->args.resize(sys->f_ctrs.nb_arg());
+				for (int i=0; i<sys->f_ctrs.nb_arg(); i++)
+					sys->args.set_ref(i, sys->f_ctrs.arg(i));
+
+				int m=sys->f_ctrs.image_dim();
+				sys->ops=new CmpOp[m];
+				for (int i=0; i<m; i++)
+					sys->ops[i]=read_op();
+			} else {
+				int nb_arg=read_size();
+				for (int i=0; i<nb_arg; i++)
+					sys->args.add(read_symbol());
+			}
+
+			vector<NumConstraint*> ctrs;
+			try {
+				for (int i=0; i<nb_ctr; i++) {
+					CmpOp op=read_op();
+					ctrs.push_back(new NumConstraint(*function(), op, true));
+				}
+			} catch(ModelFileException&) {
+				for (vector<NumConstraint*>::iterator it=ctrs.begin(); it!=ctrs.end(); it++)
+					delete *it;
+				throw;
+			}
+
+			sys->ctrs.resize(nb_ctr);
+			for (int i=0; i<nb_ctr; i++)
+				sys->ctrs.set_ref(i, *ctrs[i]);
+
+		} catch(ModelFileException&) {
+			delete sys;
+			throw;
+		}
+
+		return sys;
+	}
+
+	unsigned char read_byte() {
+		int c=is.get();
+		if (c==EOF) throw ModelFileException("unexpected end of file");
+		return (unsigned char) c;
+	}
+
+protected:
+	istream& is;
+
+	void read_bytes(char* buf, int n) {
+		is.read(buf, n);
+		if (!is) throw ModelFileException("unexpected end of file");
+	}
+
+	unsigned int read_uint() {
+		unsigned int n;
+		read_bytes((char*) &n, sizeof(n));
+		return n;
+	}
+
+	int read_size() {
+		int n;
+		read_bytes((char*) &n, sizeof(n));
+		if (n<0) throw ModelFileException("negative size");
+		return n;
+	}
+
+	double read_double() {
+		double x;
+		read_bytes((char*) &x, sizeof(x));
+		return x;
+	}
+
+	string read_string() {
+		int n=read_size();
+		string s(n,'\0');
+		if (n>0) read_bytes(&s[0], n);
+		return s;
+	}
+
+	Dim read_dim() {
+		int rows=read_size();
+		int cols=read_size();
+		if (rows==0 || cols==0) throw ModelFileException("bad dimensions");
+		return Dim(rows,cols);
+	}
+
+	Interval read_interval() {
+		double lb=read_double();
+		double ub=read_double();
+		return Interval(lb,ub);
+	}
+
+	CmpOp read_op() {
+		unsigned char op=read_byte();
+		if (op>GT) throw ModelFileException("unknown comparison operator");
+		return (CmpOp) op;
+	}
+
+	const ExprSymbol& read_symbol() {
+		string name=read_string();
+		return ExprSymbol::new_(name.c_str(), read_dim());
+	}
+
+	IntervalMatrix linear_part(int m, int n) {
+		IntervalMatrix coeff(m, n, Interval::ZERO);
+		for (int i=0; i<m; i++) {
+			int nb=read_size();
+			for (int k=0; k<nb; k++) {
+				int j=read_size();
+				if (j>=n) throw ModelFileException("bad column index");
+				coeff[i][j]=read_interval();
+			}
+		}
+		return coeff;
+	}
+
+	// read the index of a node already read
+	const ExprNode& child(const vector<const ExprNode*>& nodes) {
+		int i=read_size();
+		if (i>=(int) nodes.size()) throw ModelFileException("bad node index");
+		return *nodes[i];
+	}
+
+	const ExprNode& node(unsigned char op, const vector<const ExprNode*>& nodes) {
+		switch (op) {
+		case INDEX: {
+			const ExprNode& e=child(nodes);
+			int r1=read_size();
+			int r2=read_size();
+			int c1=read_size();
+			int c2=read_size();
+			if (r1>r2 || c1>c2) throw ModelFileException("bad index");
+			return ExprIndex::new_(e, DoubleIndex(e.dim, r1, r2, c1, c2));
+		}
+		case CONSTANT: {
+			Dim dim=read_dim();
+			Domain d(dim);
+			switch (dim.type()) {
+			case Dim::SCALAR:     d.i()=read_interval(); break;
+			case Dim::ROW_VECTOR:
+			case Dim::COL_VECTOR: for (int i=0; i<d.v().size(); i++) d.v()[i]=read_interval(); break;
+			case Dim::MATRIX:     for (int i=0; i<d.m().nb_rows(); i++)
+			                          for (int j=0; j<d.m().nb_cols(); j++) d.m()[i][j]=read_interval();
+			                      break;
+			}
+			return ExprConstant::new_(d);
+		}
+		case VECTOR:
+		case CHI: {
+			int n=read_size();
+			if (n==0 || (op==CHI && n!=3)) throw ModelFileException("bad number of arguments");
+			Array<const ExprNode> args(n);
+			for (int j=0; j<n; j++)
+				args.set_ref(j, child(nodes));
+			if (op==CHI)
+				return ExprChi::new_(args);
+			else
+				return ExprVector::new_(args, read_byte() ? ExprVector::ROW : ExprVector::COL);
+		}
+		case ADD: case MUL: case SUB: case DIV: case MAX: case MIN: case ATAN2: {
+			const ExprNode& l=child(nodes);
+			const ExprNode& r=child(nodes);
+			switch (op) {
+			case ADD:   return ExprAdd::new_(l,r);
+			case MUL:   return ExprMul::new_(l,r);
+			case SUB:   return ExprSub::new_(l,r);
+			case DIV:   return ExprDiv::new_(l,r);
+			case MAX:   return ExprMax::new_(l,r);
+			case MIN:   return ExprMin::new_(l,r);
+			default:    return ExprAtan2::new_(l,r);
+			}
+		}
+		case POWER: {
+			const ExprNode& e=child(nodes);
+			int expon;
+			read_bytes((char*) &expon, sizeof(expon));
+			return ExprPower::new_(e, expon);
+		}
+		default: {
+			if (op>=NB_OPCODES) throw ModelFileException("unknown node type");
+			const ExprNode& e=child(nodes);
+			switch (op) {
+			case MINUS: return ExprMinus::new_(e);
+			case TRANS: return ExprTrans::new_(e);
+			case SIGN:  return ExprSign::new_(e);
+			case ABS:   return ExprAbs::new_(e);
+			case SQR:   return ExprSqr::new_(e);
+			case SQRT:  return ExprSqrt::new_(e);
+			case EXP:   return ExprExp::new_(e);
+			case LOG:   return ExprLog::new_(e);
+			case COS:   return ExprCos::new_(e);
+			case SIN:   return ExprSin::new_(e);
+			case TAN:   return ExprTan::new_(e);
+			case COSH:  return ExprCosh::new_(e);
+			case SINH:  return ExprSinh::new_(e);
+			case TANH:  return ExprTanh::new_(e);
+			case ACOS:  return ExprAcos::new_(e);
+			case ASIN:  return ExprAsin::new_(e);
+			case ATAN:  return ExprAtan::new_(e);
+			case ACOSH: return ExprAcosh::new_(e);
+			case ASINH: return ExprAsinh::new_(e);
+			default:    return ExprAtanh::new_(e);
+			}
+		}
+		}
+	}
+
+	// delete the nodes of a function not completely read
+	void cleanup(vector<const ExprNode*>& nodes) {
+		for (vector<const ExprNode*>::iterator it=nodes.begin(); it!=nodes.end(); it++)
+			delete *it;
+	}
+};
+
+/*================================================================================*/
+
+const Function* ModelFile::computed_diff(const Function& f) {
+	return f.df;
+}
+
+void ModelFile::set_diff(Function& f, Function* df) {
+	f.df=df;
+}
+
+const Gradient* ModelFile::computed_grad(const Function& f) {
+	return f._grad;
+}
+
+void ModelFile::set_grad(Function& f, const IntervalMatrix& coeff_matrix) {
+	f._grad=new Gradient(*f._eval, coeff_matrix);
+}
+
+System* ModelFile::new_system(int kind) {
+	switch (kind) {
+	case EXTENDED_SYSTEM:   return new ExtendedSystem();
+	case NORMALIZED_SYSTEM: return new NormalizedSystem();
+	default:                return new System();
+	}
+}
+
+void ModelFile::write(ostream& os, const Function& f, bool diff) {
+	Writer w(os,diff);
+	w.header();
+	w.write_byte('F');
+	w.function(f);
+}
+
+void ModelFile::write(ostream& os, const System& sys, bool diff) {
+	Writer w(os,diff);
+	w.header();
+	w.write_byte('S');
+	w.system(sys);
+}
+
+Function* ModelFile::read_function(istream& is) {
+	Reader r(is);
+	r.header();
+	if (r.read_byte()!='F') throw ModelFileException("not a function");
+	return r.function();
+}
+
+System* ModelFile::read_system(istream& is) {
+	Reader r(is);
+	r.header();
+	if (r.read_byte()!='S') throw ModelFileException("not a system");
+	return r.system();
+}
+
+void ModelFile::save(const System& sys, const char* filename, bool diff) {
+	ofstream os(filename, ios::binary);
+	if (!os) throw ModelFileException("cannot open file for writing");
+	write(os, sys, diff);
+}
+
+System* ModelFile::load(const char* filename) {
+	ifstream is(filename, ios::binary);
+	if (!is) throw ModelFileException("cannot open file");
+	return read_system(is);
+}
+
+} // end namespace ibex
@@ -0,0 +1,157 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ModelFile.h
+// Author      : Gilles Chabert
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_MODEL_FILE_H__
+#define __IBEX_MODEL_FILE_H__
+
+#include "ibex_System.h"
+#include "ibex_Exception.h"
+
+#include <iostream>
+#include <string>
+
+namespace ibex {
+
+/**
+ * \ingroup system
+ *
+ * \brief Thrown when a model file cannot be read or written.
+ *
+ * Reading fails if the file is truncated, corrupted, written by
+ * another version of the format or on a machine with another
+ * endianness. Writing fails if a function contains a node that
+ * the format does not support (see ModelFile).
+ */
+class ModelFileException : public Exception {
+public:
+
+	ModelFileException(std::string message1) : msg(message1) { }
+
+	/**
+	 * \brief Get the message of this exception
+	 */
+	const std::string& message() const { return msg; }
+
+private:
+	std::string msg;
+};
+
+std::ostream& operator<<(std::ostream& os, const ModelFileException& e);
+
+/**
+ * \ingroup system
+ *
+ * \brief Binary model file.
+ *
+ * Compact binary image of functions and systems. A model file
+ * stores the DAG of every function (one record per node, in
+ * topological order), the linear part of its Jacobian (see Gradient)
+ * and its symbolic derivative if they have been computed, and all
+ * the fields of a system (box, constraints, goal, global constraint
+ * function, operators).
+ * Normalized and extended systems are restored with their
+ * dynamic type.
+ *
+ * Loading a model file involves no parsing, no simplification and
+ * no symbolic differentiation: the nodes are created directly and
+ * each function is compiled once (linear in the size of its DAG).
+ * The linear part of the Jacobian, which is long to calculate on
+ * large systems, is restored as is.
+ *
+ * Constants are stored with their exact binary values. Constants
+ * built by reference (see ExprConstant::new_(const Domain&, bool))
+ * are restored as ordinary constants. Function applications
+ * (ExprApply) are not supported.
+ *
+ * The format is versioned (#version); a file written by another
+ * version raises a ModelFileException.
+ */
+class ModelFile {
+public:
+
+	/**
+	 * \brief Version of the format.
+	 */
+	static const unsigned int version;
+
+	/**
+	 * \brief Write a function.
+	 *
+	 * The linear part of the Jacobian of f is saved if the Gradient
+	 * of f has been built (see Function::deriv_calculator()).
+	 *
+	 * \param diff - if true, the symbolic derivative of f is computed
+	 *               (if not yet and if f can be differentiated) and saved
+	 *               too. Otherwise, the derivative is saved only if it has
+	 *               already been computed. The same holds recursively for
+	 *               the derivative, except that it is never computed.
+	 *
+	 * \throw ModelFileException - if f contains a function application.
+	 *        The stream then contains a partial record.
+	 */
+	static void write(std::ostream& os, const Function& f, bool diff=false);
+
+	/**
+	 * \brief Write a system.
+	 *
+	 * \param diff - see #write(std::ostream&, const Function&, bool).
+	 *               Applies to every function of the system.
+	 *
+	 * \throw ModelFileException - see #write(std::ostream&, const Function&, bool).
+	 */
+	static void write(std::ostream& os, const System& sys, bool diff=false);
+
+	/**
+	 * \brief Read a function (new object).
+	 *
+	 * \throw ModelFileException - if the stream does not contain a function.
+	 */
+	static Function* read_function(std::istream& is);
+
+	/**
+	 * \brief Read a system (new object).
+	 *
+	 * The dynamic type of the result is System, NormalizedSystem
+	 * or ExtendedSystem, as the system written.
+	 *
+	 * \throw ModelFileException - if the stream does not contain a system.
+	 */
+	static System* read_system(std::istream& is);
+
+	/**
+	 * \brief Save a system into a file.
+	 *
+	 * \throw ModelFileException - if the file cannot be opened, or see
+	 *        #write(std::ostream&, const System&, bool).
+	 */
+	static void save(const System& sys, const char* filename, bool diff=false);
+
+	/**
+	 * \brief Load a system from a file (new object).
+	 *
+	 * \throw ModelFileException - if the file cannot be read.
+	 */
+	static System* load(const char* filename);
+
+private:
+	class Writer;
+	class Reader;
+
+	// access to the private data of Function and System
+	static const Function* computed_diff(const Function& f);
+	static void set_diff(Function& f, Function* df);
+	static const Gradient* computed_grad(const Function& f);
+	static void set_grad(Function& f, const IntervalMatrix& coeff_matrix);
+	static System* new_system(int kind);
+};
+
+} // end namespace ibex
+
+#endif // __IBEX_MODEL_FILE_H__
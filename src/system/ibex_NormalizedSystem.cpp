@@ -18,6 +18,10 @@ namespace ibex {
 
 const double NormalizedSystem::default_eps_h = 1e-08;
 
+NormalizedSystem::NormalizedSystem() {
+
+}
+
 namespace {
 
 void set_lb_ub(const Domain& x, Domain& l, Domain& u, double eps_h) {
@@ -44,6 +44,14 @@ public:
 
 	/** Default epsilon applied to equations: 1e-8. */
 	static const double default_eps_h;
+
+protected:
+	friend class ModelFile;
+
+	/**
+	 * \brief Build an empty normalized system (fields set by ModelFile).
+	 */
+	NormalizedSystem();
 };
 
 } // end namespace ibex
@@ -25,6 +25,7 @@ class MainGenerator;
 }
 
 class SystemFactory;
+class ModelFile;
 
 /**
  * \defgroup system Systems
@@ -271,13 +272,16 @@ protected:
 
 private:
 	friend class parser::MainGenerator;
+	friend class ModelFile;
 	friend class NumConstraint; // NumConstraint requires to build a temporary system for parsing a string
 
 	void load(FILE* file);
 
 	// initialize f from the constraints in ctrs,
 	// once *all* the other fields are set (including args and nb_ctr).
-	void init_f_from_ctrs();
+	// If shared is not NULL, (*shared)[j] is the expression of the jth
+	// constraint, already copied with args as symbols.
+	void init_f_from_ctrs(const Array<const ExprNode>* shared=NULL);
 };
 
 std::ostream& operator<<(std::ostream&, const System&);
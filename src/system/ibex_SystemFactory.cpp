@@ -17,11 +17,18 @@ using std::vector;
 
 namespace ibex {
 
-SystemFactory::SystemFactory() : nb_arg(0), nb_var(0), goal(NULL), bound_init(1), args(NULL) { }
+SystemFactory::SystemFactory() : nb_arg(0), nb_var(0), goal(NULL), bound_init(1), args(NULL), shared_args(NULL) { }
 
 
 SystemFactory::~SystemFactory() {
 	if (args) delete args;
+
+	if (shared_args) {
+		cleanup(Array<const ExprNode>(shared_image), false);
+		for (int i=0; i<shared_args->size(); i++)
+			delete &(*shared_args)[i];
+		delete shared_args;
+	}
 }
 
 void SystemFactory::add_var(const ExprSymbol& v) {
@@ -125,8 +132,34 @@ void SystemFactory::add_ctr(const NumConstraint& ctr) {
 	ctrs.push_back(new NumConstraint(*new Function(ctr.f), ctr.op, true));
 }
 
+void SystemFactory::add_ctrs(const Array<const ExprCtr>& new_ctrs) {
+	init_arg_bound();
+
+	if (new_ctrs.is_empty()) return;
+
+	for (int i=0; i<new_ctrs.size(); i++)
+		add_ctr(new_ctrs[i]);
+
+	if (!shared_args) {
+		shared_args = new Array<const ExprSymbol>(args->size());
+		varcopy(*args,*shared_args);
+	}
+
+	// copy all the expressions in one pass, so that
+	// common subexpressions are copied only once
+	Array<const ExprNode> exprs(new_ctrs.size());
+	for (int i=0; i<new_ctrs.size(); i++)
+		exprs.set_ref(i,new_ctrs[i].e);
+
+	Array<const ExprNode> exprs2(new_ctrs.size());
+	ExprCopy().copy(*args, *shared_args, exprs, exprs2);
+
+	for (int i=0; i<exprs2.size(); i++)
+		shared_image.push_back(&exprs2[i]);
+}
+
 // precondition: nb_ctr > 0
-void System::init_f_from_ctrs() {
+void System::init_f_from_ctrs(const Array<const ExprNode>* shared) {
 
 	if (ctrs.is_empty()) {
 		// don't delete the symbols now because
@@ -171,7 +204,7 @@ void System::init_f_from_ctrs() {
 		 * instead of
 		 *    x[0]=0 and x[1]=1.
 		 */
-		const ExprNode& e=ExprCopy().copy(fj.args(), args, fj.expr());
+		const ExprNode& e=shared? (*shared)[j] : ExprCopy().copy(fj.args(), args, fj.expr());
 
 		const Dim& fjd=fj.expr().dim;
 		switch (fjd.type()) {
@@ -247,7 +280,15 @@ void System::init(const SystemFactory& fac) {
 	// so we do the contrary: we generate first the constraints,
 	// and build f with the components of all constraints' functions.
 
-	init_f_from_ctrs();
+	if (!fac.ctrs.empty() && fac.shared_image.size()==fac.ctrs.size()) {
+		// all the constraints have been added with add_ctrs:
+		// copy their shared DAG at once.
+		Array<const ExprNode> shared(fac.shared_image);
+		Array<const ExprNode> shared2(shared.size());
+		ExprCopy().copy(*fac.shared_args, args, shared, shared2);
+		init_f_from_ctrs(&shared2);
+	} else
+		init_f_from_ctrs();
 }
 
 } // end namespace
@@ -86,6 +86,18 @@ public:
 	 */
 	void add_ctr_eq (const ExprNode& exp);
 
+	/**
+	 * \brief Add several constraints at once (by copy).
+	 *
+	 * Same as calling #add_ctr(const ExprCtr&) on each constraint, except
+	 * that subexpressions shared by several constraints remain shared in the
+	 * function \a f_ctrs of the system (instead of being duplicated for each
+	 * constraint). Useful for large models with common subexpressions.
+	 *
+	 * \pre All the variables must have been added.
+	 */
+	void add_ctrs(const Array<const ExprCtr>& ctrs);
+
 protected:
 	friend class System;
 
@@ -107,6 +119,15 @@ protected:
 
 	std::vector<NumConstraint*> ctrs;
 
+	// symbols of the shared image
+	Array<const ExprSymbol>* shared_args;
+
+	// The constraint expressions added by add_ctrs(...),
+	// in a DAG shared by all of them (with shared_args as symbols).
+	// Used to build f_ctrs only if *all* the constraints
+	// were added this way.
+	std::vector<const ExprNode*> shared_image;
+
 private:
 
 	void init_arg_bound();
@@ -220,6 +220,9 @@ public:
 protected:
 	int _nb;
 
+	/** Number of allocated slots (see #add(T&)) */
+	int _capacity;
+
 	/** Array of sub-Ts */
 	T** array;
 private:
@@ -230,12 +233,12 @@ private:
 /*================================== inline implementations ========================================*/
 
 template<class T>
-Array<T>::Array() : _nb(0), array(NULL) {
+Array<T>::Array() : _nb(0), _capacity(0), array(NULL) {
 
 }
 
 template<class T>
-Array<T>::Array(int n) : _nb(n), array(new T*[n]) {
+Array<T>::Array(int n) : _nb(n), _capacity(n), array(new T*[n]) {
 	assert(n>=0);
 	for (int i=0; i<_nb; i++) {
 		array[i] = NULL;
@@ -257,6 +260,7 @@ void Array<T>::resize(int n) {
 	if (array) delete[] array;
 	array=new_array;
 	_nb=n;
+	_capacity=n;
 }
 
 template<class T>
@@ -269,8 +273,17 @@ void Array<T>::set_ref(int i, T& obj) {
 
 template<class T>
 void Array<T>::add(T& obj) {
-	resize(size()+1);
-	set_ref(size()-1,obj);
+	if (_nb==_capacity) {
+		// the capacity is doubled so that n calls
+		// to add take O(n) time (e.g., for "fathers")
+		_capacity = _nb==0 ? 1 : 2*_nb;
+		T** new_array=new T*[_capacity];
+		for (int i=0; i<_nb; i++)
+			new_array[i] = array[i];
+		if (array) delete[] array;
+		array=new_array;
+	}
+	array[_nb++]=&obj;
 }
 
 template<class T>
@@ -282,7 +295,7 @@ void Array<T>::add(const Array<T>& a) {
 }
 
 template<class T>
-Array<T>::Array(T** a, int n) : _nb(n), array(new T*[n]) {
+Array<T>::Array(T** a, int n) : _nb(n), _capacity(n), array(new T*[n]) {
 	assert(n>=0);
 	for (int i=0; i<_nb; i++) {
 		array[i] = a[i];
@@ -290,7 +303,7 @@ Array<T>::Array(T** a, int n) : _nb(n), array(new T*[n]) {
 }
 
 template<class T>
-Array<T>::Array(const std::vector<T*>& vec) : _nb(vec.size()), array(new T*[vec.size()]) {
+Array<T>::Array(const std::vector<T*>& vec) : _nb(vec.size()), _capacity(vec.size()), array(new T*[vec.size()]) {
 
 	assert(vec.size()>0);
 	int i=0;
@@ -300,25 +313,25 @@ Array<T>::Array(const std::vector<T*>& vec) : _nb(vec.size()), array(new T*[vec.
 }
 
 template<class T>
-Array<T>::Array(T& x) : _nb(1), array(new T*[1]) {
+Array<T>::Array(T& x) : _nb(1), _capacity(1), array(new T*[1]) {
 	array[0] = &x;
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2) : _nb(2), array(new T*[2]) {
+Array<T>::Array(T& x1, T& x2) : _nb(2), _capacity(2), array(new T*[2]) {
 	array[0] = &x1;
 	array[1] = &x2;
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3) : _nb(3), array(new T*[3]) {
+Array<T>::Array(T& x1, T& x2, T& x3) : _nb(3), _capacity(3), array(new T*[3]) {
 	array[0] = &x1;
 	array[1] = &x2;
 	array[2] = &x3;
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4) : _nb(4), array(new T*[4]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4) : _nb(4), _capacity(4), array(new T*[4]) {
 	array[0] = &x1;
 	array[1] = &x2;
 	array[2] = &x3;
@@ -326,7 +339,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4) : _nb(4), array(new T*[4]) {
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5) : _nb(5), array(new T*[5]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5) : _nb(5), _capacity(5), array(new T*[5]) {
 	array[0] = &x1;
 	array[1] = &x2;
 	array[2] = &x3;
@@ -335,7 +348,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5) : _nb(5), array(new T*[5]) {
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6) : _nb(6), array(new T*[6]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6) : _nb(6), _capacity(6), array(new T*[6]) {
 	array[0] = &x1;
 	array[1] = &x2;
 	array[2] = &x3;
@@ -345,7 +358,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6) : _nb(6), array(new T*
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7) : _nb(7), array(new T*[7]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7) : _nb(7), _capacity(7), array(new T*[7]) {
 	array[0] = &x1;
 	array[1] = &x2;
 	array[2] = &x3;
@@ -356,7 +369,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7) : _nb(7), array
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8) : _nb(8), array(new T*[8]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8) : _nb(8), _capacity(8), array(new T*[8]) {
 	array[0] = &x1;
 	array[1] = &x2;
 	array[2] = &x3;
@@ -368,7 +381,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8) : _nb(8)
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9) : _nb(9), array(new T*[9]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9) : _nb(9), _capacity(9), array(new T*[9]) {
 	array[0] = &x1;
 	array[1] = &x2;
 	array[2] = &x3;
@@ -381,7 +394,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9) :
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10) : _nb(10), array(new T*[10]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10) : _nb(10), _capacity(10), array(new T*[10]) {
 	array[0]  = &x1;
 	array[1]  = &x2;
 	array[2]  = &x3;
@@ -395,7 +408,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11) : _nb(11), array(new T*[11]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11) : _nb(11), _capacity(11), array(new T*[11]) {
 	array[0]  = &x1;
 	array[1]  = &x2;
 	array[2]  = &x3;
@@ -410,7 +423,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12) : _nb(12), array(new T*[12]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12) : _nb(12), _capacity(12), array(new T*[12]) {
 	array[0]  = &x1;
 	array[1]  = &x2;
 	array[2]  = &x3;
@@ -426,7 +439,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13) : _nb(13), array(new T*[13]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13) : _nb(13), _capacity(13), array(new T*[13]) {
 	array[0]  = &x1;
 	array[1]  = &x2;
 	array[2]  = &x3;
@@ -443,7 +456,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14) : _nb(14), array(new T*[14]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14) : _nb(14), _capacity(14), array(new T*[14]) {
 	array[0]  = &x1;
 	array[1]  = &x2;
 	array[2]  = &x3;
@@ -461,7 +474,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14, T& x15) : _nb(15), array(new T*[15]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14, T& x15) : _nb(15), _capacity(15), array(new T*[15]) {
 	array[0]  = &x1;
 	array[1]  = &x2;
 	array[2]  = &x3;
@@ -480,7 +493,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14, T& x15, T& x16) : _nb(16), array(new T*[16]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14, T& x15, T& x16) : _nb(16), _capacity(16), array(new T*[16]) {
 	array[0]  = &x1;
 	array[1]  = &x2;
 	array[2]  = &x3;
@@ -500,7 +513,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14, T& x15, T& x16, T& x17) : _nb(17), array(new T*[17]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14, T& x15, T& x16, T& x17) : _nb(17), _capacity(17), array(new T*[17]) {
 	array[0]  = &x1;
 	array[1]  = &x2;
 	array[2]  = &x3;
@@ -521,7 +534,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14, T& x15, T& x16, T& x17, T& x18) : _nb(18), array(new T*[18]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14, T& x15, T& x16, T& x17, T& x18) : _nb(18), _capacity(18), array(new T*[18]) {
 	array[0]  = &x1;
 	array[1]  = &x2;
 	array[2]  = &x3;
@@ -543,7 +556,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14, T& x15, T& x16, T& x17, T& x18, T& x19) : _nb(19), array(new T*[19]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14, T& x15, T& x16, T& x17, T& x18, T& x19) : _nb(19), _capacity(19), array(new T*[19]) {
 	array[0]  = &x1;
 	array[1]  = &x2;
 	array[2]  = &x3;
@@ -566,7 +579,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T
 }
 
 template<class T>
-Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14, T& x15, T& x16, T& x17, T& x18, T& x19, T& x20) : _nb(20), array(new T*[20]) {
+Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T& x10, T& x11, T& x12, T& x13, T& x14, T& x15, T& x16, T& x17, T& x18, T& x19, T& x20) : _nb(20), _capacity(20), array(new T*[20]) {
 	array[0]  = &x1;
 	array[1]  = &x2;
 	array[2]  = &x3;
@@ -590,7 +603,7 @@ Array<T>::Array(T& x1, T& x2, T& x3, T& x4, T& x5, T& x6, T& x7, T& x8, T& x9, T
 }
 
 template<class T>
-Array<T>::Array(const Array<T>& a) : _nb(a.size()), array(new T*[a.size()]) {
+Array<T>::Array(const Array<T>& a) : _nb(a.size()), _capacity(a.size()), array(new T*[a.size()]) {
 	for (int i=0; i<_nb; i++) {
 		array[i] = &a[i];
 	}
@@ -0,0 +1,141 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ThreadPool.cpp
+// Author      : Gilles Chabert
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#include "ibex_ThreadPool.h"
+
+#include <exception>
+
+#ifndef _WIN32 // MinGW does not support threads
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <vector>
+#endif
+
+using namespace std;
+
+namespace ibex {
+
+#ifndef _WIN32
+
+struct ThreadPool::Data {
+	Data() : task(NULL), n(0), chunk(1), next(0), generation(0), busy(0), stop(false) { }
+
+	/* run the tasks of the current loop, chunk by chunk */
+	void work() {
+		for (;;) {
+			int i=next.fetch_add(chunk);
+			if (i>=n) return;
+			int end=i+chunk<n? i+chunk : n;
+			for (; i<end; i++) {
+				try {
+					(*task)(i);
+				} catch(...) {
+					lock_guard<mutex> lock(mtx);
+					if (!error) error=current_exception();
+				}
+			}
+		}
+	}
+
+	/* main loop of a thread */
+	void loop() {
+		int gen=0;
+		unique_lock<mutex> lock(mtx);
+		for (;;) {
+			start.wait(lock, [&]{ return stop || generation!=gen; });
+			if (stop) return;
+			gen=generation;
+			lock.unlock();
+			work();
+			lock.lock();
+			if (--busy==0) done.notify_one();
+		}
+	}
+
+	vector<thread> threads;
+	mutex mtx;
+	condition_variable start;
+	condition_variable done;
+
+	/* the current loop */
+	const std::function<void(int)>* task;
+	int n;
+	int chunk;
+	atomic<int> next;
+
+	/* incremented for each loop */
+	int generation;
+	/* number of threads still working on the current loop */
+	int busy;
+	bool stop;
+	exception_ptr error;
+};
+
+ThreadPool::ThreadPool(int nb_threads) : nb_threads(nb_threads<1? 1 : nb_threads), data(new Data()) {
+	for (int t=1; t<this->nb_threads; t++)
+		data->threads.push_back(thread(&Data::loop, data));
+}
+
+ThreadPool::~ThreadPool() {
+	{
+		lock_guard<mutex> lock(data->mtx);
+		data->stop=true;
+	}
+	data->start.notify_all();
+	for (vector<thread>::iterator it=data->threads.begin(); it!=data->threads.end(); it++)
+		it->join();
+	delete data;
+}
+
+void ThreadPool::run(int n, const std::function<void(int)>& task) {
+	{
+		lock_guard<mutex> lock(data->mtx);
+		data->task=&task;
+		data->n=n;
+		// several chunks per thread balance the load when the tasks are uneven
+		data->chunk=n/(4*nb_threads)>1? n/(4*nb_threads) : 1;
+		data->next=0;
+		data->error=nullptr;
+		data->busy=data->threads.size();
+		data->generation++;
+	}
+
+	if (!data->threads.empty()) data->start.notify_all();
+
+	data->work();
+
+	unique_lock<mutex> lock(data->mtx);
+	data->done.wait(lock, [&]{ return data->busy==0; });
+
+	if (data->error) {
+		exception_ptr e=data->error;
+		data->error=nullptr;
+		rethrow_exception(e);
+	}
+}
+
+#else
+
+struct ThreadPool::Data { };
+
+ThreadPool::ThreadPool(int nb_threads) : nb_threads(1), data(NULL) { }
+
+ThreadPool::~ThreadPool() { }
+
+void ThreadPool::run(int n, const std::function<void(int)>& task) {
+	for (int i=0; i<n; i++)
+		task(i);
+}
+
+#endif
+
+} // end namespace ibex
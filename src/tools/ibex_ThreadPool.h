@@ -0,0 +1,76 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ThreadPool.h
+// Author      : Gilles Chabert
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+// Last Update : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_THREAD_POOL_H__
+#define __IBEX_THREAD_POOL_H__
+
+#include <functional>
+
+namespace ibex {
+
+/**
+ * \ingroup tools
+ *
+ * \brief Pool of threads for data-parallel loops.
+ *
+ * The threads are created once (in the constructor) and wait
+ * for the loops submitted by #run(int, const std::function<void(int)>&).
+ *
+ * The threads inherit the floating-point environment (rounding mode)
+ * of the thread that creates the pool.
+ *
+ * \note Under Windows (MinGW), the loops are run sequentially.
+ */
+class ThreadPool {
+public:
+
+	/**
+	 * \brief Create a pool of nb_threads threads.
+	 *
+	 * The calling thread of #run(...) counts as one of them, so
+	 * nb_threads-1 threads are actually created. With nb_threads<=1,
+	 * the loops are run sequentially.
+	 */
+	explicit ThreadPool(int nb_threads);
+
+	/**
+	 * \brief Terminate the threads.
+	 */
+	~ThreadPool();
+
+	/**
+	 * \brief Run task(i) for all i in [0,n).
+	 *
+	 * The indices are distributed among the threads by chunks of
+	 * consecutive indices. Two calls task(i) and task(j) with i!=j
+	 * may be run concurrently and the tasks must not depend on each other.
+	 *
+	 * Return when all the tasks are done. If a task throws an exception,
+	 * the other tasks are still run and one of the exceptions is rethrown.
+	 */
+	void run(int n, const std::function<void(int)>& task);
+
+	/**
+	 * \brief Number of threads (including the calling thread).
+	 */
+	const int nb_threads;
+
+private:
+	ThreadPool(const ThreadPool&); // forbidden
+
+	/** Threads and synchronization (hidden since MinGW does not support threads) */
+	struct Data;
+
+	Data* data;
+};
+
+} // end namespace ibex
+
+#endif // __IBEX_THREAD_POOL_H__
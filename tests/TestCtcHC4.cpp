@@ -12,6 +12,8 @@
 #include "Ponts30.h"
 #include "ibex_CtcFwdBwd.h"
 #include "ibex_CtcHC4.h"
+#include "ibex_CtcSharedHC4.h"
+#include "ibex_SystemFactory.h"
 #include "ibex_Array.h"
 
 namespace ibex {
@@ -55,4 +57,70 @@ void TestCtcHC4::ponts30() {
 	}
 }
 
+void TestCtcHC4::shared01() {
+	SystemFactory fac;
+
+	Variable x("x"),y("y"),z("z");
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_var(z);
+
+	// x*y is shared by the three constraints
+	fac.add_ctr(sqr(x*y)+z=2);
+	fac.add_ctr(exp(x*y)-z<=1);
+	fac.add_ctr(x*y+sqr(x)>=0.5);
+
+	System sys(fac);
+
+	CtcSharedHC4 shc4(sys,0.1);
+	CtcHC4 hc4(sys,0.1);
+
+	CPPUNIT_ASSERT(shc4.nb_nodes()<shc4.nb_nodes_unshared());
+
+	double _box[][2] = {{0.5,2},{-1,1},{-3,3}};
+	IntervalVector box(3,_box);
+
+	for (int k=0; k<3; k++) {
+		IntervalVector box1(box), box2(box);
+		hc4.contract(box1);
+		shc4.contract(box2);
+		CPPUNIT_ASSERT(almost_eq(box1,box2,1e-10));
+		// contract a smaller box (the variable x only)
+		box[0]=Interval(box[0].lb(),box[0].mid());
+	}
+
+	CPPUNIT_ASSERT(shc4.nb_evals()<shc4.nb_evals_unshared());
+}
+
+void TestCtcHC4::shared02() {
+	SystemFactory fac;
+
+	Variable x(2,"x"),y("y");
+	fac.add_var(x);
+	fac.add_var(y);
+
+	// vector constraint
+	fac.add_ctr(y*x+x=IntervalVector(2,Interval(0.5)));
+	fac.add_ctr(sqr(x[0])+sqr(x[1])=1);
+
+	System sys(fac);
+
+	CtcSharedHC4 shc4(sys,0.1);
+	CtcHC4 hc4(sys,0.1);
+
+	CPPUNIT_ASSERT(shc4.list.size()==3);
+
+	double _box[][2] = {{-1,1},{-1,1},{0,1}};
+	IntervalVector box1(3,_box), box2(3,_box);
+	hc4.contract(box1);
+	shc4.contract(box2);
+	CPPUNIT_ASSERT(almost_eq(box1,box2,1e-10));
+
+	// empty result
+	double _box2[][2] = {{2,3},{-1,1},{0,1}};
+	IntervalVector box3(3,_box2);
+	shc4.contract(box3);
+	CPPUNIT_ASSERT(box3.is_empty());
+}
+
 } // end namespace ibex
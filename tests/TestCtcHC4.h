@@ -23,9 +23,13 @@ public:
 	CPPUNIT_TEST_SUITE(TestCtcHC4);
 	
 		CPPUNIT_TEST(ponts30);
+		CPPUNIT_TEST(shared01);
+		CPPUNIT_TEST(shared02);
 	CPPUNIT_TEST_SUITE_END();
 
 	void ponts30();
+	void shared01();
+	void shared02();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestCtcHC4);
@@ -270,4 +270,103 @@ void TestEval::eval_components02() {
 	CPPUNIT_ASSERT(res[3]==19);
 }
 
+void TestEval::incremental01() {
+	const char* expr="sin(x)*y+exp(z)-x*y*z+cos(y)";
+	Function f("x","y","z",expr);
+	Function g("x","y","z",expr); // for reference
+
+	Eval& e=f.basic_evaluator();
+
+	IntervalVector box(3,Interval(-1,1));
+
+	for (int k=0; k<30; k++) {
+		int i=k%3;
+		// alternately take the left/right half
+		box[i] = k%2==0? Interval(box[i].lb(),box[i].mid()) : Interval(box[i].mid(),box[i].ub());
+		CPPUNIT_ASSERT(e.eval_incremental(box).i()==g.eval(box));
+	}
+
+	// with the incremental mode
+	e.set_incremental(true);
+	box=IntervalVector(3,Interval(-1,1));
+	for (int k=0; k<10; k++) {
+		box[k%3]=Interval(box[k%3].mid(),box[k%3].ub());
+		CPPUNIT_ASSERT(f.eval(box)==g.eval(box));
+	}
+}
+
+void TestEval::incremental02() {
+	const char* expr="(x[0]+A[1][1])*sqrt(x[2])-A[0][1]*x[1]+x[0]^2";
+	Function f("x[3]","A[2][2]",expr);
+	Function g("x[3]","A[2][2]",expr); // for reference
+
+	f.basic_evaluator().set_incremental(true);
+
+	IntervalVector box(7,Interval(-1,2));
+	box[2]=Interval(0,3);
+
+	for (int k=0; k<40; k++) {
+		int i=k%7;
+		box[i] = k%2==0? Interval(box[i].mid(),box[i].ub()) : Interval(box[i].lb(),box[i].mid());
+
+		CPPUNIT_ASSERT(f.eval(box)==g.eval(box));
+
+		IntervalVector g1(7), g2(7);
+		f.gradient(box,g1);
+		g.gradient(box,g2);
+		CPPUNIT_ASSERT(g1==g2);
+
+		// the backward phase modifies the node domains
+		IntervalVector x1(box), x2(box);
+		f.backward(Interval(0,1),x1);
+		g.backward(Interval(0,1),x2);
+		CPPUNIT_ASSERT(x1==x2);
+	}
+
+	// outside of the definition domain
+	box[2]=Interval(-2,-1);
+	CPPUNIT_ASSERT(f.eval(box).is_empty());
+	box[2]=Interval(1,2);
+	CPPUNIT_ASSERT(f.eval(box)==g.eval(box));
+}
+
+void TestEval::flat01() {
+	Variable x(3,"x"),y("y");
+	Array<const ExprNode> c;
+	c.add(x[0]*y+sin(x[2]));
+	c.add(transpose(x)*(x+y*x));
+	c.add(sqr(x[1]-y));
+	Function f(x,y,ExprVector::new_col(c));
+	Function g(f,Function::COPY); // for reference
+
+	Eval& e=f.basic_evaluator();
+	int rx=f.nodes.rank(f.arg(0));
+
+	for (int i=0; i<f.nb_nodes(); i++) {
+		if (!f.node(i).dim.is_scalar()) continue;
+		CPPUNIT_ASSERT(&e.d.i(i)==&e.d[i].i());
+		const ExprIndex* idx=dynamic_cast<const ExprIndex*>(&f.node(i));
+		if (idx && &idx->expr==&f.arg(0)) {
+			// x[k] is stored in the domain of x
+			CPPUNIT_ASSERT(e.d.is_alias(i));
+			CPPUNIT_ASSERT(&e.d.i(i)==&e.d[rx].v()[idx->index.row()]);
+		} else
+			CPPUNIT_ASSERT(!e.d.is_alias(i));
+	}
+
+	// the flat domains are saved/restored in incremental mode
+	e.set_incremental(true);
+	IntervalVector box(4,Interval(-1,2));
+	for (int k=0; k<20; k++) {
+		int i=k%4;
+		box[i] = k%2==0? Interval(box[i].mid(),box[i].ub()) : Interval(box[i].lb(),box[i].mid());
+		CPPUNIT_ASSERT(f.eval_vector(box)==g.eval_vector(box));
+
+		IntervalVector x1(box), x2(box);
+		f.backward(IntervalVector(3,Interval(0,1)),x1);
+		g.backward(IntervalVector(3,Interval(0,1)),x2);
+		CPPUNIT_ASSERT(x1==x2);
+	}
+}
+
 }
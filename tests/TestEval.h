@@ -35,6 +35,9 @@ public:
 	CPPUNIT_TEST(issue242);
 	CPPUNIT_TEST(eval_components01);
 	CPPUNIT_TEST(eval_components02);
+	CPPUNIT_TEST(incremental01);
+	CPPUNIT_TEST(incremental02);
+	CPPUNIT_TEST(flat01);
 
 	CPPUNIT_TEST_SUITE_END();
 
@@ -51,6 +54,9 @@ public:
 	void issue242();
 	void eval_components01();
 	void eval_components02();
+	void incremental01();
+	void incremental02();
+	void flat01();
 
 private:
 	void check_deco(Function& f, const ExprNode& e);
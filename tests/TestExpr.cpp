@@ -45,7 +45,7 @@ void TestExpr::symbol() {
 	CPPUNIT_ASSERT(x.height==0);
 	CPPUNIT_ASSERT(x.key==0);
 	CPPUNIT_ASSERT(strcmp(x.name,"x")==0);
-	CPPUNIT_ASSERT(x.size==1);
+	CPPUNIT_ASSERT(x.size()==1);
 	//CPPUNIT_ASSERT(x.deco.d-	bool same_mask(int, int, bool**,bool**);>dim==x.dim);
 	CPPUNIT_ASSERT(x.fathers.size()==0);
 	CPPUNIT_ASSERT(!x.is_zero());
@@ -68,7 +68,7 @@ void TestExpr::addxy01() {
 	CPPUNIT_ASSERT(e.dim==Dim::scalar());
 	CPPUNIT_ASSERT(e.height==1);
 	CPPUNIT_ASSERT(e.id==y.id+1);
-	CPPUNIT_ASSERT(e.size==3);
+	CPPUNIT_ASSERT(e.size()==3);
 	//CPPUNIT_ASSERT(e.deco.d->dim==e.dim);
 	CPPUNIT_ASSERT(x.fathers.size()==1);
 	CPPUNIT_ASSERT(&x.fathers[0]==&e);
@@ -124,7 +124,7 @@ void TestExpr::addxx01() {
 	CPPUNIT_ASSERT(e.f==&f);
 	CPPUNIT_ASSERT(e.dim==Dim::scalar());
 	CPPUNIT_ASSERT(e.height==1);
-	CPPUNIT_ASSERT(e.size==2);
+	CPPUNIT_ASSERT(e.size()==2);
 	//CPPUNIT_ASSERT(e.deco.d->dim==e.dim);
 	CPPUNIT_ASSERT(x.fathers.size()==2);
 	CPPUNIT_ASSERT(&x.fathers[0]==&e);
@@ -266,10 +266,10 @@ void TestExpr::dag01() {
 	CPPUNIT_ASSERT(e3.id==id+5);
 	CPPUNIT_ASSERT(e4.id==id+6);
 
-	CPPUNIT_ASSERT(e1.size==4);
-	CPPUNIT_ASSERT(e2.size==5);
-	CPPUNIT_ASSERT(e3.size==6);
-	CPPUNIT_ASSERT(e4.size==7);
+	CPPUNIT_ASSERT(e1.size()==4);
+	CPPUNIT_ASSERT(e2.size()==5);
+	CPPUNIT_ASSERT(e3.size()==6);
+	CPPUNIT_ASSERT(e4.size()==7);
 
 
 	CPPUNIT_ASSERT(x.fathers.size()==2);
@@ -335,7 +335,7 @@ void TestExpr::cst01() {
 	CPPUNIT_ASSERT(c.f==NULL);
 	CPPUNIT_ASSERT(c.dim==Dim::scalar());
 	CPPUNIT_ASSERT(c.height==0);
-	CPPUNIT_ASSERT(c.size==1);
+	CPPUNIT_ASSERT(c.size()==1);
 	CPPUNIT_ASSERT(!c.is_zero());
 	CPPUNIT_ASSERT(c.type()==Dim::SCALAR);
 	CPPUNIT_ASSERT(c.get_value()==5.0);
@@ -397,6 +397,36 @@ void TestExpr::cst05() {
 	delete &z2;
 }
 
+void TestExpr::cst06() {
+	const ExprConstant& c1=ExprConstant::new_scalar(Interval(1,2));
+	const ExprConstant& c2=ExprConstant::new_scalar(Interval(1,2));
+	const ExprConstant& c3=ExprConstant::new_(Domain(Dim::scalar()));
+	const ExprConstant& c4=c1.copy();
+	CPPUNIT_ASSERT(&c1!=&c2);
+	CPPUNIT_ASSERT(&c1.get_value()==&c2.get_value());
+	CPPUNIT_ASSERT(&c1.get_value()==&c4.get_value());
+	CPPUNIT_ASSERT(&c1.get_value()!=&c3.get_value());
+	delete &c1;
+	CPPUNIT_ASSERT(c2.get_value()==Interval(1,2));
+	delete &c2;
+	delete &c4;
+	const ExprConstant& c5=ExprConstant::new_scalar(Interval(1,2));
+	CPPUNIT_ASSERT(c5.get_value()==Interval(1,2));
+	delete &c3;
+	delete &c5;
+}
+
+void TestExpr::cst07() {
+	Interval x(1,2);
+	const ExprConstant& c1=ExprConstant::new_scalar(Interval(1,2));
+	const ExprConstant& c2=ExprConstant::new_(Domain(x),true);
+	CPPUNIT_ASSERT(&c2.get_value()==&x);
+	delete &c2;
+	CPPUNIT_ASSERT(c1.get_value()==Interval(1,2));
+	delete &c1;
+	CPPUNIT_ASSERT(x==Interval(1,2));
+}
+
 void TestExpr::vector01() {
 
 	const ExprSymbol& x=ExprSymbol::new_("x",Dim::row_vec(3));
@@ -414,7 +444,7 @@ void TestExpr::vector01() {
 	CPPUNIT_ASSERT(!v.row_vector());
 	CPPUNIT_ASSERT(v.nb_args==4);
 	CPPUNIT_ASSERT(v.length()==4);
-	CPPUNIT_ASSERT(v.size==5);
+	CPPUNIT_ASSERT(v.size()==5);
 	CPPUNIT_ASSERT(v.type()==Dim::MATRIX);
 	CPPUNIT_ASSERT(sameExpr(v,"(x;y;(x+y);(x+(x+y)))"));
 }
@@ -443,7 +473,7 @@ void TestExpr::index01() {
 	//CPPUNIT_ASSERT(e.deco.d->dim==e.dim);
 	CPPUNIT_ASSERT(e.dim==Dim::row_vec(4));
 	CPPUNIT_ASSERT(e.height==1);
-	CPPUNIT_ASSERT(e.size==2);
+	CPPUNIT_ASSERT(e.size()==2);
 	CPPUNIT_ASSERT(e.type()==Dim::ROW_VECTOR);
 	CPPUNIT_ASSERT(sameExpr(e,"x(2,:)"));
 	CPPUNIT_ASSERT(e.indexed_symbol());
@@ -466,7 +496,7 @@ void TestExpr::index02() {
 	CPPUNIT_ASSERT(e.f==&f);
 	//CPPUNIT_ASSERT(e.deco.d->dim==e.dim);
 	CPPUNIT_ASSERT(e.height==2);
-	CPPUNIT_ASSERT(e.size==3);
+	CPPUNIT_ASSERT(e.size()==3);
 	CPPUNIT_ASSERT(e.type()==Dim::SCALAR);
 	CPPUNIT_ASSERT(sameExpr(e,"x(2,:)(2)"));
 	CPPUNIT_ASSERT(e.indexed_symbol());
@@ -531,7 +561,7 @@ void TestExpr::apply01() {
 	CPPUNIT_ASSERT(e.f==&f2);
 	//CPPUNIT_ASSERT(e.deco.d->dim==e.dim);
 	CPPUNIT_ASSERT(e.height==2);
-	CPPUNIT_ASSERT(e.size==5);
+	CPPUNIT_ASSERT(e.size()==5);
 	CPPUNIT_ASSERT(e.type()==Dim::COL_VECTOR);
 	CPPUNIT_ASSERT(sameExpr(e,"func(x2,(A2*y2),A2)"));
 }
@@ -554,7 +584,7 @@ void TestExpr::apply03() {
 	const ExprNode& e = f3.expr();
 
 	CPPUNIT_ASSERT(e.height==2);
-	CPPUNIT_ASSERT(e.size==4);
+	CPPUNIT_ASSERT(e.size()==4);
 
 	CPPUNIT_ASSERT(sameExpr(e,"((x3+x3)-(x3*x3))"));
 	//CPPUNIT_ASSERT(sameExpr(e,"(f1(x3,x3)-f2(x3,x3))"));
@@ -670,6 +700,34 @@ void TestExpr::subnodes04() {
 }
 
 
+void TestExpr::fathers01() {
+	const ExprSymbol& x=ExprSymbol::new_("x",Dim::scalar());
+	Array<const ExprNode> e;
+	for (int i=0; i<1000; i++)
+		e.add(sqr(x));
+	CPPUNIT_ASSERT(x.fathers.size()==1000);
+	for (int i=0; i<1000; i++)
+		CPPUNIT_ASSERT(&x.fathers[i]==&e[i]);
+	for (int i=0; i<1000; i++)
+		delete &e[i];
+	delete &x;
+}
+
+void TestExpr::size01() {
+	const ExprSymbol& x=ExprSymbol::new_("x",Dim::scalar());
+	const ExprNode* e=&x;
+	const ExprNode* middle=NULL;
+	for (int i=0; i<1000; i++) {
+		e=&(*e+x);
+		if (i==499) middle=e;
+	}
+	CPPUNIT_ASSERT(e->size()==1001);
+	CPPUNIT_ASSERT(middle->size()==501);
+	const ExprNode& f=sin(*e);
+	CPPUNIT_ASSERT(f.size()==1002);
+	cleanup(Array<const ExprNode>(f),true);
+}
+
 void TestExpr::bug81() {
 	const ExprSymbol& x=ExprSymbol::new_("x",Dim::row_vec(3));
 	IntervalVector y(3);
@@ -51,6 +51,8 @@ public:
 	CPPUNIT_TEST(cst03);
 	CPPUNIT_TEST(cst04);
 	CPPUNIT_TEST(cst05);
+	CPPUNIT_TEST(cst06);
+	CPPUNIT_TEST(cst07);
 
 	CPPUNIT_TEST(vector01);
 	CPPUNIT_TEST(vector02);
@@ -71,6 +73,8 @@ public:
 	CPPUNIT_TEST(subnodes04);
 
 	CPPUNIT_TEST(bug81);
+	CPPUNIT_TEST(fathers01);
+	CPPUNIT_TEST(size01);
 	CPPUNIT_TEST_SUITE_END();
 
 	void symbol();
@@ -101,6 +105,12 @@ public:
 	void cst04();
 	void cst05();
 
+	// scalar constants with the same value share the same interval
+	void cst06();
+
+	// scalar constant built by reference
+	void cst07();
+
 	void vector01();
 	void vector02();
 
@@ -127,6 +137,12 @@ public:
 	// row vector variable + (column) vector constant
 	void bug81();
 
+	// many fathers
+	void fathers01();
+
+	// size of a long chain
+	void size01();
+
 private:
 	bool same_mask(int, int, bool*, bool**);
 };
@@ -12,6 +12,7 @@
 #include "TestExpr2DAG.h"
 #include "ibex_Expr2DAG.h"
 #include "ibex_ExprCopy.h"
+#include "ibex_ExprHashCons.h"
 #include "ibex_Function.h"
 
 using namespace std;
@@ -29,7 +30,7 @@ void TestExpr2DAG::test01() {
 	const ExprNode& e1=((x1+x2)-(x1+x2));
 	const ExprNode& e2 = Expr2DAG().transform(old_x,(Array<const ExprNode> const&) new_x,e1);
 
-	CPPUNIT_ASSERT(e1.size==5 && e2.size==4);
+	CPPUNIT_ASSERT(e1.size()==5 && e2.size()==4);
 
 }
 
@@ -44,8 +45,60 @@ void TestExpr2DAG::test02() {
 	const ExprNode& e1=(exp(x1)-(x1+x2))*exp(x1) + (exp(x1)-(x1+x2));
 	const ExprNode& e2 = Expr2DAG().transform(old_x,(Array<const ExprNode> const&) new_x,e1);
 
-	CPPUNIT_ASSERT(e2.size==7);
+	CPPUNIT_ASSERT(e2.size()==7);
 
 }
 
+void TestExpr2DAG::test03() {
+	const ExprSymbol& x=ExprSymbol::new_(Dim::col_vec(3));
+
+	Array<const ExprSymbol> old_x(x);
+	Array<const ExprSymbol> new_x(1);
+	varcopy(old_x,new_x);
+
+	// x[0]+x[1] is shared, not x[0]+x[2]
+	const ExprNode& e1=sqr(x[0]+x[1])-(x[0]+x[1])*(x[0]+x[2]);
+	const ExprNode& e2 = Expr2DAG().transform(old_x,(Array<const ExprNode> const&) new_x,e1);
+
+	CPPUNIT_ASSERT(e2.size()==9);
+}
+
+void TestExpr2DAG::test04() {
+	const ExprSymbol& x1=ExprSymbol::new_(Dim::scalar());
+	const ExprSymbol& x2=ExprSymbol::new_(Dim::scalar());
+
+	Array<const ExprSymbol> old_x(x1,x2);
+	Array<const ExprSymbol> new_x(2);
+	varcopy(old_x,new_x);
+
+	// the two constants "2" are merged, not the powers
+	const ExprNode& e1=pow(2*x1,3)+pow(2*x1,4)+(x2+2);
+	const ExprNode& e2 = Expr2DAG().transform(old_x,(Array<const ExprNode> const&) new_x,e1);
+
+	CPPUNIT_ASSERT(e1.size()==12 && e2.size()==9);
+}
+
+void TestExpr2DAG::test05() {
+	const ExprSymbol& x=ExprSymbol::new_(Dim::scalar());
+	const ExprSymbol& y=ExprSymbol::new_(Dim::scalar());
+
+	ExprHashCons h;
+	const ExprNode& e1=h.get(h.get(x)+h.get(y));
+	const ExprNode& e2=h.get(h.get(x)+h.get(y));
+	const ExprNode& e3=h.get(h.get(y)+h.get(x));
+
+	CPPUNIT_ASSERT(&e1==&e2);
+	CPPUNIT_ASSERT(&e1!=&e3);
+	CPPUNIT_ASSERT(h.size()==4);
+	// the duplicate x+y has been detached from x and y
+	CPPUNIT_ASSERT(x.fathers.size()==2 && y.fathers.size()==2);
+
+	const ExprNode& c1=h.get(ExprConstant::new_scalar(3));
+	const ExprNode& c2=h.get(ExprConstant::new_scalar(3));
+	CPPUNIT_ASSERT(&c1==&c2);
+
+	const ExprNode& e4=h.get(h.get(e1*c1)-h.get(e2*c2));
+	CPPUNIT_ASSERT(e4.size()==6);
+}
+
 } // end namespace
@@ -588,6 +588,79 @@ void TestGradient::hansen01() {
 
 }
 
+void TestGradient::hansen02() {
+	const ExprSymbol& x=ExprSymbol::new_("x",Dim::col_vec(2));
+	const ExprSymbol& y=ExprSymbol::new_("y");
+	Function f(x,y,Return(sqr(x[0])*y+sin(x[1]), x[0]+2*y, exp(x[1])*x[0], sqr(y)));
+
+	IntervalVector box(3);
+	box[0]=Interval(1,2);
+	box[1]=Interval(-1,0.5);
+	box[2]=Interval(0,3);
+
+	IntervalMatrix H(4,3);
+	f.hansen_matrix(box,H);
+
+	// the jth column is the Jacobian on (box[0],...,box[j],mid[j+1],...)
+	IntervalVector x0=box.mid();
+	IntervalMatrix J(4,3);
+	for (int j=0; j<3; j++) {
+		x0[j]=box[j];
+		f.jacobian(x0,J);
+		CPPUNIT_ASSERT(H.col(j)==J.col(j));
+	}
+}
+
+void TestGradient::hansen03() {
+	const ExprSymbol& x=ExprSymbol::new_("x",Dim::col_vec(2));
+	const ExprSymbol& y=ExprSymbol::new_("y");
+	Function f(x,y,Return(sqr(x[0])*y+sin(x[1]), x[0]+2*y, exp(x[1])*x[0]));
+
+	VarSet set(f,x);
+
+	IntervalVector box(3);
+	box[0]=Interval(1,2);
+	box[1]=Interval(-1,0.5);
+	box[2]=Interval(0,3);
+
+	IntervalMatrix H(3,2), J_param(3,1);
+	f.hansen_matrix(box,H,J_param,set);
+
+	IntervalVector x0=box.mid();
+	x0[2]=box[2];
+	IntervalMatrix J(3,3);
+	for (int j=0; j<2; j++) {
+		x0[j]=box[j];
+		f.jacobian(x0,J);
+		CPPUNIT_ASSERT(H.col(j)==J.col(j));
+	}
+	CPPUNIT_ASSERT(J_param.col(0)==J.col(2));
+}
+
+void TestGradient::hansen04() {
+	const ExprSymbol& x=ExprSymbol::new_("x",Dim::col_vec(2));
+	const ExprSymbol& y=ExprSymbol::new_("y");
+	const ExprNode& e=sqr(x[0])*y+sin(x[1]);
+	Function f(x,y,Return(e, x[0]+2*y, e));
+
+	IntervalVector box(3);
+	box[0]=Interval(1,2);
+	box[1]=Interval(-1,0.5);
+	box[2]=Interval(0,3);
+
+	IntervalMatrix H(3,3);
+	f.hansen_matrix(box,H);
+
+	IntervalVector x0=box.mid();
+	IntervalMatrix J(3,3);
+	for (int j=0; j<3; j++) {
+		x0[j]=box[j];
+		f.jacobian(x0,J);
+		CPPUNIT_ASSERT(H.col(j)==J.col(j));
+	}
+	CPPUNIT_ASSERT(H.row(0)==H.row(2));
+}
+
 void TestGradient::jacobian_components01() {
 	const ExprSymbol& x = ExprSymbol::new_("x");
 	const ExprSymbol& y = ExprSymbol::new_("y");
@@ -665,5 +738,49 @@ void TestGradient::jacobian_components02() {
 
 }
 
+void TestGradient::jacobian_sparse01() {
+	const ExprSymbol& x=ExprSymbol::new_("x",Dim::col_vec(3));
+	const ExprSymbol& y=ExprSymbol::new_("y");
+	Function f(x,y,Return(x[0]*x[1], sin(x[1])+y, 2*x[0]-x[2], y));
+
+	IntervalVector box(4);
+	box[0]=Interval(1,2);
+	box[1]=Interval(-1,0.5);
+	box[2]=Interval(0,3);
+	box[3]=Interval(-2,-1);
+
+	SparseIntervalMatrix J(4,4);
+	f.jacobian(box,J);
+
+	CPPUNIT_ASSERT(J.nnz()==7);
+	CPPUNIT_ASSERT(J.find(0,2)==-1);
+	CPPUNIT_ASSERT(J.find(1,0)==-1);
+	CPPUNIT_ASSERT(J.find(3,3)!=-1);
+	CPPUNIT_ASSERT(J.dense()==f.jacobian(box));
+
+	BitSet components=BitSet::empty(4);
+	components.add(1);
+	components.add(3);
+	f.jacobian(box,J,components);
+	CPPUNIT_ASSERT(J.nb_rows()==2);
+	CPPUNIT_ASSERT(J.nnz()==3);
+	CPPUNIT_ASSERT(J.dense()==f.jacobian(box,components));
+}
+
+void TestGradient::jacobian_sparse02() {
+	const ExprSymbol& x=ExprSymbol::new_("x",Dim::col_vec(4));
+	Function f(x,x[0]*x[2]+sqr(x[2]));
+
+	IntervalVector box(4,Interval(1,2));
+
+	SparseIntervalMatrix J(1,4);
+	f.jacobian(box,J);
+
+	CPPUNIT_ASSERT(J.nnz()==2);
+	CPPUNIT_ASSERT(J.find(0,0)!=-1);
+	CPPUNIT_ASSERT(J.find(0,2)!=-1);
+	CPPUNIT_ASSERT(J.dense().row(0)==f.gradient(box));
+}
+
 } // end namespace
 
@@ -38,6 +38,9 @@ public:
 	CPPUNIT_TEST(jac02);
 	CPPUNIT_TEST(jac03);
 	CPPUNIT_TEST(hansen01);
+	CPPUNIT_TEST(hansen02);
+	CPPUNIT_TEST(hansen03);
+	CPPUNIT_TEST(hansen04);
 	CPPUNIT_TEST(mulVV);
 	CPPUNIT_TEST(transpose01);
 	CPPUNIT_TEST(mulMV01);
@@ -45,6 +48,8 @@ public:
 	CPPUNIT_TEST(mulVM02);
 	CPPUNIT_TEST(jacobian_components01);
 	CPPUNIT_TEST(jacobian_components02);
+	CPPUNIT_TEST(jacobian_sparse01);
+	CPPUNIT_TEST(jacobian_sparse02);
 	CPPUNIT_TEST_SUITE_END();
 
 	void deco01();
@@ -59,6 +64,12 @@ public:
 	void jac02();
 	void jac03();
 	void hansen01();
+	// Hansen matrix vs. Jacobian column by column
+	void hansen02();
+	// same with a VarSet
+	void hansen03();
+	// two components with the same expression
+	void hansen04();
 
 	void mulVV();
 	// for vectors
@@ -70,6 +81,11 @@ public:
 
 	void jacobian_components01();
 	void jacobian_components02();
+
+	// vector-valued function (with a symbol as component)
+	void jacobian_sparse01();
+	// real-valued function
+	void jacobian_sparse02();
 private:
 	void check_deco(const ExprNode& e);
 };
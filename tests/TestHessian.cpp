@@ -0,0 +1,222 @@
+/* ============================================================================
+ * I B E X - Hessian Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestHessian.h"
+#include "ibex_Function.h"
+#include "ibex_Expr.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// Hessian matrix obtained by double symbolic differentiation
+IntervalMatrix symbolic_hessian(Function& f, const IntervalVector& box) {
+	return f.diff().jacobian(box);
+}
+
+}
+
+void TestHessian::hessian01() {
+	const ExprSymbol& x = ExprSymbol::new_("x");
+	const ExprSymbol& y = ExprSymbol::new_("y");
+	Function f(x,y,x*y+sin(x));
+
+	IntervalVector box(2);
+	box[0]=Interval(1,2);
+	box[1]=Interval(-1,3);
+
+	IntervalMatrix H=f.hessian(box);
+
+	CPPUNIT_ASSERT(almost_eq(H[0][0],-sin(box[0])));
+	CPPUNIT_ASSERT(H[0][1]==Interval::ONE);
+	CPPUNIT_ASSERT(H[1][0]==Interval::ONE);
+	CPPUNIT_ASSERT(H[1][1]==Interval::ZERO);
+}
+
+void TestHessian::hessian02() {
+	const ExprSymbol& x = ExprSymbol::new_("x");
+	const ExprSymbol& y = ExprSymbol::new_("y");
+	Function f(x,y,exp(x)*log(y) + sqrt(x*y) + cos(x)/(2+sin(y)) + tan(x*y) + cosh(x)*sinh(y)
+			+ tanh(x-y) + acos(x/2) + asin(y/2) + atan(x*y) + acosh(2+x*y) + asinh(x-y) + atanh(x*y/2)
+			+ pow(x+y,3) + atan2(x,y) + sqr(x-y)/y);
+
+	IntervalVector box(2);
+	box[0]=Interval(0.3);
+	box[1]=Interval(0.7);
+
+	IntervalMatrix H(2,2);
+	f.hessian(box,H);
+
+	CPPUNIT_ASSERT(almost_eq(H,symbolic_hessian(f,box),1e-8));
+}
+
+void TestHessian::hessian03() {
+	Variable x(3,"x");
+	double _A[3*3][2]={{1,1},  {2,2}, {-1,-1},
+	                   {0,0},  {3,3}, {4,4},
+	                   {-2,-2},{1,1}, {5,5}};
+	IntervalMatrix A(3,3,_A);
+
+	// vector/matrix products, transpose
+	Function f(x,transpose(x)*A*x);
+	Function g(x,transpose(x)*(A*x));
+
+	IntervalVector box(3,Interval(-1,2));
+
+	IntervalMatrix S=A+A.transpose();
+	CPPUNIT_ASSERT(f.hessian(box)==S);
+	CPPUNIT_ASSERT(g.hessian(box)==S);
+
+	// scalar by vector
+	Function h(x,transpose(x)*(x[0]*x));
+	IntervalVector pt(3);
+	pt[0]=0.5; pt[1]=-1; pt[2]=2;
+	CPPUNIT_ASSERT(almost_eq(h.hessian(pt),symbolic_hessian(h,pt),1e-10));
+
+	// matrix by matrix (trace of M^2)
+	Variable M(2,2,"M");
+	const ExprNode& M2=M*M;
+	Function k(M,M2[0][0]+M2[1][1]);
+	double _T[4*4][2]={{2,2},{0,0},{0,0},{0,0},
+	                   {0,0},{0,0},{2,2},{0,0},
+	                   {0,0},{2,2},{0,0},{0,0},
+	                   {0,0},{0,0},{0,0},{2,2}};
+	CPPUNIT_ASSERT(k.hessian(IntervalVector(4,Interval(-1,1)))==IntervalMatrix(4,4,_T));
+}
+
+void TestHessian::lagrangian() {
+	const ExprSymbol& x = ExprSymbol::new_("x");
+	const ExprSymbol& y = ExprSymbol::new_("y");
+	Function f(x,y,Return(x*y,sqr(x)+exp(y)));
+
+	IntervalVector box(2);
+	box[0]=Interval(1,2);
+	box[1]=Interval(0,1);
+
+	double _lambda[2][2]={{2,2},{3,3}};
+	IntervalVector lambda(2,_lambda);
+
+	IntervalMatrix H(2,2);
+	f.hessian_calculator().hessian(box,lambda,H);
+
+	CPPUNIT_ASSERT(H[0][0]==Interval(6));
+	CPPUNIT_ASSERT(H[0][1]==Interval(2));
+	CPPUNIT_ASSERT(H[1][0]==Interval(2));
+	CPPUNIT_ASSERT(almost_eq(H[1][1],3*exp(box[1])));
+}
+
+void TestHessian::hessian_vector() {
+	const ExprSymbol& x = ExprSymbol::new_("x",Dim::col_vec(3));
+	Function f(x,exp(x[0]*x[1])+x[2]*sin(x[1])+sqr(x[0])/x[2]);
+
+	IntervalVector pt(3);
+	pt[0]=0.5; pt[1]=-1; pt[2]=2;
+
+	double _v[3][2]={{1,1},{-2,-2},{3,3}};
+	IntervalVector v(3,_v);
+
+	IntervalVector Hv(3);
+	f.hessian_calculator().hessian_vector(pt,v,Hv);
+
+	CPPUNIT_ASSERT(almost_eq(Hv,f.hessian(pt)*v,1e-10));
+
+	// the state is reset after each call
+	f.hessian_calculator().hessian_vector(pt,v,Hv);
+	CPPUNIT_ASSERT(almost_eq(Hv,f.hessian(pt)*v,1e-10));
+	CPPUNIT_ASSERT(almost_eq(f.hessian(pt),symbolic_hessian(f,pt),1e-10));
+}
+
+void TestHessian::sparse() {
+	const ExprSymbol& x = ExprSymbol::new_("x",Dim::col_vec(5));
+	Function f(x,x[0]*x[1]+sqr(x[2])+2*x[3]-x[4]);
+
+	IntervalVector box(5,Interval(1,2));
+
+	SparseIntervalMatrix H(1,1);
+	f.hessian(box,H);
+
+	CPPUNIT_ASSERT(H.nb_rows()==5);
+	CPPUNIT_ASSERT(H.nb_cols()==5);
+	CPPUNIT_ASSERT(H.nnz()==3);
+	CPPUNIT_ASSERT(H.find(0,1)!=-1);
+	CPPUNIT_ASSERT(H.find(1,0)!=-1);
+	CPPUNIT_ASSERT(H.find(2,2)!=-1);
+	CPPUNIT_ASSERT(H.find(0,0)==-1);
+	CPPUNIT_ASSERT(H.dense()==f.hessian(box));
+	CPPUNIT_ASSERT(H.val(H.find(2,2))==Interval(2));
+}
+
+void TestHessian::convex() {
+	Variable x("x"),y("y");
+
+	IntervalVector box(2,Interval(-1,1));
+
+	Function f1(x,y,sqr(x)+sqr(y)+x*y);
+	CPPUNIT_ASSERT(f1.hessian_calculator().is_convex(box));
+
+	Function f2(x,y,x*y);
+	CPPUNIT_ASSERT(!f2.hessian_calculator().is_convex(box));
+
+	Function f3(x,y,exp(x)+sqr(y));
+	CPPUNIT_ASSERT(f3.hessian_calculator().is_convex(box));
+
+	Function f4(x,y,sin(x)+y);
+	CPPUNIT_ASSERT(!f4.hessian_calculator().is_convex(box));
+}
+
+void TestHessian::taylor() {
+	const ExprSymbol& x = ExprSymbol::new_("x");
+	const ExprSymbol& y = ExprSymbol::new_("y");
+	Function f(x,y,sin(x)+x*y);
+
+	IntervalVector box(2);
+	box[0]=Interval(0,0.5);
+	box[1]=Interval(1,2);
+	IntervalVector x0=box.mid();
+
+	Interval t=f.hessian_calculator().taylor_eval(box,x0);
+
+	for (int i=0; i<=10; i++)
+		for (int j=0; j<=10; j++) {
+			IntervalVector pt(2);
+			pt[0]=box[0].lb()+i*box[0].diam()/10;
+			pt[1]=box[1].lb()+j*box[1].diam()/10;
+			CPPUNIT_ASSERT(f.eval(pt).is_subset(t));
+		}
+}
+
+void TestHessian::empty() {
+	const ExprSymbol& x = ExprSymbol::new_("x");
+	const ExprSymbol& y = ExprSymbol::new_("y");
+	Function f(x,y,sqrt(x)*y);
+
+	IntervalVector box(2);
+	box[0]=Interval(-2,-1);
+	box[1]=Interval(1,2);
+
+	SparseIntervalMatrix H(1,1);
+	f.hessian(box,H);
+	CPPUNIT_ASSERT(H.is_empty());
+	CPPUNIT_ASSERT(f.hessian(box).is_empty());
+
+	IntervalVector Hv(2);
+	f.hessian_calculator().hessian_vector(box,IntervalVector(2,Interval(1)),Hv);
+	CPPUNIT_ASSERT(Hv.is_empty());
+
+	// back to a valid box
+	box[0]=Interval(4);
+	box[1]=Interval(2);
+	CPPUNIT_ASSERT(almost_eq(f.hessian(box),symbolic_hessian(f,box),1e-10));
+}
+
+} // end namespace
@@ -0,0 +1,59 @@
+/* ============================================================================
+ * I B E X - Hessian Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_HESSIAN_H__
+#define __TEST_HESSIAN_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestHessian : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestHessian);
+
+	CPPUNIT_TEST(hessian01);
+	CPPUNIT_TEST(hessian02);
+	CPPUNIT_TEST(hessian03);
+	CPPUNIT_TEST(lagrangian);
+	CPPUNIT_TEST(hessian_vector);
+	CPPUNIT_TEST(sparse);
+	CPPUNIT_TEST(convex);
+	CPPUNIT_TEST(taylor);
+	CPPUNIT_TEST(empty);
+	CPPUNIT_TEST_SUITE_END();
+
+	// x*y+sin(x)
+	void hessian01();
+	// all the scalar operators vs. symbolic differentiation
+	void hessian02();
+	// quadratic form with vector/matrix operators
+	void hessian03();
+	// vector-valued function with multipliers
+	void lagrangian();
+	void hessian_vector();
+	// structural pattern
+	void sparse();
+	void convex();
+	void taylor();
+	// outside the definition domain
+	void empty();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestHessian);
+
+} // end namespace
+
+#endif // __TEST_HESSIAN_H__
@@ -43,6 +43,82 @@ void TestLinear::lu_complete_underctr() {
 
 }
 
+namespace {
+
+// a (n x n) real matrix with a small diagonal (pivoting is required)
+Matrix large_matrix(int n) {
+	Matrix M(n,n);
+	for (int i=0; i<n; i++)
+		for (int j=0; j<n; j++)
+			M[i][j]=(i==j)? 0.1 : ::sin(i+2.0*j);
+	return M;
+}
+
+} // end anonymous namespace
+
+void TestLinear::lu_partial_large() {
+	int n=40;
+	Matrix M=large_matrix(n);
+	Matrix LU(n,n);
+	int p[40];
+	real_LU(M,LU,p);
+
+	// check that L*U is the permuted matrix
+	for (int i=0; i<n; i++) {
+		for (int j=0; j<n; j++) {
+			double lu=0;
+			for (int k=0; k<=i && k<=j; k++)
+				lu+=(k==i? 1 : LU[p[i]][k])*LU[p[k]][j];
+			CPPUNIT_ASSERT(fabs(lu-M[p[i]][j])<1e-10);
+		}
+		// partial pivoting
+		CPPUNIT_ASSERT(i==0 || fabs(LU[p[i]][0])<=1);
+	}
+}
+
+void TestLinear::real_inverse_large() {
+	int n=40;
+	Matrix M=large_matrix(n);
+	Matrix invM(n,n);
+	real_inverse(M,invM);
+	CPPUNIT_ASSERT(almost_eq(IntervalMatrix(M*invM),IntervalMatrix(Matrix::eye(n)),1e-10));
+
+	M[3]=M[5];
+	CPPUNIT_ASSERT_THROW(real_inverse(M,invM),SingularMatrixException);
+}
+
+void TestLinear::neumaier_inverse_large() {
+	int n=40;
+	Matrix M=large_matrix(n);
+	IntervalMatrix A(M);
+	A.inflate(1e-6);
+	IntervalMatrix invA(n,n);
+	neumaier_inverse(A,invA);
+
+	// invA contains the inverse of M
+	IntervalMatrix I=invA*IntervalMatrix(M);
+	for (int i=0; i<n; i++)
+		for (int j=0; j<n; j++)
+			CPPUNIT_ASSERT(I[i][j].contains(i==j? 1 : 0));
+}
+
+void TestLinear::precond_large() {
+	int n=40;
+	Matrix M=large_matrix(n);
+	Vector x(n);
+	for (int i=0; i<n; i++) x[i]=i+1;
+	IntervalMatrix A(M);
+	IntervalVector b=A*x;
+
+	precond(A,b);
+	CPPUNIT_ASSERT(almost_eq(A,IntervalMatrix(Matrix::eye(n)),1e-10));
+
+	IntervalVector x2(n,Interval(-100,100));
+	gauss_seidel(A,b,x2);
+	CPPUNIT_ASSERT(x2.contains(x));
+	CPPUNIT_ASSERT(x2.max_diam()<1e-6);
+}
+
 void TestLinear::inflating_gauss_seidel01() {
 	int n=4;
 	Matrix A=(n+1)*Matrix::eye(n)-Matrix::ones(n); // diagonally dominant matrix
@@ -93,6 +169,72 @@ void TestLinear::inflating_gauss_seidel03() {
 	CPPUNIT_ASSERT(!ret);
 }
 
+void TestLinear::gauss_seidel_sparse01() {
+	int n=10;
+	IntervalMatrix A(n,n,Interval::ZERO);
+	for (int i=0; i<n; i++) {
+		A[i][i]=Interval(4,4.1);
+		if (i>0) A[i][i-1]=Interval(-1.1,-1);
+		if (i<n-1) A[i][i+1]=Interval(-1,-0.9);
+	}
+	IntervalVector b(n,Interval(1,1.1));
+
+	IntervalVector x1(n,Interval(-10,10));
+	gauss_seidel(A,b,x1);
+
+	IntervalVector x2(n,Interval(-10,10));
+	gauss_seidel(SparseIntervalMatrix(A),b,x2);
+
+	CPPUNIT_ASSERT(x1==x2);
+}
+
+void TestLinear::precond_sparse01() {
+	int n=10;
+	IntervalMatrix A(n,n,Interval::ZERO);
+	Vector x(n);
+	for (int i=0; i<n; i++) {
+		A[i][i]=1;       // small diagonal (pivoting is required)
+		if (i>0) A[i][i-1]=3;
+		if (i<n-1) A[i][i+1]=-2;
+		x[i]=i+1;
+	}
+	IntervalVector b=A*x;
+
+	SparseIntervalMatrix S(A);
+	precond(S,b);
+
+	CPPUNIT_ASSERT(almost_eq(S.dense(),Matrix::eye(n),1e-10));
+
+	IntervalVector x2(n,Interval(-100,100));
+	gauss_seidel(S,b,x2);
+	CPPUNIT_ASSERT(x2.contains(x));
+	CPPUNIT_ASSERT(x2.max_diam()<1e-8);
+}
+
+void TestLinear::precond_sparse02() {
+	int n=10;
+	IntervalMatrix A(n,n,Interval::ZERO);
+	for (int i=0; i<n; i+=2) {
+		A[i][i]=Interval(1,1.1);
+		A[i][i+1]=Interval(2,2.1);
+		A[i+1][i]=Interval(-1,-0.9);
+		A[i+1][i+1]=Interval(3,3.1);
+	}
+	IntervalVector b(n,Interval(-1,1));
+
+	SparseIntervalMatrix S(A);
+	precond(S,b);
+
+	CPPUNIT_ASSERT(S.nnz()<=2*n);
+	for (int i=0; i<n; i++)
+		for (int k=S.row_begin(i); k<S.row_end(i); k++)
+			CPPUNIT_ASSERT(S.col(k)/2==i/2);
+
+	// midpoint preconditioning
+	for (int i=0; i<n; i++)
+		CPPUNIT_ASSERT(S(i,i).contains(1));
+}
+
 void TestLinear::det01() {
     double _tab[] = { 1, 3, 2, 9, 4, 5, 6, 8, 7 };
     Matrix M1(3,3,_tab);
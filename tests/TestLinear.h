@@ -24,9 +24,16 @@ public:
 
 	CPPUNIT_TEST_SUITE(TestLinear);
 	CPPUNIT_TEST(lu_partial_underctr);
+	CPPUNIT_TEST(lu_partial_large);
+	CPPUNIT_TEST(real_inverse_large);
+	CPPUNIT_TEST(neumaier_inverse_large);
+	CPPUNIT_TEST(precond_large);
 	CPPUNIT_TEST(inflating_gauss_seidel01);
 	CPPUNIT_TEST(inflating_gauss_seidel02);
 	CPPUNIT_TEST(inflating_gauss_seidel03);
+	CPPUNIT_TEST(gauss_seidel_sparse01);
+	CPPUNIT_TEST(precond_sparse01);
+	CPPUNIT_TEST(precond_sparse02);
 	CPPUNIT_TEST(det01);
 	CPPUNIT_TEST(det02);
 	CPPUNIT_TEST(is_posdef_sylvester01);
@@ -38,6 +45,12 @@ public:
 	void lu_complete_underctr();
 	void lu_complete_overctr();
 
+	// large matrices (LAPACK/BLAS is used if available)
+	void lu_partial_large();
+	void real_inverse_large();
+	void neumaier_inverse_large();
+	void precond_large();
+
 	// convergence, start with degenerated vector
 	void inflating_gauss_seidel01();
 	// convergence, start with thick vector
@@ -45,6 +58,13 @@ public:
 	// divergence, start with thick vector
 	void inflating_gauss_seidel03();
 
+	// same result as the dense version
+	void gauss_seidel_sparse01();
+	// tridiagonal real matrix
+	void precond_sparse01();
+	// block-diagonal matrix: no fill-in between blocks
+	void precond_sparse02();
+
 	void det01();
 	void det02();
 
@@ -0,0 +1,153 @@
+/* ============================================================================
+ * I B E X - Midpoint-radius interval matrix products Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestMidRadArith.h"
+#include "ibex_MidRadArith.h"
+
+using namespace std;
+
+namespace {
+
+// Entries are small integers so that all the products and sums of the
+// tests are exact: the product of sampled real matrices is then known
+// exactly and must belong to the result.
+
+// deterministic pseudo-random generator (integers in [-50,50])
+int next(unsigned int& seed) {
+	seed = seed*1103515245+12345;
+	return (int) ((seed/65536) % 101)-50;
+}
+
+Matrix random_real(int m, int n, unsigned int& seed) {
+	Matrix A(m,n);
+	for (int i=0; i<m; i++)
+		for (int j=0; j<n; j++) A[i][j]=next(seed);
+	return A;
+}
+
+IntervalMatrix random_itv(int m, int n, unsigned int& seed) {
+	IntervalMatrix A(m,n);
+	for (int i=0; i<m; i++)
+		for (int j=0; j<n; j++) {
+			int a=next(seed);
+			int b=next(seed);
+			A[i][j]=a<b? Interval(a,b) : Interval(b,a);
+		}
+	return A;
+}
+
+// a real matrix in A (lower bound, upper bound or midpoint of each entry)
+Matrix sample(const IntervalMatrix& A, unsigned int& seed) {
+	Matrix M(A.nb_rows(),A.nb_cols());
+	for (int i=0; i<A.nb_rows(); i++)
+		for (int j=0; j<A.nb_cols(); j++) {
+			int c=(next(seed)+50)%3;
+			M[i][j]=c==0? A[i][j].lb() : (c==1? A[i][j].ub() : A[i][j].mid());
+		}
+	return M;
+}
+
+bool contains(const IntervalMatrix& A, const Matrix& M) {
+	for (int i=0; i<A.nb_rows(); i++)
+		for (int j=0; j<A.nb_cols(); j++)
+			if (!A[i][j].contains(M[i][j])) return false;
+	return true;
+}
+
+// diam(A[i][j])<=ratio*diam(B[i][j]) (+ the rounding errors)
+bool sharp(const IntervalMatrix& A, const IntervalMatrix& B, double ratio) {
+	for (int i=0; i<A.nb_rows(); i++)
+		for (int j=0; j<A.nb_cols(); j++)
+			if (A[i][j].diam()>ratio*B[i][j].diam()+1e-10*B[i][j].mag()+1e-10)
+				return false;
+	return true;
+}
+
+// the last size exceeds the block sizes of usual BLAS kernels
+const int sizes[][3] = { {1,1,1}, {3,5,2}, {13,7,9}, {40,70,30} };
+
+const int nb_sizes = 4;
+
+}
+
+void TestMidRadArith::real_interval() {
+	unsigned int seed=1;
+	for (int s=0; s<nb_sizes; s++) {
+		Matrix A=random_real(sizes[s][0],sizes[s][1],seed);
+		IntervalMatrix B=random_itv(sizes[s][1],sizes[s][2],seed);
+		IntervalMatrix C=midrad_mul(A,B);
+		for (int k=0; k<5; k++)
+			CPPUNIT_ASSERT(contains(C,A*sample(B,seed)));
+		CPPUNIT_ASSERT(sharp(C,A*B,1));
+	}
+}
+
+void TestMidRadArith::interval_real() {
+	unsigned int seed=2;
+	for (int s=0; s<nb_sizes; s++) {
+		IntervalMatrix A=random_itv(sizes[s][0],sizes[s][1],seed);
+		Matrix B=random_real(sizes[s][1],sizes[s][2],seed);
+		IntervalMatrix C=midrad_mul(A,B);
+		for (int k=0; k<5; k++)
+			CPPUNIT_ASSERT(contains(C,sample(A,seed)*B));
+		CPPUNIT_ASSERT(sharp(C,A*B,1));
+	}
+}
+
+void TestMidRadArith::interval_interval() {
+	unsigned int seed=3;
+	for (int s=0; s<nb_sizes; s++) {
+		IntervalMatrix A=random_itv(sizes[s][0],sizes[s][1],seed);
+		IntervalMatrix B=random_itv(sizes[s][1],sizes[s][2],seed);
+		IntervalMatrix C=midrad_mul(A,B);
+		for (int k=0; k<5; k++)
+			CPPUNIT_ASSERT(contains(C,sample(A,seed)*sample(B,seed)));
+		CPPUNIT_ASSERT(sharp(C,A*B,1.5));
+	}
+}
+
+void TestMidRadArith::rounding() {
+	// 1+1e-20 is not a double: the result must contain it
+	double _A[2]={1,1e-20};
+	Matrix A(1,2,_A);
+	IntervalMatrix B(2,1,Interval::ONE);
+	IntervalMatrix C=midrad_mul(A,B);
+	CPPUNIT_ASSERT(C[0][0].lb()<=1);
+	CPPUNIT_ASSERT(C[0][0].ub()>1);
+	CPPUNIT_ASSERT(C[0][0].diam()<1e-14);
+
+	// subnormal numbers
+	double tiny=1e-310;
+	double _D[2]={tiny,tiny};
+	Matrix D(1,2,_D);
+	IntervalMatrix E(2,1,Interval(0.5));
+	IntervalMatrix F=midrad_mul(D,E);
+	CPPUNIT_ASSERT(F[0][0].contains(tiny));
+}
+
+void TestMidRadArith::unbounded() {
+	unsigned int seed=4;
+	Matrix A=random_real(3,4,seed);
+	IntervalMatrix B=random_itv(4,2,seed);
+	B[1][1]=Interval::POS_REALS;
+	CPPUNIT_ASSERT(midrad_mul(A,B)==A*B);
+	CPPUNIT_ASSERT(midrad_mul(IntervalMatrix(A),B)==IntervalMatrix(A)*B);
+
+	B.set_empty();
+	CPPUNIT_ASSERT(midrad_mul(A,B).is_empty());
+
+	// overflow
+	Matrix M(1,2);
+	M[0][0]=1e300;
+	M[0][1]=1e300;
+	IntervalMatrix N(2,1,Interval(1e300,2e300));
+	CPPUNIT_ASSERT(midrad_mul(M,N)[0][0]==Interval::ALL_REALS);
+}
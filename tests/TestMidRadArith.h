@@ -0,0 +1,41 @@
+/* ============================================================================
+ * I B E X - Midpoint-radius interval matrix products Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_MID_RAD_ARITH_H__
+#define __TEST_MID_RAD_ARITH_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+using namespace ibex;
+
+class TestMidRadArith : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestMidRadArith);
+		CPPUNIT_TEST(real_interval);
+		CPPUNIT_TEST(interval_real);
+		CPPUNIT_TEST(interval_interval);
+		CPPUNIT_TEST(rounding);
+		CPPUNIT_TEST(unbounded);
+	CPPUNIT_TEST_SUITE_END();
+
+	void real_interval();
+	void interval_real();
+	void interval_interval();
+	void rounding();
+	void unbounded();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestMidRadArith);
+
+#endif // __TEST_MID_RAD_ARITH_H__
@@ -0,0 +1,317 @@
+/* ============================================================================
+ * I B E X - Model file Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestModelFile.h"
+#include "ibex_ModelFile.h"
+#include "ibex_ModelCache.h"
+#include "ibex_SystemFactory.h"
+
+#include <sstream>
+#include <fstream>
+#include <cstdio>
+
+using namespace std;
+
+#define TMP_FILE_NAME "__tmp__.txt"
+
+namespace {
+
+// a function with all types of nodes (except applications)
+// and subexpressions shared
+Function* fex() {
+	Variable x(3,"x");
+	Variable A(2,3,"A");
+	Variable y("y");
+
+	IntervalMatrix M(2,3);
+	for (int i=0; i<2; i++)
+		for (int j=0; j<3; j++) M[i][j]=Interval(i-j,i+j+0.1);
+
+	const ExprNode& Ax=(A+ExprConstant::new_matrix(M))*x;
+
+	Array<const ExprNode> c;
+	c.add(Ax[0]);
+	c.add(Ax[1]);
+	c.add(sqr(y)+pow(x[0],3));
+	c.add(atan2(x[1],y)/(y+ExprConstant::new_scalar(Interval(-1,POS_INFINITY))));
+	c.add(max(y,x[2])-min(abs(y),sign(x[0])));
+	c.add(chi(y,x[0],x[1]));
+	c.add(exp(log(sqrt(y)))*cos(sin(tan(y))));
+	c.add(cosh(sinh(tanh(y)))*acos(asin(atan(y))));
+	c.add(acosh(y)+asinh(y)+atanh(-y));
+	c.add(transpose(x)*x);
+	c.add(ExprIndex::new_(A,DoubleIndex::one_row(Dim::matrix(2,3),1))*x);
+	c.add(ExprVector::new_row(y,x[2])*ExprVector::new_col(x[0],y));
+
+	return new Function(x,A,y,ExprVector::new_col(c),"f");
+}
+
+System* sysex() {
+	SystemFactory fac;
+	Variable x(3,"x");
+	Variable A(3,3,"A");
+	Variable y("y");
+
+	fac.add_var(x,IntervalVector(3,Interval(-1,1)));
+	fac.add_var(A);
+	fac.add_var(y,Interval(0,10));
+	fac.add_goal(y-cos(x[1]));
+	IntervalVector a(3,Interval(-0.5,0.5));
+	fac.add_ctr(A*x=a);
+	fac.add_ctr(y>=x[0]);
+	fac.add_ctr(sqr(x[2])+y<=1);
+	fac.add_ctr(x[0]-x[1]=0);
+
+	return new System(fac);
+}
+
+// note: Function::minibex() cannot be compared as the temporary
+// variables it introduces depend on dead nodes (e.g., after ExprDiff)
+// names are not compared if "names" is false (automatically generated
+// names of normalized/extended systems built separately differ)
+bool same_function(const Function& f1, const Function& f2, bool names=true) {
+	if ((names && strcmp(f1.name,f2.name)!=0) || f1.nb_arg()!=f2.nb_arg() || f1.nb_nodes()!=f2.nb_nodes())
+		return false;
+	for (int i=0; i<f1.nb_arg(); i++)
+		if (strcmp(f1.arg(i).name,f2.arg(i).name)!=0 || f1.arg(i).dim!=f2.arg(i).dim) return false;
+	return sameExpr(f1.expr(),f2.expr());
+}
+
+bool same_system(const System& sys1, const System& sys2, bool names=true) {
+	if (sys1.nb_var!=sys2.nb_var || sys1.nb_ctr!=sys2.nb_ctr) return false;
+	if (sys1.box!=sys2.box) return false;
+	if (sys1.args.size()!=sys2.args.size()) return false;
+	for (int i=0; i<sys1.args.size(); i++)
+		if (strcmp(sys1.args[i].name,sys2.args[i].name)!=0 || sys1.args[i].dim!=sys2.args[i].dim) return false;
+	if ((sys1.goal==NULL) != (sys2.goal==NULL)) return false;
+	if (sys1.goal && !same_function(*sys1.goal,*sys2.goal,names)) return false;
+	if (sys1.nb_ctr>0) {
+		if (!same_function(sys1.f_ctrs,sys2.f_ctrs,names)) return false;
+		if (&sys2.args[0]!=&sys2.f_ctrs.arg(0)) return false;
+		for (int i=0; i<sys1.f_ctrs.image_dim(); i++)
+			if (sys1.ops[i]!=sys2.ops[i]) return false;
+	}
+	for (int i=0; i<sys1.nb_ctr; i++)
+		if (sys1.ctrs[i].op!=sys2.ctrs[i].op || !same_function(sys1.ctrs[i].f,sys2.ctrs[i].f,names)) return false;
+	return true;
+}
+
+System* copy(const System& sys) {
+	stringstream s;
+	ModelFile::write(s,sys);
+	return ModelFile::read_system(s);
+}
+
+}
+
+void TestModelFile::function() {
+	Function* f=fex();
+	stringstream s;
+	ModelFile::write(s,*f);
+	Function* g=ModelFile::read_function(s);
+
+	CPPUNIT_ASSERT(same_function(*f,*g));
+
+	IntervalVector box(f->nb_var(),Interval(0.1,0.5));
+	CPPUNIT_ASSERT(f->eval_vector(box)==g->eval_vector(box));
+
+	delete g;
+	delete f;
+}
+
+void TestModelFile::diff() {
+	Variable x("x"),y("y");
+	Function f(x,y,ExprVector::new_col(x*y-sin(x),pow(x,3)));
+
+	// not computed: not saved
+	stringstream s1;
+	ModelFile::write(s1,f);
+	Function* g=ModelFile::read_function(s1);
+	CPPUNIT_ASSERT(same_function(f,*g));
+	delete g;
+
+	stringstream s2;
+	ModelFile::write(s2,f,true);
+	g=ModelFile::read_function(s2);
+	CPPUNIT_ASSERT(same_function(f.diff(),g->diff()));
+	CPPUNIT_ASSERT(same_function(f.diff(),g->diff()));
+	delete g;
+
+	// computed: saved
+	stringstream s3;
+	ModelFile::write(s3,f);
+	g=ModelFile::read_function(s3);
+	CPPUNIT_ASSERT(same_function(f.diff(),g->diff()));
+	delete g;
+}
+
+void TestModelFile::linear_part() {
+	Function* f=fex();
+
+	// not computed: not saved
+	stringstream s1;
+	ModelFile::write(s1,*f);
+
+	f->deriv_calculator();
+	stringstream s2;
+	ModelFile::write(s2,*f);
+	CPPUNIT_ASSERT(s2.str().size()>s1.str().size());
+
+	Function* g=ModelFile::read_function(s2);
+	// restored (not recalculated): saved again
+	stringstream s3;
+	ModelFile::write(s3,*g);
+	CPPUNIT_ASSERT(s3.str()==s2.str());
+
+	const Gradient& df=f->deriv_calculator();
+	const Gradient& dg=g->deriv_calculator();
+	CPPUNIT_ASSERT(dg.coeff_matrix==df.coeff_matrix);
+	for (int i=0; i<f->image_dim(); i++)
+		CPPUNIT_ASSERT(dg.is_linear[i]==df.is_linear[i]);
+
+	IntervalVector box(f->nb_var(),Interval(0.1,0.5));
+	CPPUNIT_ASSERT(g->jacobian(box)==f->jacobian(box));
+
+	delete g;
+	delete f;
+}
+
+void TestModelFile::system() {
+	System* sys=sysex();
+	System* sys2=copy(*sys);
+	CPPUNIT_ASSERT(dynamic_cast<NormalizedSystem*>(sys2)==NULL);
+	CPPUNIT_ASSERT(same_system(*sys,*sys2));
+	delete sys2;
+	delete sys;
+
+	// no constraint
+	SystemFactory fac;
+	Variable x(2,"x");
+	fac.add_var(x);
+	fac.add_goal(x[0]+x[1]);
+	sys=new System(fac);
+	sys2=copy(*sys);
+	CPPUNIT_ASSERT(same_system(*sys,*sys2));
+	delete sys2;
+	delete sys;
+}
+
+void TestModelFile::normalized() {
+	System* sys=sysex();
+	NormalizedSystem norm(*sys,1e-5);
+	System* norm2=copy(norm);
+	CPPUNIT_ASSERT(dynamic_cast<NormalizedSystem*>(norm2)!=NULL);
+	CPPUNIT_ASSERT(dynamic_cast<ExtendedSystem*>(norm2)==NULL);
+	CPPUNIT_ASSERT(same_system(norm,*norm2));
+
+	IntervalVector box(norm.nb_var,Interval(0.1,0.5));
+	CPPUNIT_ASSERT(norm.ctrs_eval(box)==norm2->ctrs_eval(box));
+	CPPUNIT_ASSERT(norm.ctrs_jacobian(box)==norm2->ctrs_jacobian(box));
+
+	delete norm2;
+	delete sys;
+}
+
+void TestModelFile::extended() {
+	System* sys=sysex();
+	ExtendedSystem ext(*sys,1e-5);
+	System* ext2=copy(ext);
+	CPPUNIT_ASSERT(dynamic_cast<ExtendedSystem*>(ext2)!=NULL);
+	CPPUNIT_ASSERT(((ExtendedSystem*) ext2)->goal_var()==ext.goal_var());
+	CPPUNIT_ASSERT(same_system(ext,*ext2));
+	delete ext2;
+	delete sys;
+}
+
+void TestModelFile::corrupted() {
+	System* sys=sysex();
+	sys->f_ctrs.deriv_calculator(); // saved too
+	stringstream s;
+	ModelFile::write(s,*sys);
+	string data=s.str();
+
+	// a function is not a system
+	stringstream s2;
+	ModelFile::write(s2,sys->f_ctrs);
+	CPPUNIT_ASSERT_THROW(ModelFile::read_system(s2),ModelFileException);
+
+	// truncated files
+	for (size_t n=0; n<data.size(); n+=7) {
+		stringstream s3(data.substr(0,n));
+		CPPUNIT_ASSERT_THROW(ModelFile::read_system(s3),ModelFileException);
+	}
+
+	// other version
+	string data2=data;
+	data2[8]++;
+	stringstream s4(data2);
+	CPPUNIT_ASSERT_THROW(ModelFile::read_system(s4),ModelFileException);
+
+	// function applications cannot be written
+	Variable x("x"),y("y");
+	Function g(x,sqr(x));
+	Function h(y,ExprApply::new_(g,Array<const ExprNode>(y))+1);
+	stringstream s5;
+	CPPUNIT_ASSERT_THROW(ModelFile::write(s5,h),ModelFileException);
+
+	delete sys;
+}
+
+void TestModelFile::cache() {
+	// not a Minibex file: the system must be loaded without parsing
+	ofstream outfile(TMP_FILE_NAME);
+	outfile << "not parsed" << endl;
+	outfile.close();
+
+	string key=ModelCache::hash(TMP_FILE_NAME);
+	CPPUNIT_ASSERT(key.size()==16);
+
+	System* sys=sysex();
+	ModelFile::save(*sys,("./"+key+".ibx").c_str());
+
+	{
+		ModelCache cache(".");
+		System& sys2=cache.system(TMP_FILE_NAME);
+		CPPUNIT_ASSERT(same_system(*sys,sys2));
+		CPPUNIT_ASSERT(&cache.system(TMP_FILE_NAME)==&sys2);
+
+		// built from sys2 and saved
+		ExtendedSystem& ext=cache.extended_system(TMP_FILE_NAME,1e-5);
+		CPPUNIT_ASSERT(same_system(ExtendedSystem(*sys,1e-5),ext,false));
+		CPPUNIT_ASSERT(&cache.extended_system(TMP_FILE_NAME,1e-5)==&ext);
+		CPPUNIT_ASSERT(&cache.extended_system(TMP_FILE_NAME,1e-6)!=&ext);
+		CPPUNIT_ASSERT(&cache.normalized_system(TMP_FILE_NAME,1e-5)!=&ext);
+	}
+
+	// saved files
+	remove(("./"+key+".ibx").c_str());
+	{
+		ModelCache cache(".");
+		ExtendedSystem& ext=cache.extended_system(TMP_FILE_NAME,1e-5);
+		CPPUNIT_ASSERT(same_system(ExtendedSystem(*sys,1e-5),ext,false));
+		NormalizedSystem& norm=cache.normalized_system(TMP_FILE_NAME,1e-5);
+		CPPUNIT_ASSERT(same_system(NormalizedSystem(*sys,1e-5),norm,false));
+		CPPUNIT_ASSERT(dynamic_cast<ExtendedSystem*>(&norm)==NULL);
+	}
+
+	double eps[2]={1e-5,1e-6};
+	for (int i=0; i<2; i++) {
+		unsigned long long bits;
+		memcpy(&bits,&eps[i],sizeof(bits));
+		char hex[17];
+		sprintf(hex,"%016llx",bits);
+		CPPUNIT_ASSERT(remove(("./"+key+"-e"+hex+".ibx").c_str())==0);
+		if (i==0) CPPUNIT_ASSERT(remove(("./"+key+"-n"+hex+".ibx").c_str())==0);
+	}
+
+	remove(TMP_FILE_NAME);
+	delete sys;
+}
@@ -0,0 +1,47 @@
+/* ============================================================================
+ * I B E X - Model file Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_MODEL_FILE_H__
+#define __TEST_MODEL_FILE_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+using namespace ibex;
+
+class TestModelFile : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestModelFile);
+		CPPUNIT_TEST(function);
+		CPPUNIT_TEST(diff);
+		CPPUNIT_TEST(linear_part);
+		CPPUNIT_TEST(system);
+		CPPUNIT_TEST(normalized);
+		CPPUNIT_TEST(extended);
+		CPPUNIT_TEST(corrupted);
+		CPPUNIT_TEST(cache);
+	CPPUNIT_TEST_SUITE_END();
+
+	void function();
+	void diff();
+	void linear_part();
+	void system();
+	void normalized();
+	void extended();
+	void corrupted();
+	void cache();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestModelFile);
+
+#endif // __TEST_MODEL_FILE_H__
@@ -9,6 +9,7 @@
 
 #include "TestSeparator.h"
 #include "ibex_Function.h"
+#include "ibex_ParallelGroups.h"
 
 using namespace std;
 
@@ -124,6 +125,82 @@ void TestSeparator::test_SepQInter(){
   }
 }
 
+void TestSeparator::test_SepQInter_threads(){
+  // range measurements from 20 beacons (the last 4 are outliers)
+  const int p=20;
+  Variable x,y;
+  Array<Function> f(p);
+  Array<Sep> arraySep(p);
+  for (int i = 0; i < p; i++){
+    double ax = 10*std::cos(0.3*i), ay = 10*std::sin(0.3*i);
+    double d = std::sqrt((ax-1)*(ax-1) + (ay-2)*(ay-2)) + (i>=p-4? 5 : 0);
+    f.set_ref(i, *new Function(x,y,sqrt(sqr(x-ax) + sqr(y-ay))));
+    arraySep.set_ref(i, *new SepFwdBwd(f[i],Interval(d-0.1,d+0.1)));
+  }
+
+  SepQInter sep1(arraySep, 4);
+  SepQInter sep4(arraySep, 4, 4);
+
+  for (int k = 0; k < 10; k++){
+    IntervalVector box(2,Interval(-10+k,10-0.5*k));
+    IntervalVector box_in1(box), box_out1(box), box_in4(box), box_out4(box);
+    sep1.separate(box_in1, box_out1);
+    sep4.separate(box_in4, box_out4);
+    CPPUNIT_ASSERT(box_in1 == box_in4);
+    CPPUNIT_ASSERT(box_out1 == box_out4);
+  }
+
+  for (int i = 0; i < p; i++){
+    delete &arraySep[i];
+    delete &f[i];
+  }
+}
+
+void TestSeparator::test_SepQInter_shared(){
+  // 4 range measurements from each of 5 beacons (the same function for
+  // all the measurements of a beacon), the last one is an outlier
+  const int nb=5, m=4, p=nb*m;
+  Variable x,y;
+  Array<Function> f(nb);
+  Array<Sep> arraySep(p);
+  for (int i = 0; i < nb; i++){
+    double ax = 10*std::cos(1.2*i), ay = 10*std::sin(1.2*i);
+    f.set_ref(i, *new Function(x,y,sqrt(sqr(x-ax) + sqr(y-ay))));
+    double d = std::sqrt((ax-1)*(ax-1) + (ay-2)*(ay-2));
+    for (int j = 0; j < m; j++)
+      arraySep.set_ref(j*nb+i, *new SepFwdBwd(f[i],Interval(d-0.1*(j+1),d+0.1*(j+1)) + (j==m-1? 3 : 0)));
+  }
+
+  CPPUNIT_ASSERT(ParallelGroups(arraySep).size()==nb);
+
+  // all the separators in one group
+  Array<Sep> arraySep0(m);
+  for (int j = 0; j < m; j++)
+    arraySep0.set_ref(j, arraySep[j*nb]);
+  CPPUNIT_ASSERT(ParallelGroups(arraySep0).size()==1);
+
+  SepQInter sep1(arraySep, nb);
+  SepQInter sep4(arraySep, nb, 4);
+
+  for (int k = 0; k < 10; k++){
+    IntervalVector box(2,Interval(-10+k,10-0.5*k));
+    IntervalVector box_in1(box), box_out1(box);
+    sep1.separate(box_in1, box_out1);
+    // several times, to detect a possible race
+    for (int r = 0; r < 50; r++){
+      IntervalVector box_in4(box), box_out4(box);
+      sep4.separate(box_in4, box_out4);
+      CPPUNIT_ASSERT(box_in1 == box_in4);
+      CPPUNIT_ASSERT(box_out1 == box_out4);
+    }
+  }
+
+  for (int i = 0; i < p; i++)
+    delete &arraySep[i];
+  for (int i = 0; i < nb; i++)
+    delete &f[i];
+}
+
 void TestSeparator::test_SepInverse(){
   Variable x,y;
   Function f = Function("x","y","(x+3, y-2)");
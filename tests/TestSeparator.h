@@ -38,6 +38,8 @@ public:
 	CPPUNIT_TEST(test_SepUnionInter);
 	CPPUNIT_TEST(test_SepNot);
 	CPPUNIT_TEST(test_SepQInter);
+	CPPUNIT_TEST(test_SepQInter_threads);
+	CPPUNIT_TEST(test_SepQInter_shared);
 	CPPUNIT_TEST(test_SepInverse);
 	CPPUNIT_TEST_SUITE_END();
 
@@ -47,6 +49,9 @@ public:
 	void test_SepUnionInter();
 	void test_SepNot();
 	void test_SepQInter();
+	void test_SepQInter_threads();
+	// parallel separation with separators sharing the same function
+	void test_SepQInter_shared();
 	void test_SepInverse();
 
 };
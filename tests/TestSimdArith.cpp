@@ -0,0 +1,271 @@
+/* ============================================================================
+ * I B E X - Bulk (SIMD) interval operations Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestSimdArith.h"
+#include "ibex_SimdArith.h"
+#include "ibex_IntervalMatrix.h"
+
+using namespace std;
+
+namespace {
+
+const SimdBackend backends[] = { SIMD_SCALAR, SIMD_AVX2, SIMD_AVX512 };
+
+const int nb_backends = 3;
+
+// sizes are chosen so that the remainder loops, the plain loop
+// used for small sizes and the packing by chunks are exercised
+const int sizes[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 127, 128, 129, 300 };
+
+const int nb_sizes = 17;
+
+// sizes of matrices
+const int N = 13;
+
+// deterministic pseudo-random generator
+double next(unsigned int& seed) {
+	seed = seed*1103515245+12345;
+	return ((double) ((seed/65536) % 32768))/3.0-5000.0;
+}
+
+Interval random_itv(unsigned int& seed) {
+	double a=next(seed);
+	double b=next(seed);
+	return a<b? Interval(a,b) : Interval(b,a);
+}
+
+IntervalVector random_vec(int n, unsigned int& seed) {
+	IntervalVector x(n);
+	for (int i=0; i<n; i++) x[i]=random_itv(seed);
+	return x;
+}
+
+Vector random_real_vec(int n, unsigned int& seed) {
+	Vector a(n);
+	for (int i=0; i<n; i++) a[i]=(i%4==3)? 0 : next(seed);
+	return a;
+}
+
+bool same(const IntervalVector& x, const IntervalVector& y) {
+	if (x.size()!=y.size()) return false;
+	for (int i=0; i<x.size(); i++)
+		if (x[i].lb()!=y[i].lb() || x[i].ub()!=y[i].ub()) return false;
+	return true;
+}
+
+/*
+ * Select the backend b. Return false if b is not supported
+ * by the processor (the test is then skipped for b).
+ */
+bool select(SimdBackend b) {
+	return simd_set_backend(b)==b;
+}
+
+/* restore the best backend at the end of a test */
+class BestBackend {
+public:
+	~BestBackend() { simd_set_backend(SIMD_AVX512); }
+};
+
+}
+
+void TestSimdArith::add_sub() {
+	BestBackend _b;
+	for (int k=0; k<nb_backends; k++) {
+		if (!select(backends[k])) continue;
+		unsigned int seed=1;
+		for (int t=0; t<nb_sizes; t++) {
+			int n=sizes[t];
+			IntervalVector x=random_vec(n,seed);
+			IntervalVector y=random_vec(n,seed);
+			IntervalVector s(x), d(x);
+			simd_add(&s[0],&y[0],n);
+			simd_sub(&d[0],&y[0],n);
+			for (int i=0; i<n; i++) {
+				CPPUNIT_ASSERT(s[i]==x[i]+y[i]);
+				CPPUNIT_ASSERT(d[i]==x[i]-y[i]);
+			}
+		}
+	}
+}
+
+void TestSimdArith::inter_hull() {
+	BestBackend _b;
+	for (int k=0; k<nb_backends; k++) {
+		if (!select(backends[k])) continue;
+		unsigned int seed=2;
+		for (int t=0; t<nb_sizes; t++) {
+			int n=sizes[t];
+			IntervalVector x=random_vec(n,seed);
+			IntervalVector y=random_vec(n,seed);
+			IntervalVector h(x);
+			simd_hull(&h[0],&y[0],n);
+
+			bool empty=false;
+			for (int i=0; i<n; i++) {
+				CPPUNIT_ASSERT(h[i]==(x[i]|y[i]));
+				if ((x[i]&y[i]).is_empty()) empty=true;
+			}
+
+			IntervalVector z(x);
+			CPPUNIT_ASSERT(simd_inter(&z[0],&y[0],n)==!empty);
+			if (!empty)
+				for (int i=0; i<n; i++) CPPUNIT_ASSERT(z[i]==(x[i]&y[i]));
+
+			// intersection with a superset
+			IntervalVector w(x);
+			CPPUNIT_ASSERT(simd_inter(&w[0],&h[0],n));
+			CPPUNIT_ASSERT(same(w,x));
+		}
+	}
+}
+
+void TestSimdArith::diam() {
+	BestBackend _b;
+	for (int k=0; k<nb_backends; k++) {
+		if (!select(backends[k])) continue;
+		unsigned int seed=3;
+		for (int t=0; t<nb_sizes; t++) {
+			int n=sizes[t];
+			IntervalVector x=random_vec(n,seed);
+			Vector d(n);
+			simd_diam(&x[0],&d[0],n);
+			for (int i=0; i<n; i++)
+				CPPUNIT_ASSERT(d[i]==x[i].diam());
+		}
+	}
+}
+
+void TestSimdArith::axpy() {
+	BestBackend _b;
+	for (int k=0; k<nb_backends; k++) {
+		if (!select(backends[k])) continue;
+		unsigned int seed=4;
+		for (int t=0; t<nb_sizes; t++) {
+			int n=sizes[t];
+			double a=(n%2==0? -1 : 1)*next(seed);
+			IntervalVector x=random_vec(n,seed);
+			IntervalVector y=random_vec(n,seed);
+			IntervalVector z(y);
+			simd_axpy(a,&x[0],&z[0],n);
+			for (int i=0; i<n; i++)
+				CPPUNIT_ASSERT(z[i]==y[i]+a*x[i]);
+		}
+	}
+}
+
+void TestSimdArith::dot() {
+	BestBackend _b;
+	for (int k=0; k<nb_backends; k++) {
+		if (!select(backends[k])) continue;
+		unsigned int seed=5;
+		for (int t=0; t<nb_sizes; t++) {
+			int n=sizes[t];
+			Vector a=random_real_vec(n,seed);
+			IntervalVector x=random_vec(n,seed);
+			Interval s=0;
+			for (int i=0; i<n; i++) s+=a[i]*x[i];
+			CPPUNIT_ASSERT(simd_dot(&a[0],&x[0],n)==s);
+		}
+	}
+}
+
+void TestSimdArith::unbounded() {
+	BestBackend _b;
+	for (int k=0; k<nb_backends; k++) {
+		if (!select(backends[k])) continue;
+
+		for (int n=5; n<=20; n+=15) {
+			IntervalVector x(n);
+			Vector a(n);
+			for (int i=0; i<n; i+=5) {
+				x[i]=Interval(NEG_INFINITY,1);     a[i]=-2;
+				x[i+1]=Interval(-1,POS_INFINITY);  a[i+1]=0;
+				x[i+2]=Interval::ALL_REALS;        a[i+2]=0;
+				x[i+3]=Interval(2,3);              a[i+3]=1;
+				x[i+4]=Interval(NEG_INFINITY,0);   a[i+4]=1;
+			}
+
+			IntervalVector y(n,Interval(-1,1));
+
+			IntervalVector s(x);
+			simd_add(&s[0],&y[0],n);
+			for (int i=0; i<n; i++) CPPUNIT_ASSERT(s[i]==x[i]+y[i]);
+
+			Vector d(n);
+			simd_diam(&x[0],&d[0],n);
+			for (int i=0; i<n; i++) CPPUNIT_ASSERT(d[i]==x[i].diam());
+
+			Interval p=Interval::ZERO;
+			for (int i=0; i<n; i++)
+				if (a[i]!=0) p+=a[i]*x[i];
+			CPPUNIT_ASSERT(p==Interval(-2*(n/5),POS_INFINITY)+Interval(2*(n/5),3*(n/5))+Interval(NEG_INFINITY,0));
+			CPPUNIT_ASSERT(simd_dot(&a[0],&x[0],n)==p);
+
+			// an infinite coefficient gives the empty set, as with scalar operations
+			a[3]=POS_INFINITY;
+			CPPUNIT_ASSERT(simd_dot(&a[0],&y[0],n).is_empty());
+
+			IntervalVector z(y);
+			simd_axpy(NEG_INFINITY,&x[0],&z[0],n);
+			CPPUNIT_ASSERT(z.is_empty());
+		}
+	}
+}
+
+void TestSimdArith::mat_vec() {
+	BestBackend _b;
+	for (int k=0; k<nb_backends; k++) {
+		if (!select(backends[k])) continue;
+		unsigned int seed=6;
+		for (int n=1; n<=N; n+=3) {
+			Matrix m(n+1,n);
+			for (int i=0; i<n+1; i++) m[i]=random_real_vec(n,seed);
+			IntervalVector x=random_vec(n,seed);
+
+			IntervalVector y(n+1,Interval::ZERO);
+			for (int i=0; i<n+1; i++)
+				for (int j=0; j<n; j++) y[i]+=m[i][j]*x[j];
+
+			CPPUNIT_ASSERT(same(m*x,y));
+
+			// aliasing
+			IntervalVector z(x);
+			z-=z;
+			for (int i=0; i<n; i++) CPPUNIT_ASSERT(z[i]==x[i]-x[i]);
+			z=x;
+			simd_axpy(-2.5,&z[0],&z[0],n);
+			for (int i=0; i<n; i++) CPPUNIT_ASSERT(z[i]==x[i]+(-2.5)*x[i]);
+		}
+	}
+}
+
+void TestSimdArith::mat_mat() {
+	BestBackend _b;
+	for (int k=0; k<nb_backends; k++) {
+		if (!select(backends[k])) continue;
+		unsigned int seed=7;
+		for (int n=1; n<=N; n+=3) {
+			Matrix m1(n,n+2);
+			for (int i=0; i<n; i++) m1[i]=random_real_vec(n+2,seed);
+			IntervalMatrix m2(n+2,n);
+			for (int i=0; i<n+2; i++) m2[i]=random_vec(n,seed);
+
+			IntervalMatrix m3(n,n,Interval::ZERO);
+			for (int i=0; i<n; i++)
+				for (int j=0; j<n; j++)
+					for (int l=0; l<n+2; l++) m3[i][j]+=m1[i][l]*m2[l][j];
+
+			IntervalMatrix p=m1*m2;
+			for (int i=0; i<n; i++) CPPUNIT_ASSERT(same(p[i],m3[i]));
+		}
+	}
+}
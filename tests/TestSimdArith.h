@@ -0,0 +1,47 @@
+/* ============================================================================
+ * I B E X - Bulk (SIMD) interval operations Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_SIMD_ARITH_H__
+#define __TEST_SIMD_ARITH_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+using namespace ibex;
+
+class TestSimdArith : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestSimdArith);
+		CPPUNIT_TEST(add_sub);
+		CPPUNIT_TEST(inter_hull);
+		CPPUNIT_TEST(diam);
+		CPPUNIT_TEST(axpy);
+		CPPUNIT_TEST(dot);
+		CPPUNIT_TEST(unbounded);
+		CPPUNIT_TEST(mat_vec);
+		CPPUNIT_TEST(mat_mat);
+	CPPUNIT_TEST_SUITE_END();
+
+	void add_sub();
+	void inter_hull();
+	void diam();
+	void axpy();
+	void dot();
+	void unbounded();
+	void mat_vec();
+	void mat_mat();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestSimdArith);
+
+#endif // __TEST_SIMD_ARITH_H__
@@ -0,0 +1,116 @@
+/* ============================================================================
+ * I B E X - Sparse Interval Matrix Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestSparseIntervalMatrix.h"
+
+using namespace std;
+
+namespace {
+
+IntervalMatrix M1() {
+	IntervalMatrix M(3,4,Interval::ZERO);
+	M[0][1]=Interval(1,2);
+	M[0][3]=Interval(-1,0);
+	M[1][0]=Interval(0,1);
+	M[2][2]=Interval(3,3);
+	M[2][3]=Interval(-2,-1);
+	return M;
+}
+
+}
+
+void TestSparseIntervalMatrix::cons01() {
+	IntervalMatrix M=M1();
+	SparseIntervalMatrix A(M);
+
+	CPPUNIT_ASSERT(A.nb_rows()==3);
+	CPPUNIT_ASSERT(A.nb_cols()==4);
+	CPPUNIT_ASSERT(A.nnz()==5);
+	CPPUNIT_ASSERT(!A.is_empty());
+
+	CPPUNIT_ASSERT(A.row_end(0)-A.row_begin(0)==2);
+	CPPUNIT_ASSERT(A.col(A.row_begin(0))==1);
+	CPPUNIT_ASSERT(A.col(A.row_begin(0)+1)==3);
+	CPPUNIT_ASSERT(A.row_end(1)-A.row_begin(1)==1);
+	CPPUNIT_ASSERT(A.row_end(2)-A.row_begin(2)==2);
+
+	CPPUNIT_ASSERT(A.find(0,0)==-1);
+	CPPUNIT_ASSERT(A.val(A.find(2,3))==Interval(-2,-1));
+
+	for (int i=0; i<3; i++)
+		for (int j=0; j<4; j++)
+			CPPUNIT_ASSERT(A(i,j)==M[i][j]);
+
+	CPPUNIT_ASSERT(A.dense()==M);
+}
+
+void TestSparseIntervalMatrix::cons02() {
+	vector<vector<int> > rows(2);
+	rows[0].push_back(0);
+	rows[0].push_back(2);
+	rows[1].push_back(1);
+
+	SparseIntervalMatrix A(3,rows);
+	CPPUNIT_ASSERT(A.nb_rows()==2);
+	CPPUNIT_ASSERT(A.nb_cols()==3);
+	CPPUNIT_ASSERT(A.nnz()==3);
+	CPPUNIT_ASSERT(A.find(0,2)!=-1);
+	CPPUNIT_ASSERT(A.find(0,1)==-1);
+	CPPUNIT_ASSERT(A(0,2)==Interval::ZERO);
+
+	A.val(A.find(1,1))=Interval(1,2);
+	CPPUNIT_ASSERT(A(1,1)==Interval(1,2));
+
+	A.clear();
+	CPPUNIT_ASSERT(A.nnz()==3);
+	CPPUNIT_ASSERT(A(1,1)==Interval::ZERO);
+}
+
+void TestSparseIntervalMatrix::rows01() {
+	IntervalMatrix M=M1();
+	SparseIntervalMatrix A(M);
+
+	BitSet b=BitSet::empty(3);
+	b.add(0);
+	b.add(2);
+	SparseIntervalMatrix B=A.rows(b);
+
+	CPPUNIT_ASSERT(B.nb_rows()==2);
+	CPPUNIT_ASSERT(B.nb_cols()==4);
+	CPPUNIT_ASSERT(B.nnz()==4);
+	CPPUNIT_ASSERT(B.dense().row(0)==M.row(0));
+	CPPUNIT_ASSERT(B.dense().row(1)==M.row(2));
+}
+
+void TestSparseIntervalMatrix::mul01() {
+	IntervalMatrix M=M1();
+	SparseIntervalMatrix A(M);
+
+	IntervalVector x(4);
+	x[0]=Interval(1,2);
+	x[1]=Interval(-1,1);
+	x[2]=Interval(0,1);
+	x[3]=Interval(2,3);
+
+	CPPUNIT_ASSERT(A*x==M*x);
+}
+
+void TestSparseIntervalMatrix::empty01() {
+	IntervalMatrix M=M1();
+	SparseIntervalMatrix A(M);
+	A.set_empty();
+	CPPUNIT_ASSERT(A.is_empty());
+	CPPUNIT_ASSERT(A.dense().is_empty());
+	CPPUNIT_ASSERT((A*IntervalVector(4)).is_empty());
+
+	M.set_empty();
+	CPPUNIT_ASSERT(SparseIntervalMatrix(M).is_empty());
+}
@@ -0,0 +1,47 @@
+/* ============================================================================
+ * I B E X - Sparse Interval Matrix Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_SPARSE_INTERVAL_MATRIX_H__
+#define __TEST_SPARSE_INTERVAL_MATRIX_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "ibex_SparseIntervalMatrix.h"
+#include "utils.h"
+
+using namespace ibex;
+
+class TestSparseIntervalMatrix : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestSparseIntervalMatrix);
+
+	CPPUNIT_TEST(cons01);
+	CPPUNIT_TEST(cons02);
+	CPPUNIT_TEST(rows01);
+	CPPUNIT_TEST(mul01);
+	CPPUNIT_TEST(empty01);
+
+	CPPUNIT_TEST_SUITE_END();
+
+	// from a dense matrix
+	void cons01();
+	// from a pattern
+	void cons02();
+	void rows01();
+	void mul01();
+	void empty01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestSparseIntervalMatrix);
+
+#endif // __TEST_SPARSE_INTERVAL_MATRIX_H__
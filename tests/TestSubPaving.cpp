@@ -0,0 +1,166 @@
+/* ============================================================================
+ * I B E X - SubPaving Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestSubPaving.h"
+#include "ibex_SubPaving.h"
+#include "ibex_Paver.h"
+#include "ibex_CtcFwdBwd.h"
+#include "ibex_CtcNotIn.h"
+#include "ibex_CtcEmpty.h"
+#include "ibex_PdcDiameterLT.h"
+#include "ibex_LargestFirst.h"
+#include "ibex_CellStack.h"
+#include "ibex_Function.h"
+
+#include <cstdio>
+
+using namespace std;
+
+namespace {
+
+bool same_trace(const pair<IntervalVector,IntervalVector>& t1, const pair<IntervalVector,IntervalVector>& t2) {
+	return t1.first==t2.first && t1.second==t2.second;
+}
+
+bool same_paving(const SubPaving& p1, const SubPaving& p2) {
+	if (p1.size()!=p2.size()) return false;
+	for (int i=0; i<p1.size(); i++)
+		if (!same_trace(p1.trace(i),p2.trace(i))) return false;
+	return true;
+}
+
+}
+
+void TestSubPaving::compact01() {
+	double _b1[][2]= {{0,1},{0,1},{0,1}};
+	double _a1[][2]= {{0,1},{0,0.5},{0,1}};
+	double _b2[][2]= {{0,1},{0,0.5},{0,0.5}};
+	IntervalVector b1(3,_b1);
+	IntervalVector a1(3,_a1);
+	IntervalVector b2(3,_b2);
+
+	SubPaving p;
+	p.set_compact(3);
+	CPPUNIT_ASSERT(p.is_compact());
+	p.add(b1,a1);
+	p.add(b2);
+	CPPUNIT_ASSERT(p.size()==2);
+	CPPUNIT_ASSERT(p.trace(0).first==b1);
+	CPPUNIT_ASSERT(p.trace(0).second==a1);
+	CPPUNIT_ASSERT(p.trace(1).first==b2);
+	CPPUNIT_ASSERT(p.trace(1).second.is_empty());
+}
+
+// check reconstruction across several full boxes
+void TestSubPaving::compact02() {
+	SubPaving full;
+	SubPaving compact;
+	compact.set_compact(4,3);
+
+	IntervalVector x(4,Interval(0,100));
+	for (int i=0; i<10; i++) {
+		IntervalVector y(x);
+		y[i%4]=Interval(x[i%4].lb(),x[i%4].mid());
+		full.add(x,y);
+		compact.add(x,y);
+		x[(i+1)%4]=Interval(x[(i+1)%4].mid(),x[(i+1)%4].ub());
+	}
+	CPPUNIT_ASSERT(same_paving(full,compact));
+}
+
+// traces encoded against explicit parents (search tree)
+void TestSubPaving::compact_parent() {
+	SubPaving full;
+	SubPaving compact;
+	compact.set_compact(3,2);
+
+	// a depth-first tree of boxes: each node bisects
+	// its parent and contracts one coordinate. The last
+	// parent is not an ancestor of the previous trace.
+	int parent[] = { -1, 0, 1, 2, 1, 0, 5, 6, 3 };
+	vector<IntervalVector> before(9, IntervalVector(3,Interval(0,64)));
+	for (int i=0; i<9; i++) {
+		if (parent[i]!=-1) {
+			before[i]=before[parent[i]];
+			Interval& x=before[i][i%3];
+			x = i%2? Interval(x.lb(),x.mid()) : Interval(x.mid(),x.ub());
+		}
+		IntervalVector after(before[i]);
+		after[(i+1)%3]=Interval(after[(i+1)%3].lb(),after[(i+1)%3].mid());
+		if (i==4) {
+			full.add(before[i]);
+			compact.add(before[i],parent[i]);
+		} else {
+			full.add(before[i],after);
+			compact.add(before[i],after,parent[i]);
+		}
+	}
+	CPPUNIT_ASSERT(same_paving(full,compact));
+}
+
+void TestSubPaving::stream_fail() {
+	SubPaving p;
+	p.set_compact(2);
+	CPPUNIT_ASSERT_THROW(p.stream("/nonexistent/paving.tmp"), SubPavingException);
+	CPPUNIT_ASSERT_THROW(SubPaving("/nonexistent/paving.tmp"), SubPavingException);
+}
+
+void TestSubPaving::paver_compact() {
+	Function f("x","y","x^2+y^2");
+	CtcFwdBwd c1(f,Interval(0,4));
+	CtcNotIn c2(f,Interval(0,4));
+	PdcDiameterLT prec(0.5);
+	CtcEmpty c3(prec);
+	Array<Ctc> ctc(c1,c2,c3);
+	LargestFirst lf(0.1);
+	CellStack stack;
+	Paver p(ctc, lf, stack);
+	p.ctc_loop = false;
+
+	IntervalVector box(2,Interval(-3,3));
+	SubPaving* paving1=p.pave(box);
+	p.compact_paving = true;
+	SubPaving* paving2=p.pave(box);
+
+	for (int i=0; i<3; i++) {
+		CPPUNIT_ASSERT(paving2[i].is_compact());
+		CPPUNIT_ASSERT(same_paving(paving1[i],paving2[i]));
+	}
+	delete[] paving1;
+	delete[] paving2;
+}
+
+void TestSubPaving::paver_stream() {
+	Function f("x","y","x^2+y^2");
+	CtcFwdBwd c1(f,Interval(0,4));
+	CtcNotIn c2(f,Interval(0,4));
+	PdcDiameterLT prec(0.5);
+	CtcEmpty c3(prec);
+	Array<Ctc> ctc(c1,c2,c3);
+	LargestFirst lf(0.1);
+	CellStack stack;
+	Paver p(ctc, lf, stack);
+	p.ctc_loop = false;
+
+	IntervalVector box(2,Interval(-3,3));
+	SubPaving* paving1=p.pave(box);
+	p.paving_file = "paving.tmp";
+	SubPaving* paving2=p.pave(box);
+	delete[] paving2;
+
+	const char* files[] = { "paving.tmp.0", "paving.tmp.1", "paving.tmp.2" };
+	for (int i=0; i<3; i++) {
+		SubPaving paving3(files[i]);
+		CPPUNIT_ASSERT(same_paving(paving1[i],paving3));
+		remove(files[i]);
+	}
+	delete[] paving1;
+}
@@ -0,0 +1,43 @@
+/* ============================================================================
+ * I B E X - SubPaving Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : Gilles Chabert
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_SUBPAVING_H__
+#define __TEST_SUBPAVING_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+using namespace ibex;
+
+class TestSubPaving : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestSubPaving);
+		CPPUNIT_TEST(compact01);
+		CPPUNIT_TEST(compact02);
+		CPPUNIT_TEST(compact_parent);
+		CPPUNIT_TEST(stream_fail);
+		CPPUNIT_TEST(paver_compact);
+		CPPUNIT_TEST(paver_stream);
+	CPPUNIT_TEST_SUITE_END();
+
+	void compact01();
+	void compact02();
+	void compact_parent();
+	void stream_fail();
+	void paver_compact();
+	void paver_stream();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestSubPaving);
+
+#endif // __TEST_SUBPAVING_H__
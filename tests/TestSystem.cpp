@@ -275,7 +275,7 @@ void TestSystem::normalize02() {
 	  fac.add_ctr(((const ExprNode&) ExprVector::new_col(e,e))=ExprConstant::new_vector(v,false));
 	  System sys(fac);
 	  NormalizedSystem nsys(sys,1);
-	  CPPUNIT_ASSERT(sys.f_ctrs.expr().size==12); // the DAG structure must be kept!
+	  CPPUNIT_ASSERT(sys.f_ctrs.expr().size()==12); // the DAG structure must be kept!
 	  CPPUNIT_ASSERT(sameExpr(sys.ctrs[0].f.expr(),"(((x+y);(x+y))+(-2 ; -3))"));
 	  CPPUNIT_ASSERT(sameExpr(sys.ctrs[1].f.expr(),"((-((x+y);(x+y)))+(0 ; 1))"));
 }